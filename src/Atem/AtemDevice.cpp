@@ -11,6 +11,9 @@
 AtemDevice::AtemDevice(const QString& address, QObject* parent)
     : SwitcherDevice(address, parent)
 {
+    QObject::connect(SwitcherDevice::atemConnection, SIGNAL(inputInfoChanged(const QAtem::InputInfo&)), this, SLOT(inputInfoChanged(const QAtem::InputInfo&)));
+    QObject::connect(SwitcherDevice::atemConnection, SIGNAL(macroInfoChanged(quint8, const QAtem::MacroInfo&)), this, SLOT(macroInfoChanged(quint8, const QAtem::MacroInfo&)));
+    QObject::connect(SwitcherDevice::atemConnection, SIGNAL(tallyStatesChanged()), this, SLOT(updateTally()));
 }
 
 quint8 AtemDevice::mixerEffects()
@@ -57,31 +60,117 @@ void AtemDevice::toggleFadeToBlack(const QString& me, qint8 speed)
     SwitcherDevice::atemConnection->mixEffect(me.toInt())->toggleFadeToBlack();
 }
 
-QVector<QAtem::MacroInfo> AtemDevice::macroInfos()
+const QVector<QAtem::MacroInfo>& AtemDevice::macroInfos() const
 {
-    /*
-    QVector<QAtem::MacroInfo> macros = SwitcherDevice::atemConnection->macroInfos();
-    foreach (QAtem::MacroInfo macro, macros)
-        qDebug("Name: %s Index: %s", qPrintable(macro.name), qPrintable(macro.index));
-    */
+    return this->macros;
+}
 
-    return SwitcherDevice::atemConnection->macroInfos();
+const QMap<quint16, QAtem::InputInfo>& AtemDevice::inputInfos() const
+{
+    return this->inputs;
 }
 
-QMap<quint16, QAtem::InputInfo> AtemDevice::inputInfos()
+QHash<quint16, QAtem::AudioInput> AtemDevice::audioInputs() const
 {
-    /*
-    QMap<quint16, QAtem::InputInfo> infos = SwitcherDevice::atemConnection->inputInfos();
-    foreach (quint16 key, infos.keys())
-        qDebug("LongText: %s  ShortText: %s Index: %s Internal Type: %s", infos.value(key).longText, infos.value(key).shortText, infos.value(key).index, infos.value(key).internalType);
-    */
+    return SwitcherDevice::atemConnection->audioInputs();
+}
 
-    return SwitcherDevice::atemConnection->inputInfos();
+int AtemDevice::getTally(quint16 input) const
+{
+    return this->tally.value(input, TallyNone);
 }
 
-QHash<quint16, QAtem::AudioInput> AtemDevice::audioInputs()
+void AtemDevice::loadState()
 {
-    return SwitcherDevice::atemConnection->audioInputs();
+    // The switcher has sent its complete state by the time the connection is reported.
+    this->inputs = SwitcherDevice::atemConnection->inputInfos();
+    this->macros = SwitcherDevice::atemConnection->macroInfos();
+
+    for (quint8 i = 0; i < SwitcherDevice::atemConnection->topology().MEs; i++)
+    {
+        QAtemMixEffect* mixEffect = SwitcherDevice::atemConnection->mixEffect(i);
+        if (mixEffect == NULL)
+            continue;
+
+        QObject::connect(mixEffect, SIGNAL(programInputChanged(quint8, quint16, quint16)), this, SLOT(updateTally()), Qt::UniqueConnection);
+        QObject::connect(mixEffect, SIGNAL(previewInputChanged(quint8, quint16, quint16)), this, SLOT(updateTally()), Qt::UniqueConnection);
+    }
+
+    emit inputsChanged(*this);
+    emit macrosChanged(*this);
+
+    updateTally();
+}
+
+void AtemDevice::clearState()
+{
+    this->inputs.clear();
+    this->macros.clear();
+
+    if (!this->tally.isEmpty())
+    {
+        this->tally.clear();
+        emit tallyChanged(*this);
+    }
+}
+
+void AtemDevice::updateTally()
+{
+    if (!isConnected())
+        return;
+
+    QHash<quint16, int> tally;
+    for (quint8 i = 0; i < SwitcherDevice::atemConnection->topology().MEs; i++)
+    {
+        const QAtemMixEffect* mixEffect = SwitcherDevice::atemConnection->mixEffect(i);
+        if (mixEffect == NULL)
+            continue;
+
+        tally[mixEffect->programInput()] |= TallyProgram;
+        tally[mixEffect->previewInput()] |= TallyPreview;
+    }
+
+    // The switcher's own tally of the external inputs also counts keys and running transitions, so it
+    // replaces what the mixer effects say for those inputs. Index 0 is input 1.
+    for (int i = 0; i < SwitcherDevice::atemConnection->tallyIndexCount(); i++)
+    {
+        int state = SwitcherDevice::atemConnection->tallyByIndex(i) & (TallyProgram | TallyPreview);
+        if (state == TallyNone)
+            tally.remove(i + 1);
+        else
+            tally[i + 1] = state;
+    }
+
+    // Transitions report the same inputs over and over, only a real change is passed on.
+    if (tally == this->tally)
+        return;
+
+    this->tally = tally;
+
+    emit tallyChanged(*this);
+}
+
+void AtemDevice::inputInfoChanged(const QAtem::InputInfo& info)
+{
+    if (!isConnected())
+        return; // Part of the initial state, loadState() picks it up.
+
+    this->inputs[info.index] = info;
+
+    emit inputsChanged(*this);
+}
+
+void AtemDevice::macroInfoChanged(quint8 index, const QAtem::MacroInfo& info)
+{
+    if (!isConnected())
+        return;
+
+    if (index >= this->macros.count())
+        this->macros.resize(index + 1);
+
+    this->macros[index] = info;
+
+    emit macrosChanged(*this);
 }
 
 void AtemDevice::selectInput(const QString& switcher, const QString& input, const QString& me)
@@ -139,6 +228,11 @@ void AtemDevice::sendNotification()
     {
         case SwitcherDevice::SwitcherDeviceCommand::CONNECTIONSTATE:
         {
+            if (isConnected())
+                loadState();
+            else
+                clearState();
+
             emit connectionStateChanged(*this);
 
             break;
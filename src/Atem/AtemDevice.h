@@ -6,11 +6,24 @@
 
 #include "SwitcherDevice.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+#include <QtCore/QVector>
+
+// Keeps a mirror of the input and macro tables of the switcher. The tables are read once when the connection
+// is up and then kept current from the change notifications, the getters hand out the mirror.
 class ATEM_EXPORT AtemDevice : public SwitcherDevice
 {
     Q_OBJECT
 
     public:
+        enum Tally
+        {
+            TallyNone = 0,
+            TallyProgram = 1,
+            TallyPreview = 2
+        };
+
         explicit AtemDevice(const QString& address, QObject* parent = 0);
 
         quint8 mixerEffects();
@@ -19,9 +32,12 @@ class ATEM_EXPORT AtemDevice : public SwitcherDevice
         void triggerAuto(const QString& target, qint8 speed, const QString& transition, const QString& me);
         void triggerCut(const QString& me);
 
-        QVector<QAtem::MacroInfo> macroInfos();
-        QMap<quint16, QAtem::InputInfo> inputInfos();
-        QHash<quint16, QAtem::AudioInput> audioInputs();
+        const QVector<QAtem::MacroInfo>& macroInfos() const;
+        const QMap<quint16, QAtem::InputInfo>& inputInfos() const;
+        QHash<quint16, QAtem::AudioInput> audioInputs() const;
+
+        // Program and preview as Tally flags, from the switcher's tally where it reports the input.
+        int getTally(quint16 input) const;
 
         void setAuxSource(const QString& aux, const QString& source);
         void selectInput(const QString& switcher, const QString& input, const QString& me);
@@ -34,7 +50,22 @@ class ATEM_EXPORT AtemDevice : public SwitcherDevice
         void setAudioGain(const QString& source, float gain);
 
         Q_SIGNAL void connectionStateChanged(AtemDevice&);
+        Q_SIGNAL void inputsChanged(AtemDevice&);
+        Q_SIGNAL void macrosChanged(AtemDevice&);
+        Q_SIGNAL void tallyChanged(AtemDevice&);
 
     protected:
         void sendNotification();
+
+    private:
+        QMap<quint16, QAtem::InputInfo> inputs;
+        QVector<QAtem::MacroInfo> macros;
+        QHash<quint16, int> tally;
+
+        void loadState();
+        void clearState();
+
+        Q_SLOT void updateTally();
+        Q_SLOT void inputInfoChanged(const QAtem::InputInfo&);
+        Q_SLOT void macroInfoChanged(quint8, const QAtem::MacroInfo&);
 };
@@ -0,0 +1,24 @@
+QT -= gui
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = amcpparser
+TEMPLATE = app
+
+SOURCES += \
+    Main.cpp
+
+DEPENDPATH += $$OUT_PWD/../../Caspar $$PWD/../../Caspar
+INCLUDEPATH += $$OUT_PWD/../../Caspar $$PWD/../../Caspar
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../../Caspar/release/ -lcaspar
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../../Caspar/debug/ -lcaspar
+else:macx:LIBS += -L$$OUT_PWD/../../Caspar/ -lcaspar
+else:unix:LIBS += -L$$OUT_PWD/../../Caspar/ -lcaspar
+
+DEPENDPATH += $$OUT_PWD/../../Common $$PWD/../../Common
+INCLUDEPATH += $$OUT_PWD/../../Common $$PWD/../../Common
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../../Common/release/ -lcommon
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../../Common/debug/ -lcommon
+else:macx:LIBS += -L$$OUT_PWD/../../Common/ -lcommon
+else:unix:LIBS += -L$$OUT_PWD/../../Common/ -lcommon
@@ -0,0 +1,164 @@
+#include "AmcpListParser.h"
+#include "AmcpParser.h"
+#include "AmcpResponse.h"
+#include "Timecode.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextCodec>
+#include <QtCore/QTextStream>
+
+static const int CHUNK_SIZE = 64 * 1024; // Roughly what a socket read hands us on a LAN.
+
+QByteArray createListing(int lines)
+{
+    QByteArray listing("200 CLS OK\r\n");
+    listing.reserve(lines * 72);
+
+    for (int i = 0; i < lines; ++i)
+    {
+        // Every tenth clip is a still, and a few clips have non-ASCII names in subfolders.
+        if (i % 10 == 9)
+            listing.append(QString("\"STILLS\\PICTURE_%1\"  STILL  1843254 20121101160514 0 1/25\r\n").arg(i).toUtf8());
+        else if (i % 100 == 42)
+            listing.append(QString::fromUtf8("\"NYHETER\\VÄDER_%1\"  MOVIE  6445960 20121101160514 643 1/50\r\n").arg(i).toUtf8());
+        else
+            listing.append(QString("\"MOVIES\\CLIP_%1\"  MOVIE  16694084 20121101150514 %2 1/25\r\n").arg(i).arg(i % 9000).toUtf8());
+    }
+
+    listing.append("\r\n");
+
+    return listing;
+}
+
+int parseCurrent(const QByteArray& listing)
+{
+    AmcpParser parser;
+    QList<AmcpResponse> responses;
+    for (int offset = 0; offset < listing.size(); offset += CHUNK_SIZE)
+        parser.parse(listing.mid(offset, CHUNK_SIZE), responses);
+
+    int count = 0;
+    foreach (const AmcpResponse& response, responses)
+        count += AmcpListParser::parseMedia(response.getBody()).count();
+
+    return count;
+}
+
+int parseLegacy(const QByteArray& listing)
+{
+    // The QString based framing and split parsing the client used before AmcpListParser.
+    QTextDecoder decoder(QTextCodec::codecForName("UTF-8"));
+
+    QString fragments;
+    QList<QString> lines;
+    for (int offset = 0; offset < listing.size(); offset += CHUNK_SIZE)
+    {
+        fragments += decoder.toUnicode(listing.mid(offset, CHUNK_SIZE));
+
+        int position;
+        while ((position = fragments.indexOf("\r\n")) != -1)
+        {
+            QString line = fragments.left(position);
+            fragments.remove(0, position + 2);
+
+            if (!line.isEmpty())
+                lines.append(line);
+        }
+    }
+
+    lines.removeFirst(); // First post is the header, 200 CLS OK.
+
+    QList<CasparMedia> items;
+    foreach (QString response, lines)
+    {
+        QString name = response.split("\" ").at(0);
+        name.replace("\\", "/");
+        if (name.startsWith("\""))
+            name.remove(0, 1);
+
+        if (name.endsWith("\""))
+            name.remove(name.length() - 1, 1);
+
+        QString type = response.split("\" ").at(1).trimmed().split(" ").at(0);
+
+        QString timecode;
+        if (response.split("\" ").at(1).trimmed().split(" ").count() > 5)
+        {
+            QString totalFrames = response.split("\" ").at(1).trimmed().split(" ").at(4);
+            QStringList timebase = response.split("\" ").at(1).trimmed().split(" ").at(5).split("/");
+
+            int frames = totalFrames.toInt();
+            double fps = timebase.at(1).toDouble() / timebase.at(0).toDouble();
+
+            double time = frames * (1.0 / fps);
+            timecode = Timecode::fromTime(time, fps, false);
+        }
+
+        items.push_back(CasparMedia(name, type, timecode));
+    }
+
+    return items.count();
+}
+
+void report(QTextStream& out, const QString& name, int lines, int iterations, qint64 nsecs)
+{
+    double seconds = nsecs / 1000000000.0;
+    out << QString("%1: %2 lines x %3 in %4 ms, %5 lines/s")
+           .arg(name, -8).arg(lines).arg(iterations).arg(nsecs / 1000000)
+           .arg(static_cast<qint64>(lines * iterations / seconds)) << endl;
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    QCoreApplication::setApplicationName("amcpparser");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Parses synthetic CLS listings and reports lines per second.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("lines", "Number of lines in the listing.", "lines", "100000"));
+    parser.addOption(QCommandLineOption("iterations", "Number of times the listing is parsed.", "iterations", "10"));
+    parser.addOption(QCommandLineOption("legacy", "Also run the previous QString based parser for comparison."));
+    parser.process(application);
+
+    int lines = parser.value("lines").toInt();
+    int iterations = parser.value("iterations").toInt();
+
+    QTextStream out(stdout);
+
+    QByteArray listing = createListing(lines);
+    out << QString("Listing: %1 lines, %2 bytes").arg(lines).arg(listing.size()) << endl;
+
+    // Warm up and make sure every line made it through.
+    int parsed = parseCurrent(listing);
+    if (parsed != lines)
+    {
+        out << QString("Parsed %1 of %2 lines").arg(parsed).arg(lines) << endl;
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < iterations; ++i)
+        parseCurrent(listing);
+
+    report(out, "current", lines, iterations, timer.nsecsElapsed());
+
+    if (parser.isSet("legacy"))
+    {
+        timer.restart();
+        for (int i = 0; i < iterations; ++i)
+            parseLegacy(listing);
+
+        report(out, "legacy", lines, iterations, timer.nsecsElapsed());
+    }
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include "FakeAmcpServer.h"
+
+#include <QtCore/QBuffer>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+
+#include <QtGui/QColor>
+#include <QtGui/QImage>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpSocket>
+
+FakeAmcpServer::FakeAmcpServer(QObject* parent)
+    : QTcpServer(parent)
+{
+    // A real server hands out 256x144 PNG thumbnails, a flat one is close enough in size.
+    QImage image(256, 144, QImage::Format_RGB32);
+    image.fill(QColor(Qt::darkCyan));
+
+    QBuffer buffer(&this->thumbnail);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+
+    this->thumbnail = this->thumbnail.toBase64();
+
+    QObject::connect(this, SIGNAL(newConnection()), this, SLOT(acceptConnection()));
+}
+
+void FakeAmcpServer::setMediaCount(int count)
+{
+    this->mediaCount = count;
+}
+
+void FakeAmcpServer::setTemplateCount(int count)
+{
+    this->templateCount = count;
+}
+
+void FakeAmcpServer::setDataCount(int count)
+{
+    this->dataCount = count;
+}
+
+void FakeAmcpServer::setThumbnailCount(int count)
+{
+    this->thumbnailCount = count;
+}
+
+void FakeAmcpServer::setLatency(int latency)
+{
+    this->latency = latency;
+}
+
+int FakeAmcpServer::getCommandCount() const
+{
+    return this->commandCount;
+}
+
+bool FakeAmcpServer::start(int port)
+{
+    if (!QTcpServer::listen(QHostAddress::LocalHost, port))
+    {
+        qCritical("Unable to listen for AMCP connections on port %d: %s", port, qPrintable(QTcpServer::errorString()));
+        return false;
+    }
+
+    qDebug("Listening for AMCP connections on port %d", QTcpServer::serverPort());
+
+    return true;
+}
+
+void FakeAmcpServer::acceptConnection()
+{
+    while (QTcpServer::hasPendingConnections())
+    {
+        QTcpSocket* socket = QTcpServer::nextPendingConnection();
+        QObject::connect(socket, SIGNAL(readyRead()), this, SLOT(readCommands()));
+        QObject::connect(socket, SIGNAL(disconnected()), this, SLOT(removeConnection()));
+
+        this->buffers.insert(socket, QByteArray());
+    }
+}
+
+void FakeAmcpServer::removeConnection()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(QObject::sender());
+
+    this->buffers.remove(socket);
+    socket->deleteLater();
+}
+
+void FakeAmcpServer::readCommands()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(QObject::sender());
+
+    QByteArray& buffer = this->buffers[socket];
+    buffer.append(socket->readAll());
+
+    int position;
+    while ((position = buffer.indexOf("\r\n")) != -1)
+    {
+        QString command = QString::fromUtf8(buffer.left(position)).trimmed();
+        buffer.remove(0, position + 2);
+
+        if (command.isEmpty())
+            continue;
+
+        this->commandCount++;
+
+        reply(socket, createResponse(command));
+    }
+}
+
+void FakeAmcpServer::reply(QTcpSocket* socket, const QByteArray& response)
+{
+    if (this->latency <= 0)
+    {
+        socket->write(response);
+        return;
+    }
+
+    // The socket might be gone by the time the reply is due.
+    QPointer<QTcpSocket> target(socket);
+    QTimer::singleShot(this->latency, this, [target, response]()
+    {
+        if (!target.isNull())
+            target->write(response);
+    });
+}
+
+QByteArray FakeAmcpServer::createResponse(const QString& command) const
+{
+    QStringList tokens = command.split(" ", QString::SkipEmptyParts);
+    QString name = tokens.at(0).toUpper();
+
+    // INFO <channel>[-<layer>] asks about a channel, only INFO SYSTEM and the like name a subcommand.
+    if (name == "INFO" && tokens.count() > 1 && tokens.at(1).at(0).isDigit())
+        return createChannelInfo(tokens.at(1));
+
+    if (tokens.count() > 1 && (name == "DATA" || name == "THUMBNAIL" || name == "INFO"))
+        name = QString("%1 %2").arg(name).arg(tokens.at(1).toUpper());
+
+    if (name == "CLS")
+        return createMediaListing();
+    else if (name == "TLS")
+        return createTemplateListing();
+    else if (name == "DATA LIST")
+        return createDataListing();
+    else if (name == "THUMBNAIL LIST")
+        return createThumbnailListing();
+    else if (name == "THUMBNAIL RETRIEVE")
+        return QByteArray("201 THUMBNAIL RETRIEVE OK\r\n").append(this->thumbnail).append("\r\n");
+    else if (name == "VERSION")
+        return QByteArray("201 VERSION OK\r\n2.0.7.e9fc25a Stable\r\n");
+    else if (name == "INFO")
+        return QByteArray("200 INFO OK\r\n1 1080i5000 PLAYING\r\n2 1080i5000 PLAYING\r\n\r\n");
+    else if (name == "INFO SYSTEM")
+        return QByteArray("201 INFO SYSTEM OK\r\n<?xml version=\"1.0\" encoding=\"utf-8\"?><system/>\r\n");
+
+    return QString("202 %1 OK\r\n").arg(name).toUtf8();
+}
+
+QByteArray FakeAmcpServer::createMediaListing() const
+{
+    QByteArray listing("200 CLS OK\r\n");
+    listing.reserve(this->mediaCount * 72);
+
+    for (int i = 0; i < this->mediaCount; ++i)
+    {
+        if (i % 10 == 9)
+            listing.append(QString("\"STILLS\\PICTURE_%1\"  STILL  1843254 20121101160514 0 1/25\r\n").arg(i).toUtf8());
+        else if (i % 20 == 7)
+            listing.append(QString("\"AUDIO\\SOUND_%1\"  AUDIO  3843254 20121101160514 %2 1/48000\r\n").arg(i).arg(48000 * (i % 60 + 1)).toUtf8());
+        else
+            listing.append(QString("\"MOVIES\\CLIP_%1\"  MOVIE  16694084 20121101150514 %2 1/25\r\n").arg(i).arg(250 + i % 9000).toUtf8());
+    }
+
+    return listing.append("\r\n");
+}
+
+QByteArray FakeAmcpServer::createTemplateListing() const
+{
+    QByteArray listing("200 TLS OK\r\n");
+    for (int i = 0; i < this->templateCount; ++i)
+        listing.append(QString("\"TEMPLATES\\LOWER_THIRD_%1\"  21862 20121101160514\r\n").arg(i).toUtf8());
+
+    return listing.append("\r\n");
+}
+
+QByteArray FakeAmcpServer::createDataListing() const
+{
+    QByteArray listing("200 DATA LIST OK\r\n");
+    for (int i = 0; i < this->dataCount; ++i)
+        listing.append(QString("\"DATA\\STORED_%1\"  1024 20121101160514\r\n").arg(i).toUtf8());
+
+    return listing.append("\r\n");
+}
+
+QByteArray FakeAmcpServer::createThumbnailListing() const
+{
+    QByteArray listing("200 THUMBNAIL LIST OK\r\n");
+    for (int i = 0; i < this->thumbnailCount; ++i)
+        listing.append(QString("\"MOVIES\\CLIP_%1\" 20121101T160514 14384\r\n").arg(i).toUtf8());
+
+    return listing.append("\r\n");
+}
+
+QByteArray FakeAmcpServer::createChannelInfo(const QString& target) const
+{
+    QStringList numbers = target.split("-");
+
+    bool ok = false;
+    int channel = numbers.at(0).toInt(&ok);
+    if (!ok || channel < 1 || channel > 2)
+        return QByteArray("401 INFO ERROR\r\n");
+
+    // The same clip the media listing starts with, playing on every layer asked about.
+    QString layer = "<status>playing</status><auto_delta>null</auto_delta><frame-number>125</frame-number><nb_frames>250</nb_frames>"
+                    "<frames-left>125</frames-left><foreground><producer>ffmpeg</producer><filename>MOVIES/CLIP_0.mov</filename>"
+                    "<loop>false</loop></foreground><background><producer>empty</producer></background>";
+
+    // Two channels, as the plain INFO listing says.
+    QString info;
+    if (numbers.count() > 1)
+        info = QString("<layer>%1</layer>").arg(layer);
+    else
+        info = QString("<channel><video-mode>1080i5000</video-mode><stage><layer><layer_10>%1</layer_10></layer></stage>"
+                       "<output><port><type>screen</type><index>0</index></port></output></channel>").arg(layer);
+
+    return QString("201 INFO OK\r\n<?xml version=\"1.0\" encoding=\"utf-8\"?>%1\r\n").arg(info).toUtf8();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include <QtNetwork/QTcpServer>
+
+class QTcpSocket;
+
+// Answers the AMCP commands the client sends on connect and on library refresh with synthetic
+// listings of a configurable size. Every reply is held back for a fixed latency to mimic a
+// server that is busy or far away.
+class FakeAmcpServer : public QTcpServer
+{
+    Q_OBJECT
+
+    public:
+        explicit FakeAmcpServer(QObject* parent = 0);
+
+        void setMediaCount(int count);
+        void setTemplateCount(int count);
+        void setDataCount(int count);
+        void setThumbnailCount(int count);
+        void setLatency(int latency);
+
+        int getCommandCount() const;
+
+        Q_SLOT bool start(int port);
+
+    private:
+        int mediaCount = 1000;
+        int templateCount = 100;
+        int dataCount = 100;
+        int thumbnailCount = 1000;
+        int latency = 0;
+        int commandCount = 0;
+
+        QByteArray thumbnail;
+        QHash<QTcpSocket*, QByteArray> buffers;
+
+        QByteArray createResponse(const QString& command) const;
+        QByteArray createMediaListing() const;
+        QByteArray createTemplateListing() const;
+        QByteArray createDataListing() const;
+        QByteArray createThumbnailListing() const;
+        QByteArray createChannelInfo(const QString& target) const;
+
+        void reply(QTcpSocket* socket, const QByteArray& response);
+
+        Q_SLOT void acceptConnection();
+        Q_SLOT void readCommands();
+        Q_SLOT void removeConnection();
+};
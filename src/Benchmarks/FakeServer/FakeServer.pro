@@ -0,0 +1,28 @@
+QT += core gui network
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = fakeserver
+TEMPLATE = app
+
+HEADERS += \
+    FakeAmcpServer.h \
+    OscGenerator.h \
+    TsStreamer.h
+
+SOURCES += \
+    Main.cpp \
+    FakeAmcpServer.cpp \
+    OscGenerator.cpp \
+    TsStreamer.cpp
+
+CONFIG(system-oscpack) {
+    LIBS += -loscpack
+} else {
+    DEPENDPATH += $$PWD/../../../lib/oscpack/include
+    INCLUDEPATH += $$PWD/../../../lib/oscpack/include
+    win32:LIBS += -L$$PWD/../../../lib/oscpack/lib/win32/ -loscpack -lws2_32
+    else:macx:LIBS += -L$$PWD/../../../lib/oscpack/lib/macx/ -loscpack
+    else:unix:LIBS += -L$$PWD/../../../lib/oscpack/lib/linux/ -loscpack
+}
@@ -0,0 +1,68 @@
+#include "FakeAmcpServer.h"
+#include "OscGenerator.h"
+#include "TsStreamer.h"
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QString>
+
+#include <QtGui/QGuiApplication>
+
+int main(int argc, char* argv[])
+{
+    // Only QImage is needed from the GUI module, never open a window system connection.
+    qputenv("QT_QPA_PLATFORM", "minimal");
+
+    QGuiApplication application(argc, argv);
+    QGuiApplication::setApplicationName("fakeserver");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulates a CasparCG server for the client, AMCP over TCP and OSC over UDP.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("port", "AMCP port to listen on.", "port", "5250"));
+    parser.addOption(QCommandLineOption("latency", "Delay in milliseconds before every AMCP reply.", "latency", "0"));
+    parser.addOption(QCommandLineOption("media", "Number of clips in the CLS listing.", "media", "1000"));
+    parser.addOption(QCommandLineOption("templates", "Number of templates in the TLS listing.", "templates", "100"));
+    parser.addOption(QCommandLineOption("data", "Number of entries in the DATA LIST listing.", "data", "100"));
+    parser.addOption(QCommandLineOption("thumbnails", "Number of entries in the THUMBNAIL LIST listing.", "thumbnails", "1000"));
+    parser.addOption(QCommandLineOption("osc-address", "Address of the client receiving OSC, OSC is disabled if empty.", "address", ""));
+    parser.addOption(QCommandLineOption("osc-port", "Port of the client receiving OSC.", "port", "6250"));
+    parser.addOption(QCommandLineOption("channels", "Number of channels sending OSC.", "channels", "2"));
+    parser.addOption(QCommandLineOption("layers", "Number of playing layers per channel.", "layers", "10"));
+    parser.addOption(QCommandLineOption("fps", "Frame rate of the OSC stream, 50 or 60.", "fps", "50"));
+    parser.addOption(QCommandLineOption("stream", "MPEG-TS file to play to the client as the preview stream.", "file", ""));
+    parser.addOption(QCommandLineOption("stream-address", "Address of the client receiving the preview stream.", "address", "127.0.0.1"));
+    parser.addOption(QCommandLineOption("stream-port", "Port of the client receiving the preview stream.", "port", "9250"));
+    parser.process(application);
+
+    FakeAmcpServer server;
+    server.setLatency(parser.value("latency").toInt());
+    server.setMediaCount(parser.value("media").toInt());
+    server.setTemplateCount(parser.value("templates").toInt());
+    server.setDataCount(parser.value("data").toInt());
+    server.setThumbnailCount(parser.value("thumbnails").toInt());
+    if (!server.start(parser.value("port").toInt()))
+        return 1;
+
+    OscGenerator generator;
+    if (!parser.value("osc-address").isEmpty())
+    {
+        generator.setChannels(parser.value("channels").toInt());
+        generator.setLayers(parser.value("layers").toInt());
+        generator.setFramesPerSecond(parser.value("fps").toInt());
+        if (!generator.start(parser.value("osc-address"), parser.value("osc-port").toInt()))
+            return 1;
+    }
+
+    TsStreamer streamer;
+    if (!parser.value("stream").isEmpty())
+    {
+        if (!streamer.load(parser.value("stream")))
+            return 1;
+
+        streamer.setTarget(parser.value("stream-address"), parser.value("stream-port").toInt());
+        streamer.start();
+    }
+
+    return application.exec();
+}
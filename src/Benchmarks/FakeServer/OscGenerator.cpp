@@ -0,0 +1,138 @@
+#include "OscGenerator.h"
+
+#include "osc/OscOutboundPacketStream.h"
+#include <ip/UdpSocket.h>
+
+#include <stdexcept>
+
+static const int BUNDLE_SIZE = 60 * 1024; // Stays below the UDP datagram limit.
+static const int LAYER_SIZE = 1024; // Generous upper bound for the messages of one layer.
+
+OscGenerator::OscGenerator(QObject* parent)
+    : QObject(parent), timer(this)
+{
+    this->buffer.resize(BUNDLE_SIZE);
+
+    // Ticks at twice the frame rate, the frames that are due are worked out from the clock.
+    this->timer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(sendFrames()));
+}
+
+OscGenerator::~OscGenerator()
+{
+    stop();
+}
+
+void OscGenerator::setChannels(int channels)
+{
+    this->channels = channels;
+}
+
+void OscGenerator::setLayers(int layers)
+{
+    this->layers = layers;
+}
+
+void OscGenerator::setFramesPerSecond(int fps)
+{
+    this->fps = fps;
+}
+
+qint64 OscGenerator::getMessageCount() const
+{
+    return this->messageCount;
+}
+
+bool OscGenerator::start(const QString& address, int port)
+{
+    stop();
+
+    try
+    {
+        this->socket = new UdpTransmitSocket(IpEndpointName(address.toStdString().c_str(), port));
+    }
+    catch (std::runtime_error& e)
+    {
+        qCritical("Unable to send OSC messages to %s:%d: %s", qPrintable(address), port, e.what());
+        return false;
+    }
+
+    // Clips of different lengths so that layers don't all tick over at the same time.
+    this->state.resize(this->channels * this->layers);
+    for (int i = 0; i < this->state.count(); ++i)
+    {
+        this->state[i].frame = (i * 37) % 250;
+        this->state[i].totalFrames = 250 + (i * 113) % 9000;
+        this->state[i].path = QString("MOVIES/CLIP_%1.mov").arg(i).toUtf8();
+    }
+
+    this->frameCount = 0;
+    this->messageCount = 0;
+    this->clock.start();
+    this->timer.start(qMax(1, 500 / this->fps));
+
+    qDebug("Sending OSC messages for %d channels and %d layers at %d fps to %s:%d", this->channels, this->layers, this->fps, qPrintable(address), port);
+
+    return true;
+}
+
+void OscGenerator::stop()
+{
+    this->timer.stop();
+
+    delete this->socket;
+    this->socket = nullptr;
+}
+
+void OscGenerator::sendFrames()
+{
+    qint64 due = this->clock.elapsed() * this->fps / 1000;
+    for (; this->frameCount < due; ++this->frameCount)
+    {
+        for (int channel = 1; channel <= this->channels; ++channel)
+            sendChannel(channel);
+    }
+}
+
+void OscGenerator::sendChannel(int channel)
+{
+    osc::OutboundPacketStream stream(this->buffer.data(), this->buffer.size());
+    stream << osc::BeginBundleImmediate;
+
+    for (int videolayer = 1; videolayer <= this->layers; ++videolayer)
+    {
+        // Split the bundle rather than overflow the buffer when a channel has many layers.
+        if (stream.Capacity() - stream.Size() < LAYER_SIZE)
+        {
+            stream << osc::EndBundle;
+            this->socket->Send(stream.Data(), stream.Size());
+
+            stream.Clear();
+            stream << osc::BeginBundleImmediate;
+        }
+
+        Layer& layer = this->state[(channel - 1) * this->layers + videolayer - 1];
+        layer.frame = (layer.frame + 1) % layer.totalFrames;
+
+        QByteArray prefix = QString("/channel/%1/stage/layer/%2").arg(channel).arg(videolayer).toUtf8();
+
+        stream << osc::BeginMessage(QByteArray(prefix).append("/file/time").constData())
+               << static_cast<float>(layer.frame / static_cast<double>(this->fps))
+               << static_cast<float>(layer.totalFrames / static_cast<double>(this->fps)) << osc::EndMessage;
+        stream << osc::BeginMessage(QByteArray(prefix).append("/file/frame").constData())
+               << static_cast<osc::int32>(layer.frame) << static_cast<osc::int32>(layer.totalFrames) << osc::EndMessage;
+        stream << osc::BeginMessage(QByteArray(prefix).append("/file/fps").constData())
+               << static_cast<float>(this->fps) << osc::EndMessage;
+        stream << osc::BeginMessage(QByteArray(prefix).append("/file/path").constData())
+               << layer.path.constData() << osc::EndMessage;
+        stream << osc::BeginMessage(QByteArray(prefix).append("/paused").constData())
+               << false << osc::EndMessage;
+        stream << osc::BeginMessage(QByteArray(prefix).append("/loop").constData())
+               << false << osc::EndMessage;
+
+        this->messageCount += 6;
+    }
+
+    stream << osc::EndBundle;
+    this->socket->Send(stream.Data(), stream.Size());
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+class UdpTransmitSocket;
+
+// Sends the per frame layer updates a CasparCG 2.0 server produces while clips are playing,
+// one bundle per channel and frame, to a client listening for OSC over UDP.
+class OscGenerator : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit OscGenerator(QObject* parent = 0);
+        ~OscGenerator();
+
+        void setChannels(int channels);
+        void setLayers(int layers);
+        void setFramesPerSecond(int fps);
+
+        qint64 getMessageCount() const;
+
+        Q_SLOT bool start(const QString& address, int port);
+        Q_SLOT void stop();
+
+    private:
+        struct Layer
+        {
+            int frame;
+            int totalFrames;
+            QByteArray path;
+        };
+
+        int channels = 2;
+        int layers = 10;
+        int fps = 50;
+        qint64 frameCount = 0;
+        qint64 messageCount = 0;
+
+        QTimer timer;
+        QElapsedTimer clock;
+        QVector<Layer> state;
+        QByteArray buffer;
+
+        UdpTransmitSocket* socket = nullptr;
+
+        void sendChannel(int channel);
+
+        Q_SLOT void sendFrames();
+};
@@ -0,0 +1,116 @@
+#include "TsStreamer.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+static const int PACKET_SIZE = 188;
+static const int PACKETS_PER_DATAGRAM = 7;
+
+namespace
+{
+    // PCR of the packet in microseconds, -1 when the packet carries none.
+    qint64 readPcr(const uchar* packet)
+    {
+        if (packet[0] != 0x47 || (packet[3] & 0x20) == 0 || packet[4] < 7 || (packet[5] & 0x10) == 0)
+            return -1;
+
+        qint64 base = (qint64(packet[6]) << 25) | (qint64(packet[7]) << 17) | (qint64(packet[8]) << 9) | (qint64(packet[9]) << 1) | (packet[10] >> 7);
+
+        return base * 100 / 9;
+    }
+}
+
+TsStreamer::TsStreamer(QObject* parent)
+    : QThread(parent)
+{
+    this->stopped.store(0);
+    this->packets.store(0);
+}
+
+TsStreamer::~TsStreamer()
+{
+    stop();
+}
+
+bool TsStreamer::load(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("Unable to open %s", qPrintable(path));
+        return false;
+    }
+
+    this->data = file.readAll();
+    if (this->data.isEmpty() || this->data.at(0) != 0x47)
+    {
+        qWarning("%s is not an MPEG-TS file", qPrintable(path));
+        return false;
+    }
+
+    this->data.truncate(this->data.size() - this->data.size() % PACKET_SIZE);
+
+    return true;
+}
+
+void TsStreamer::setTarget(const QString& address, int port)
+{
+    this->address = address;
+    this->port = port;
+}
+
+qint64 TsStreamer::getPacketCount() const
+{
+    return this->packets.load();
+}
+
+void TsStreamer::stop()
+{
+    this->stopped.store(1);
+
+    QThread::wait();
+}
+
+void TsStreamer::run()
+{
+    this->stopped.store(0);
+    this->packets.store(0);
+
+    QUdpSocket socket;
+    QHostAddress target(this->address);
+
+    QElapsedTimer clock;
+    clock.start();
+
+    qint64 firstPcr = -1;
+    const uchar* packets = reinterpret_cast<const uchar*>(this->data.constData());
+    int count = this->data.size() / PACKET_SIZE;
+
+    for (int i = 0; i < count && this->stopped.load() == 0; i += PACKETS_PER_DATAGRAM)
+    {
+        int chunk = qMin(PACKETS_PER_DATAGRAM, count - i);
+
+        // Hold the datagram back until the stream clock has caught up with its first PCR.
+        for (int j = 0; j < chunk; j++)
+        {
+            qint64 pcr = readPcr(packets + (i + j) * PACKET_SIZE);
+            if (pcr == -1)
+                continue;
+
+            if (firstPcr == -1)
+                firstPcr = pcr;
+
+            qint64 wait = (pcr - firstPcr) - clock.nsecsElapsed() / 1000;
+            if (wait > 0)
+                QThread::usleep(static_cast<unsigned long>(wait));
+
+            break;
+        }
+
+        socket.writeDatagram(reinterpret_cast<const char*>(packets + i * PACKET_SIZE), chunk * PACKET_SIZE, target, this->port);
+        this->packets.fetchAndAddRelaxed(chunk);
+    }
+}
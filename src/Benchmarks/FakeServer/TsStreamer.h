@@ -0,0 +1,36 @@
+#pragma once
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+
+// Plays an MPEG-TS file over UDP in real time, paced by the PCR in the file, the way the ffmpeg
+// consumer of a CasparCG server sends the preview stream.
+class TsStreamer : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit TsStreamer(QObject* parent = 0);
+        ~TsStreamer();
+
+        bool load(const QString& path);
+        void setTarget(const QString& address, int port);
+
+        qint64 getPacketCount() const;
+
+        void stop();
+
+    protected:
+        void run();
+
+    private:
+        QByteArray data;
+        QString address = "127.0.0.1";
+        int port = 9250;
+
+        QAtomicInt stopped;
+        QAtomicInteger<qint64> packets;
+};
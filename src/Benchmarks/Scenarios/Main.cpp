@@ -0,0 +1,668 @@
+#include "StallProbe.h"
+#include "../FakeServer/FakeAmcpServer.h"
+#include "../FakeServer/OscGenerator.h"
+#include "../FakeServer/TsStreamer.h"
+
+#include "Version.h"
+#include "Global.h"
+
+#include "AsyncDatabaseManager.h"
+#include "DatabaseManager.h"
+#include "EventManager.h"
+#include "OscLayerState.h"
+#include "OscStateManager.h"
+
+#include "CasparDevice.h"
+#include "OscListener.h"
+
+#include "Rundown/RundownTreeBaseWidget.h"
+#include "Rundown/RundownTreeWidget.h"
+
+#include "LivePreview.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+#include <QtCore/QXmlStreamWriter>
+
+#include <QtSql/QSqlDatabase>
+
+#include <QtWidgets/QApplication>
+
+#if defined(Q_OS_WIN)
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(Q_OS_MAC)
+    #include <mach/mach.h>
+#endif
+
+static const int TIMEOUT = 60000;
+
+struct Options
+{
+    int port;
+    int oscPort;
+    int latency;
+    int media;
+    int templates;
+    int thumbnails;
+    int items;
+    QStringList rundowns;
+    int iterations;
+    int channels;
+    int layers;
+    int fps;
+    int duration;
+    QString stream;
+    int streamPort;
+};
+
+qint64 getResidentSetSize()
+{
+    // Resident set size in kilobytes, -1 where the platform doesn't tell.
+#if defined(Q_OS_LINUX)
+    QFile file("/proc/self/status");
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return -1;
+
+    foreach (const QByteArray& line, file.readAll().split('\n'))
+    {
+        if (line.startsWith("VmRSS:"))
+            return line.mid(6).trimmed().split(' ').at(0).toLongLong();
+    }
+
+    return -1;
+#elif defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return -1;
+
+    return counters.WorkingSetSize / 1024;
+#elif defined(Q_OS_MAC)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+        return -1;
+
+    return info.resident_size / 1024;
+#else
+    return -1;
+#endif
+}
+
+bool waitUntil(const std::function<bool()>& condition, int timeout = TIMEOUT)
+{
+    // Spins the event loop like the client does, so that the stall probe keeps ticking.
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!condition())
+    {
+        if (timer.elapsed() > timeout)
+            return false;
+
+        QEventLoop loop;
+        QTimer::singleShot(1, &loop, SLOT(quit()));
+        loop.exec();
+    }
+
+    return true;
+}
+
+QJsonObject runScenario(const QString& name, const std::function<bool(QJsonObject&)>& scenario)
+{
+    qDebug("Running scenario %s", qPrintable(name));
+
+    QJsonObject result;
+    result.insert("name", name);
+
+    qint64 rssBefore = getResidentSetSize();
+
+    StallProbe probe;
+    probe.start();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    bool completed = scenario(result);
+
+    qint64 elapsed = timer.nsecsElapsed();
+    probe.stop();
+
+    qint64 rssAfter = getResidentSetSize();
+
+    result.insert("completed", completed);
+    result.insert("wallMs", elapsed / 1000000.0);
+    result.insert("stalls", probe.getReport());
+    result.insert("rssKb", rssAfter);
+    result.insert("rssDeltaKb", (rssBefore == -1 || rssAfter == -1) ? 0 : rssAfter - rssBefore);
+
+    return result;
+}
+
+void writeItem(QXmlStreamWriter& writer, const QString& type, const QString& name, int channel, int videolayer)
+{
+    writer.writeStartElement("item");
+    writer.writeTextElement("type", type);
+    writer.writeTextElement("devicename", "Benchmark");
+    writer.writeTextElement("label", name);
+    writer.writeTextElement("name", name);
+    writer.writeTextElement("channel", QString::number(channel));
+    writer.writeTextElement("videolayer", QString::number(videolayer));
+    writer.writeTextElement("delay", "0");
+    writer.writeTextElement("duration", "0");
+    writer.writeTextElement("allowgpi", "false");
+    writer.writeTextElement("allowremotetriggering", "false");
+    writer.writeTextElement("remotetriggerid", "");
+    writer.writeTextElement("storyid", "");
+    writer.writeEndElement();
+}
+
+bool createRundown(const QString& path, int items)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    // Mostly clips and templates, with a group of five every twenty items.
+    QXmlStreamWriter writer(&file);
+    writer.writeStartDocument();
+    writer.writeStartElement("items");
+    writer.writeTextElement("allowremotetriggering", "false");
+
+    for (int i = 0; i < items; )
+    {
+        if (i % 20 == 19 && i + 5 <= items)
+        {
+            writer.writeStartElement("item");
+            writer.writeTextElement("type", "GROUP");
+            writer.writeTextElement("label", QString("Group %1").arg(i));
+            writer.writeTextElement("expanded", "true");
+            writer.writeStartElement("items");
+            for (int j = 0; j < 5; ++j)
+                writeItem(writer, "MOVIE", QString("MOVIES/CLIP_%1").arg(i + j), 1, 10);
+            writer.writeEndElement();
+            writer.writeEndElement();
+
+            i += 5;
+        }
+        else
+        {
+            if (i % 3 == 2)
+                writeItem(writer, "TEMPLATE", QString("TEMPLATES/LOWER_THIRD_%1").arg(i % 100), 1, 20);
+            else
+                writeItem(writer, "MOVIE", QString("MOVIES/CLIP_%1").arg(i), 1, 10);
+
+            i++;
+        }
+    }
+
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    return true;
+}
+
+bool runLibraryScenario(const Options& options, QJsonObject& result)
+{
+    CasparDevice device("127.0.0.1", options.port);
+    device.connectDevice();
+    if (!waitUntil([&device]() { return device.isConnected(); }))
+        return false;
+
+    int media = 0, templates = 0, data = 0, responses = 0;
+    QObject::connect(&device, &CasparDevice::mediaChanged, [&](const QList<CasparMedia>& items, CasparDevice&) { media = items.count(); responses++; });
+    QObject::connect(&device, &CasparDevice::templateChanged, [&](const QList<CasparTemplate>& items, CasparDevice&) { templates = items.count(); responses++; });
+    QObject::connect(&device, &CasparDevice::dataChanged, [&](const QList<CasparData>& items, CasparDevice&) { data = items.count(); responses++; });
+
+    for (int i = 0; i < options.iterations; ++i)
+    {
+        device.refreshMedia();
+        device.refreshTemplate();
+        device.refreshData();
+
+        if (!waitUntil([&responses, i]() { return responses == (i + 1) * 3; }))
+            return false;
+    }
+
+    result.insert("iterations", options.iterations);
+    result.insert("media", media);
+    result.insert("templates", templates);
+    result.insert("data", data);
+
+    return true;
+}
+
+bool runThumbnailScenario(const Options& options, QJsonObject& result)
+{
+    CasparDevice device("127.0.0.1", options.port);
+    device.connectDevice();
+    if (!waitUntil([&device]() { return device.isConnected(); }))
+        return false;
+
+    QList<CasparThumbnail> thumbnails;
+    bool listed = false;
+    QObject::connect(&device, &CasparDevice::thumbnailChanged, [&](const QList<CasparThumbnail>& items, CasparDevice&) { thumbnails = items; listed = true; });
+
+    int retrieved = 0;
+    qint64 bytes = 0;
+    QObject::connect(&device, &CasparDevice::thumbnailRetrieveChanged, [&](const QString& data, CasparDevice&) { bytes += data.length(); retrieved++; });
+
+    device.refreshThumbnail();
+    if (!waitUntil([&listed]() { return listed; }))
+        return false;
+
+    // One at a time, a thumbnail is only asked for once the previous one arrived.
+    foreach (const CasparThumbnail& thumbnail, thumbnails)
+    {
+        int expected = retrieved + 1;
+        device.retrieveThumbnail(thumbnail.getName());
+        if (!waitUntil([&retrieved, expected]() { return retrieved == expected; }))
+            return false;
+    }
+
+    result.insert("thumbnails", thumbnails.count());
+    result.insert("retrieved", retrieved);
+    result.insert("bytes", bytes);
+
+    return true;
+}
+
+bool runOscScenario(const Options& options, OscGenerator* generator, QJsonObject& result)
+{
+    OscListener listener("0.0.0.0", options.oscPort);
+    listener.start();
+
+    // The state manager is fed directly, the device managers that normally own the listener are not running.
+    QObject::connect(&listener, SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     &OscStateManager::getInstance(), SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+
+    int messages = 0, notifications = 0;
+    QObject::connect(&listener, &OscListener::messageReceived, [&messages](const QString&, const QList<QVariant>&) { messages++; });
+
+    for (int channel = 1; channel <= options.channels; ++channel)
+    {
+        for (int videolayer = 1; videolayer <= options.layers; ++videolayer)
+        {
+            OscLayerState* layerState = OscStateManager::getInstance().getLayerState("127.0.0.1", channel, videolayer);
+            QObject::connect(layerState, &OscLayerState::changed, [&notifications]() { notifications++; });
+        }
+    }
+
+    QMetaObject::invokeMethod(generator, "start", Qt::BlockingQueuedConnection, Q_ARG(QString, "127.0.0.1"), Q_ARG(int, options.oscPort));
+
+    QElapsedTimer timer;
+    timer.start();
+    waitUntil([&timer, &options]() { return timer.elapsed() >= options.duration; }, options.duration + 1000);
+
+    QMetaObject::invokeMethod(generator, "stop", Qt::BlockingQueuedConnection);
+
+    result.insert("channels", options.channels);
+    result.insert("layers", options.layers);
+    result.insert("fps", options.fps);
+    result.insert("sent", generator->getMessageCount());
+    result.insert("received", messages);
+    result.insert("notifications", notifications);
+
+    return true;
+}
+
+QJsonObject loadRundown(RundownTreeWidget& widget, const QString& path, int items)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    widget.openRundown(path);
+
+    // Let the layout and any deferred work settle, it is part of what the operator waits for.
+    waitUntil([]() { return true; });
+
+    RundownTreeBaseWidget* tree = widget.findChild<RundownTreeBaseWidget*>("treeWidgetRundown");
+
+    // A rundown from disk is counted once it is loaded, groups and their children alike.
+    if (items < 0)
+    {
+        items = 0;
+        for (int i = 0; tree != NULL && i < tree->invisibleRootItem()->childCount(); i++)
+            items += 1 + tree->invisibleRootItem()->child(i)->childCount();
+    }
+
+    // Parsing runs on the thread pool, the widgets are built on this thread. Both add up to what the operator waits for.
+    QJsonObject run;
+    run.insert("items", items);
+    run.insert("topLevelItems", (tree == NULL) ? 0 : tree->invisibleRootItem()->childCount());
+    run.insert("parseMs", (tree == NULL) ? -1 : tree->getLastParseTime());
+    run.insert("widgetMs", (tree == NULL) ? -1 : tree->getLastCreateTime());
+    run.insert("openMs", timer.elapsed());
+
+    return run;
+}
+
+bool runRundownScenario(RundownTreeWidget& widget, const QTemporaryDir& directory, const QString& path, const Options& options, QJsonObject& result)
+{
+    // A short show, a typical one and a long one of the same mix. The typical one is opened last, in the
+    // widget the selection scenario walks.
+    QJsonArray runs;
+    QList<int> sizes = QList<int>() << qMax(1, options.items / 10) << options.items * 5;
+    foreach (int items, sizes)
+    {
+        QString sizePath = directory.filePath(QString("Rundown-%1.xml").arg(items));
+        if (!createRundown(sizePath, items))
+            return false;
+
+        RundownTreeWidget sizeWidget;
+        sizeWidget.resize(800, 1000);
+        sizeWidget.show();
+
+        runs.append(loadRundown(sizeWidget, sizePath, items));
+    }
+
+    runs.append(loadRundown(widget, path, options.items));
+
+    // Real shows have a mix of their own, they are loaded the same way.
+    foreach (const QString& file, options.rundowns)
+    {
+        if (!QFile::exists(file))
+        {
+            qWarning("Unable to find rundown %s", qPrintable(file));
+            return false;
+        }
+
+        RundownTreeWidget fileWidget;
+        fileWidget.resize(800, 1000);
+        fileWidget.show();
+
+        QJsonObject run = loadRundown(fileWidget, file, -1);
+        run.insert("file", file);
+
+        runs.append(run);
+    }
+
+    result.insert("rundowns", runs);
+
+    foreach (const QJsonValue& run, runs)
+    {
+        if (run.toObject().value("topLevelItems").toInt() == 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool runSelectionScenario(RundownTreeWidget& widget, QJsonObject& result)
+{
+    RundownTreeBaseWidget* tree = widget.findChild<RundownTreeBaseWidget*>("treeWidgetRundown");
+    if (tree == NULL || tree->invisibleRootItem()->childCount() == 0)
+        return false;
+
+    tree->setCurrentItem(tree->invisibleRootItem()->child(0));
+
+    // Walk the whole rundown the way an operator holding the down arrow would, one repaint per step.
+    int steps = 0;
+    QTreeWidgetItem* previous = NULL;
+    while (tree->currentItem() != previous)
+    {
+        previous = tree->currentItem();
+
+        tree->selectItemBelow();
+        QCoreApplication::processEvents();
+
+        steps++;
+    }
+
+    result.insert("steps", steps);
+
+    return true;
+}
+
+bool runPreviewScenario(const Options& options, QJsonObject& result)
+{
+    if (options.stream.isEmpty())
+    {
+        qWarning("The preview scenario needs an MPEG-TS file with the frame counter, see --stream");
+        return false;
+    }
+
+    TsStreamer streamer;
+    if (!streamer.load(options.stream))
+        return false;
+
+    streamer.setTarget("127.0.0.1", options.streamPort);
+
+    LivePreview preview;
+    if (!preview.start(options.streamPort))
+        return false;
+
+    int frames = 0;
+    qint64 firstFrame = -1;
+    QVector<int> latencies;
+    QElapsedTimer timer;
+    QObject::connect(&preview, &LivePreview::frameReady, [&]()
+    {
+        if (preview.getFrame().isNull())
+            return;
+
+        frames++;
+        if (firstFrame == -1)
+            firstFrame = timer.elapsed();
+
+        if (preview.getLatency() >= 0)
+            latencies.append(preview.getLatency());
+    });
+
+    // Played twice into the same player, the second run is what a source switch looks like to it.
+    QJsonArray runs;
+    for (int i = 0; i < 2; ++i)
+    {
+        frames = 0;
+        firstFrame = -1;
+        latencies.clear();
+
+        preview.resetCounter();
+        timer.start();
+        streamer.start();
+
+        waitUntil([&streamer]() { return streamer.isFinished(); }, 10 * TIMEOUT);
+        waitUntil([]() { return false; }, 500); // Let the jitter buffer drain.
+
+        std::sort(latencies.begin(), latencies.end());
+
+        QJsonObject run;
+        run.insert("packets", streamer.getPacketCount());
+        run.insert("frames", frames);
+        run.insert("firstFrameMs", firstFrame);
+        run.insert("latencyP50Ms", latencies.isEmpty() ? -1 : latencies.at(latencies.count() / 2));
+        run.insert("latencyP95Ms", latencies.isEmpty() ? -1 : latencies.at(latencies.count() * 95 / 100));
+        run.insert("latencyMaxMs", latencies.isEmpty() ? -1 : latencies.last());
+        runs.append(run);
+    }
+
+    preview.stop();
+
+    result.insert("runs", runs);
+    result.insert("droppedFrames", preview.getDroppedFrames());
+
+    return runs.at(0).toObject().value("frames").toInt() > 0 && runs.at(1).toObject().value("frames").toInt() > 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // Runs without a display unless told otherwise.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication application(argc, argv);
+    QApplication::setApplicationName("scenarios");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs scripted client scenarios against a simulated CasparCG server and reports the results as JSON.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("scenarios", "Comma separated scenarios to run: library, thumbnails, osc, rundown, selection, preview.", "scenarios", "library,thumbnails,osc,rundown,selection"));
+    parser.addOption(QCommandLineOption("port", "AMCP port of the simulated server, 0 picks a free port.", "port", "0"));
+    parser.addOption(QCommandLineOption("osc-port", "Port the client listens for OSC on.", "port", "16250"));
+    parser.addOption(QCommandLineOption("latency", "Delay in milliseconds before every AMCP reply.", "latency", "0"));
+    parser.addOption(QCommandLineOption("media", "Number of clips in the CLS listing.", "media", "10000"));
+    parser.addOption(QCommandLineOption("templates", "Number of templates in the TLS listing.", "templates", "1000"));
+    parser.addOption(QCommandLineOption("thumbnails", "Number of thumbnails to sync.", "thumbnails", "500"));
+    parser.addOption(QCommandLineOption("items", "Number of items in the rundown.", "items", "1000"));
+    parser.addOption(QCommandLineOption("rundowns", "Comma separated rundown files the rundown scenario loads after the generated ones.", "files", ""));
+    parser.addOption(QCommandLineOption("iterations", "Number of library refreshes.", "iterations", "5"));
+    parser.addOption(QCommandLineOption("channels", "Number of channels sending OSC.", "channels", "4"));
+    parser.addOption(QCommandLineOption("layers", "Number of playing layers per channel.", "layers", "20"));
+    parser.addOption(QCommandLineOption("fps", "Frame rate of the OSC stream, 50 or 60.", "fps", "50"));
+    parser.addOption(QCommandLineOption("duration", "Length of the OSC scenario in milliseconds.", "duration", "10000"));
+    parser.addOption(QCommandLineOption("stream", QString("MPEG-TS file for the preview scenario, with the frame counter the client asks the server for, i.e. "
+                                                         "ffmpeg -f lavfi -i testsrc2=size=1280x720:rate=50 -t 30 -vf \"%1\" -c:v libx264 -tune zerolatency -preset ultrafast -f mpegts preview.ts")
+                                                         .arg(Stream::COUNTER_FILTER), "file", ""));
+    parser.addOption(QCommandLineOption("stream-port", "Port the preview scenario receives the stream on.", "port", "19250"));
+    parser.addOption(QCommandLineOption("output", "File to write the JSON report to, standard output if empty.", "file", ""));
+    parser.process(application);
+
+    Options options;
+    options.port = parser.value("port").toInt();
+    options.oscPort = parser.value("osc-port").toInt();
+    options.latency = parser.value("latency").toInt();
+    options.media = parser.value("media").toInt();
+    options.templates = parser.value("templates").toInt();
+    options.thumbnails = parser.value("thumbnails").toInt();
+    options.items = parser.value("items").toInt();
+    options.rundowns = parser.value("rundowns").split(",", QString::SkipEmptyParts);
+    options.iterations = parser.value("iterations").toInt();
+    options.channels = parser.value("channels").toInt();
+    options.layers = parser.value("layers").toInt();
+    options.fps = parser.value("fps").toInt();
+    options.duration = parser.value("duration").toInt();
+    options.stream = parser.value("stream");
+    options.streamPort = parser.value("stream-port").toInt();
+
+    QStringList scenarios = parser.value("scenarios").split(",", QString::SkipEmptyParts);
+
+    QTemporaryDir directory;
+    if (!directory.isValid())
+    {
+        qCritical("Unable to create a temporary directory");
+        return 1;
+    }
+
+    // A fresh database for every run, on disk so the database thread is used like in the client.
+    QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE");
+    database.setDatabaseName(directory.filePath("Database.s3db"));
+    if (!database.open())
+    {
+        qCritical("Unable to open database");
+        return 1;
+    }
+
+    DatabaseManager::getInstance().initialize();
+    AsyncDatabaseManager::getInstance().initialize();
+    EventManager::getInstance().initialize();
+
+    // The simulated server runs on threads of its own, just like a real server it never waits for the client.
+    QThread serverThread;
+    FakeAmcpServer* server = new FakeAmcpServer();
+    server->setLatency(options.latency);
+    server->setMediaCount(options.media);
+    server->setTemplateCount(options.templates);
+    server->setDataCount(options.templates);
+    server->setThumbnailCount(options.thumbnails);
+    server->moveToThread(&serverThread);
+    QObject::connect(&serverThread, SIGNAL(finished()), server, SLOT(deleteLater()));
+    serverThread.start();
+
+    bool started = false;
+    QMetaObject::invokeMethod(server, "start", Qt::BlockingQueuedConnection, Q_RETURN_ARG(bool, started), Q_ARG(int, options.port));
+    if (!started)
+        return 1;
+
+    options.port = server->serverPort();
+
+    QThread generatorThread;
+    OscGenerator* generator = new OscGenerator();
+    generator->setChannels(options.channels);
+    generator->setLayers(options.layers);
+    generator->setFramesPerSecond(options.fps);
+    generator->moveToThread(&generatorThread);
+    QObject::connect(&generatorThread, SIGNAL(finished()), generator, SLOT(deleteLater()));
+    generatorThread.start();
+
+    QString rundownPath = directory.filePath("Rundown.xml");
+    createRundown(rundownPath, options.items);
+
+    RundownTreeWidget rundown;
+    rundown.resize(800, 1000);
+    rundown.show();
+
+    QJsonArray results;
+    foreach (const QString& scenario, scenarios)
+    {
+        if (scenario == "library")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runLibraryScenario(options, result); }));
+        else if (scenario == "thumbnails")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runThumbnailScenario(options, result); }));
+        else if (scenario == "osc")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runOscScenario(options, generator, result); }));
+        else if (scenario == "rundown")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runRundownScenario(rundown, directory, rundownPath, options, result); }));
+        else if (scenario == "selection")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runSelectionScenario(rundown, result); }));
+        else if (scenario == "preview")
+            results.append(runScenario(scenario, [&](QJsonObject& result) { return runPreviewScenario(options, result); }));
+        else
+            qWarning("Unknown scenario %s", qPrintable(scenario));
+    }
+
+    QJsonObject report;
+    report.insert("client", QString("%1.%2.%3").arg(MAJOR_VERSION).arg(MINOR_VERSION).arg(REVISION_VERSION));
+    report.insert("build", QString(BUILD_VERSION));
+    report.insert("latencyMs", options.latency);
+    report.insert("scenarios", results);
+
+    QByteArray json = QJsonDocument(report).toJson();
+    if (parser.value("output").isEmpty())
+    {
+        QTextStream out(stdout);
+        out << json;
+    }
+    else
+    {
+        QFile file(parser.value("output"));
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            qCritical("Unable to write %s", qPrintable(parser.value("output")));
+            return 1;
+        }
+
+        file.write(json);
+    }
+
+    serverThread.quit();
+    serverThread.wait();
+    generatorThread.quit();
+    generatorThread.wait();
+
+    EventManager::getInstance().uninitialize();
+    AsyncDatabaseManager::getInstance().uninitialize();
+    DatabaseManager::getInstance().uninitialize();
+
+    foreach (const QJsonValue& result, results)
+    {
+        if (!result.toObject().value("completed").toBool())
+            return 2;
+    }
+
+    return 0;
+}
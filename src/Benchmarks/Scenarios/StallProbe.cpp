@@ -0,0 +1,68 @@
+#include "StallProbe.h"
+
+#include <algorithm>
+
+StallProbe::StallProbe(int interval, QObject* parent)
+    : QObject(parent), interval(interval), timer(this)
+{
+    this->timer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(tick()));
+}
+
+void StallProbe::start()
+{
+    this->stalls.clear();
+    this->clock.start();
+    this->last = 0;
+    this->timer.start(this->interval);
+}
+
+void StallProbe::stop()
+{
+    // The gap since the last tick counts too, the scenario might have ended in the middle of a stall.
+    sample();
+
+    this->timer.stop();
+}
+
+void StallProbe::tick()
+{
+    sample();
+}
+
+void StallProbe::sample()
+{
+    qint64 now = this->clock.nsecsElapsed();
+
+    this->stalls.append(qMax<qint64>(0, now - this->last - this->interval * 1000000LL));
+    this->last = now;
+}
+
+QJsonObject StallProbe::getReport() const
+{
+    QVector<qint64> sorted = this->stalls;
+    std::sort(sorted.begin(), sorted.end());
+
+    auto percentile = [&sorted](double p) -> double
+    {
+        if (sorted.isEmpty())
+            return 0;
+
+        int index = qMin(sorted.count() - 1, static_cast<int>(p * sorted.count()));
+        return sorted.at(index) / 1000000.0;
+    };
+
+    qint64 total = 0;
+    foreach (qint64 stall, sorted)
+        total += stall;
+
+    QJsonObject report;
+    report.insert("samples", sorted.count());
+    report.insert("p50Ms", percentile(0.50));
+    report.insert("p95Ms", percentile(0.95));
+    report.insert("p99Ms", percentile(0.99));
+    report.insert("maxMs", sorted.isEmpty() ? 0 : sorted.last() / 1000000.0);
+    report.insert("totalMs", total / 1000000.0);
+
+    return report;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+// Measures how late a short timer on the GUI thread fires. Anything that blocks the event loop,
+// a slow slot or a synchronous load, shows up as one late tick of the same length.
+class StallProbe : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit StallProbe(int interval = 5, QObject* parent = 0);
+
+        void start();
+        void stop();
+
+        QJsonObject getReport() const;
+
+    private:
+        int interval;
+        qint64 last = 0;
+
+        QTimer timer;
+        QElapsedTimer clock;
+        QVector<qint64> stalls;
+
+        void sample();
+
+        Q_SLOT void tick();
+};
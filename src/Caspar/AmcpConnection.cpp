@@ -0,0 +1,98 @@
+#include "AmcpConnection.h"
+#include "Trace.h"
+
+#include <QtCore/QTimer>
+
+#include <QtNetwork/QTcpSocket>
+
+AmcpConnection::AmcpConnection(const QString& address, int port, AmcpResponseHandler handler, QObject* parent)
+    : QObject(parent), address(address), port(port), handler(handler)
+{
+    this->socket = new QTcpSocket(this);
+
+    // A single timer, restarting it can never leave more than one reconnect pending.
+    this->reconnectTimer = new QTimer(this);
+    this->reconnectTimer->setSingleShot(true);
+    this->reconnectTimer->setInterval(5000);
+
+    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
+    QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
+    QObject::connect(this->socket, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+    QObject::connect(this->reconnectTimer, SIGNAL(timeout()), this, SLOT(reconnectDevice()));
+}
+
+void AmcpConnection::connectDevice()
+{
+    this->stopped = false;
+
+    reconnectDevice();
+}
+
+void AmcpConnection::reconnectDevice()
+{
+    if (this->stopped || this->connected)
+        return;
+
+    if (this->socket->state() == QAbstractSocket::UnconnectedState)
+        this->socket->connectToHost(this->address, this->port);
+
+    this->reconnectTimer->start();
+}
+
+void AmcpConnection::disconnectDevice()
+{
+    this->stopped = true;
+    this->reconnectTimer->stop();
+
+    this->socket->blockSignals(true);
+    this->socket->disconnectFromHost();
+    this->socket->blockSignals(false);
+
+    this->connected = false;
+    this->parser.reset();
+}
+
+void AmcpConnection::setConnected()
+{
+    this->connected = true;
+    this->parser.reset();
+    this->reconnectTimer->stop();
+
+    emit connectionStateChanged(true);
+}
+
+void AmcpConnection::setDisconnected()
+{
+    this->connected = false;
+
+    emit connectionStateChanged(false);
+
+    if (!this->stopped)
+        this->reconnectTimer->start();
+}
+
+void AmcpConnection::writeMessage(const QByteArray& message)
+{
+    if (!this->connected)
+        return;
+
+    this->socket->write(message);
+    this->socket->flush();
+}
+
+void AmcpConnection::readMessage()
+{
+    TRACE_SPAN("amcp", "Parse");
+
+    QList<AmcpResponse> responses;
+    while (this->socket->bytesAvailable())
+        this->parser.parse(this->socket->readAll(), responses);
+
+    foreach (AmcpResponse response, responses)
+    {
+        if (this->handler != nullptr)
+            this->handler(response);
+
+        emit responseReceived(response);
+    }
+}
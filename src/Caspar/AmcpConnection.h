@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "AmcpParser.h"
+#include "AmcpResponse.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+class QTcpSocket;
+class QTimer;
+
+// Called on the network thread for every complete response, before it is handed to the GUI thread.
+typedef void (*AmcpResponseHandler)(AmcpResponse& response);
+
+class CASPAR_EXPORT AmcpConnection : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit AmcpConnection(const QString& address, int port, AmcpResponseHandler handler, QObject* parent = 0);
+
+        Q_SLOT void connectDevice();
+        Q_SLOT void disconnectDevice();
+        Q_SLOT void writeMessage(const QByteArray& message);
+
+        Q_SIGNAL void connectionStateChanged(bool);
+        Q_SIGNAL void responseReceived(const AmcpResponse&);
+
+    private:
+        QString address;
+        int port;
+
+        bool connected = false;
+        bool stopped = true;
+
+        QTcpSocket* socket = nullptr;
+        QTimer* reconnectTimer = nullptr;
+        AmcpParser parser;
+        AmcpResponseHandler handler = nullptr;
+
+        Q_SLOT void reconnectDevice();
+        Q_SLOT void readMessage();
+        Q_SLOT void setConnected();
+        Q_SLOT void setDisconnected();
+};
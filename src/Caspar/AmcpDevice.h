@@ -2,18 +2,20 @@
 
 #include "Shared.h"
 
+#include "AmcpConnection.h"
+#include "AmcpResponse.h"
+
 #include <QtCore/QObject>
 
 class QObject;
-class QTcpSocket;
-class QTextDecoder;
+class QThread;
 
 class CASPAR_EXPORT AmcpDevice : public QObject
 {
     Q_OBJECT
 
     public:
-        explicit AmcpDevice(const QString& address, int port, QObject* parent = 0);
+        explicit AmcpDevice(const QString& address, int port, AmcpResponseHandler handler = nullptr, QObject* parent = 0);
         virtual ~AmcpDevice();
 
         void disconnectDevice();
@@ -27,78 +29,23 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         Q_SLOT void connectDevice();
 
     protected:
-        enum class AmcpDeviceCommand
-        {
-            NONE,
-            CONNECTIONSTATE,
-            LOAD,
-            LOADBG,
-            PLAY,
-            STOP,
-            CG,
-            CLS,
-            CINF,
-            VERSION,
-            TLS,
-            INFO,
-            INFOSYSTEM,
-            DATALIST,
-            DATARETRIEVE,
-            CLEAR,
-            SET,
-            MIXER,
-            CALL,
-            REMOVE,
-            ADD,
-            SWAP,
-            STATUS,
-            ERROR,
-            THUMBNAILLIST,
-            THUMBNAILRETRIEVE
-        };
-
-        QTcpSocket* socket = nullptr;
-        AmcpDeviceCommand command = AmcpDeviceCommand::NONE;
-
-        QList<QString> response;
-
-        virtual void sendNotification() = 0;
-
-        void resetDevice();
+        typedef AmcpResponse::Command AmcpDeviceCommand;
+
+        virtual void sendNotification(const AmcpResponse& response) = 0;
+
         void writeMessage(const QString& message);
 
     private:
-        enum class AmcpDeviceParserState
-        {
-            ExpectingHeader,
-            ExpectingOneline,
-            ExpectingTwoline,
-            ExpectingMultiline
-        };
-
         QString address;
 
         int port;
-        int code;
 
         bool connected = false;
         bool disableCommands = false;
 
-        QString fragments;
-
-        QTextDecoder* decoder = nullptr;
-
-        AmcpDeviceParserState state = AmcpDeviceParserState::ExpectingHeader;
-
-        void parseLine(const QString& line);
-        void parseHeader(const QString& line);
-        void parseOneline(const QString& line);
-        void parseTwoline(const QString& line);
-        void parseMultiline(const QString& line);
-
-        AmcpDeviceCommand translateCommand(const QString& command);
+        QThread* thread = nullptr;
+        AmcpConnection* connection = nullptr;
 
-        Q_SLOT void readMessage();
-        Q_SLOT void setConnected();
-        Q_SLOT void setDisconnected();
+        Q_SLOT void setConnectionState(bool connected);
+        Q_SLOT void receiveResponse(const AmcpResponse& response);
 };
@@ -0,0 +1,241 @@
+#include "AmcpListParser.h"
+
+#include "Timecode.h"
+
+#include <string.h>
+
+QList<CasparMedia> AmcpListParser::parseMedia(const QByteArray& body)
+{
+    // Format:
+    // "AMB"  MOVIE  6445960 20121101160514 643 1/60
+    // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
+    // "HOOLOOVOO"  MOVIE  1111111 22222222222222 333 100/2997
+    QList<CasparMedia> items;
+    items.reserve(countLines(body));
+
+    const char* end = body.constData() + body.size();
+    const char* lineEnd = nullptr;
+    for (const char* position = body.constData(); position < end; )
+    {
+        const char* line = position;
+        position = nextLine(position, end, lineEnd);
+        if (line == lineEnd)
+            continue;
+
+        const char* rest = nullptr;
+        QString name = parseName(line, lineEnd, rest);
+
+        Field fields[MAX_FIELDS];
+        int count = parseFields(rest, lineEnd, fields);
+
+        QString type = (count > 0) ? parseType(fields[0]) : QString();
+
+        // Type, size, timestamp, frames and timebase.
+        QString timecode;
+        if (count >= 5)
+        {
+            const Field& timebase = fields[4];
+            const char* separator = static_cast<const char*>(memchr(timebase.begin, '/', timebase.length));
+            if (separator != nullptr)
+            {
+                Field numerator = { timebase.begin, static_cast<int>(separator - timebase.begin) };
+                Field denominator = { separator + 1, static_cast<int>(timebase.begin + timebase.length - separator - 1) };
+
+                int frames = parseInt(fields[3]);
+                int scale = parseInt(numerator);
+                int rate = parseInt(denominator);
+                if (scale > 0 && rate > 0)
+                {
+                    double fps = static_cast<double>(rate) / scale;
+                    timecode = Timecode::fromTime(frames * (1.0 / fps), fps, false);
+                }
+            }
+        }
+
+        items.push_back(CasparMedia(name, type, timecode));
+    }
+
+    return items;
+}
+
+QList<CasparTemplate> AmcpListParser::parseTemplates(const QByteArray& body)
+{
+    QList<CasparTemplate> items;
+    items.reserve(countLines(body));
+
+    const char* end = body.constData() + body.size();
+    const char* lineEnd = nullptr;
+    for (const char* position = body.constData(); position < end; )
+    {
+        const char* line = position;
+        position = nextLine(position, end, lineEnd);
+        if (line == lineEnd)
+            continue;
+
+        const char* rest = nullptr;
+        items.push_back(CasparTemplate(parseName(line, lineEnd, rest)));
+    }
+
+    return items;
+}
+
+QList<CasparData> AmcpListParser::parseData(const QByteArray& body)
+{
+    QList<CasparData> items;
+    items.reserve(countLines(body));
+
+    const char* end = body.constData() + body.size();
+    const char* lineEnd = nullptr;
+    for (const char* position = body.constData(); position < end; )
+    {
+        const char* line = position;
+        position = nextLine(position, end, lineEnd);
+        if (line == lineEnd)
+            continue;
+
+        const char* rest = nullptr;
+        items.push_back(CasparData(parseName(line, lineEnd, rest)));
+    }
+
+    return items;
+}
+
+QList<CasparThumbnail> AmcpListParser::parseThumbnails(const QByteArray& body)
+{
+    // Format:
+    // "AMB" 20121101T160514 14384
+    QList<CasparThumbnail> items;
+    items.reserve(countLines(body));
+
+    const char* end = body.constData() + body.size();
+    const char* lineEnd = nullptr;
+    for (const char* position = body.constData(); position < end; )
+    {
+        const char* line = position;
+        position = nextLine(position, end, lineEnd);
+        if (line == lineEnd)
+            continue;
+
+        const char* rest = nullptr;
+        QString name = parseName(line, lineEnd, rest);
+
+        Field fields[MAX_FIELDS];
+        int count = parseFields(rest, lineEnd, fields);
+
+        QString timestamp = (count > 0) ? QString::fromLatin1(fields[0].begin, fields[0].length) : QString();
+        QString size = (count > 1) ? QString::fromLatin1(fields[1].begin, fields[1].length) : QString();
+
+        items.push_back(CasparThumbnail(name, timestamp, size));
+    }
+
+    return items;
+}
+
+int AmcpListParser::countLines(const QByteArray& body)
+{
+    return body.count('\n');
+}
+
+const char* AmcpListParser::nextLine(const char* position, const char* end, const char*& lineEnd)
+{
+    const char* newline = static_cast<const char*>(memchr(position, '\n', end - position));
+    if (newline == nullptr)
+        newline = end;
+
+    lineEnd = newline;
+    if (lineEnd > position && lineEnd[-1] == '\r')
+        --lineEnd;
+
+    return (newline < end) ? newline + 1 : end;
+}
+
+QString AmcpListParser::parseName(const char* begin, const char* end, const char*& rest)
+{
+    // The name is everything up to the first quote followed by a space.
+    const char* nameEnd = end;
+    rest = end;
+
+    const char* position = begin;
+    while (position < end)
+    {
+        const char* quote = static_cast<const char*>(memchr(position, '"', end - position));
+        if (quote == nullptr)
+            break;
+
+        if (quote + 1 < end && quote[1] == ' ')
+        {
+            nameEnd = quote;
+            rest = quote + 2;
+            break;
+        }
+
+        position = quote + 1;
+    }
+
+    if (begin < nameEnd && *begin == '"')
+        ++begin;
+
+    if (begin < nameEnd && nameEnd[-1] == '"')
+        --nameEnd;
+
+    QString name = QString::fromUtf8(begin, static_cast<int>(nameEnd - begin));
+    name.replace(QLatin1Char('\\'), QLatin1Char('/'));
+
+    return name;
+}
+
+int AmcpListParser::parseFields(const char* begin, const char* end, Field* fields)
+{
+    int count = 0;
+    const char* position = begin;
+    while (position < end && count < MAX_FIELDS)
+    {
+        while (position < end && *position == ' ')
+            ++position;
+
+        if (position == end)
+            break;
+
+        const char* field = position;
+        while (position < end && *position != ' ')
+            ++position;
+
+        fields[count].begin = field;
+        fields[count].length = static_cast<int>(position - field);
+        ++count;
+    }
+
+    return count;
+}
+
+int AmcpListParser::parseInt(const Field& field)
+{
+    int value = 0;
+    for (int i = 0; i < field.length; ++i)
+    {
+        char digit = field.begin[i];
+        if (digit < '0' || digit > '9')
+            return 0;
+
+        value = value * 10 + (digit - '0');
+    }
+
+    return value;
+}
+
+QString AmcpListParser::parseType(const Field& field)
+{
+    // Share the handful of known types rather than allocating one string per clip.
+    static const QString movie = "MOVIE";
+    static const QString still = "STILL";
+    static const QString audio = "AUDIO";
+
+    if (field.length == 5)
+    {
+        if (memcmp(field.begin, "MOVIE", 5) == 0) return movie;
+        else if (memcmp(field.begin, "STILL", 5) == 0) return still;
+        else if (memcmp(field.begin, "AUDIO", 5) == 0) return audio;
+    }
+
+    return QString::fromLatin1(field.begin, field.length);
+}
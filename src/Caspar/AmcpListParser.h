@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/CasparData.h"
+#include "Models/CasparMedia.h"
+#include "Models/CasparTemplate.h"
+#include "Models/CasparThumbnail.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+// Tokenizes the raw UTF-8 body of CLS, TLS, DATA LIST and THUMBNAIL LIST responses in a single pass.
+// The body is the data lines of the response, each terminated by \r\n.
+class CASPAR_EXPORT AmcpListParser
+{
+    public:
+        static QList<CasparMedia> parseMedia(const QByteArray& body);
+        static QList<CasparTemplate> parseTemplates(const QByteArray& body);
+        static QList<CasparData> parseData(const QByteArray& body);
+        static QList<CasparThumbnail> parseThumbnails(const QByteArray& body);
+
+    private:
+        AmcpListParser() {}
+
+        static const int MAX_FIELDS = 6;
+
+        struct Field
+        {
+            const char* begin;
+            int length;
+        };
+
+        static int countLines(const QByteArray& body);
+        static const char* nextLine(const char* position, const char* end, const char*& lineEnd);
+        static QString parseName(const char* begin, const char* end, const char*& rest);
+        static int parseFields(const char* begin, const char* end, Field* fields);
+        static int parseInt(const Field& field);
+        static QString parseType(const Field& field);
+};
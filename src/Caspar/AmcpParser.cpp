@@ -0,0 +1,176 @@
+#include "AmcpParser.h"
+
+#include <QtCore/QStringList>
+
+AmcpParser::AmcpParser()
+{
+}
+
+void AmcpParser::reset()
+{
+    this->buffer.clear();
+    this->head = 0;
+    this->scan = 0;
+    this->body = -1;
+
+    this->current = AmcpResponse();
+    this->state = AmcpParserState::ExpectingHeader;
+}
+
+void AmcpParser::parse(const QByteArray& data, QList<AmcpResponse>& responses)
+{
+    // Consumed lines are not erased from the front of the buffer one by one. The read position
+    // advances instead and the consumed bytes are reclaimed once they make up half the buffer,
+    // so every byte is moved an amortized constant number of times regardless of the line count.
+    // The body of a listing in progress is kept, it is handed over in one piece when complete.
+    int consumed = (this->body != -1) ? this->body : this->head;
+    if (consumed > 0 && consumed >= this->buffer.size() / 2)
+    {
+        this->buffer.remove(0, consumed);
+        this->scan -= consumed;
+        this->head -= consumed;
+        if (this->body != -1)
+            this->body -= consumed;
+    }
+
+    this->buffer.append(data);
+
+    // Lines are split on the raw bytes, a multibyte UTF-8 sequence can never span two lines.
+    int position;
+    while ((position = this->buffer.indexOf("\r\n", this->scan)) != -1)
+    {
+        int line = this->head;
+
+        this->head = position + 2;
+        this->scan = this->head;
+
+        if (this->body != -1)
+        {
+            // Listing lines are left as raw bytes for AmcpListParser, only look for the terminating empty line.
+            if (position == line)
+            {
+                this->current.setBody(this->buffer.mid(this->body, line - this->body));
+                this->body = -1;
+
+                complete(responses);
+            }
+
+            continue;
+        }
+
+        parseLine(QString::fromUtf8(this->buffer.constData() + line, position - line), responses);
+
+        if (this->state == AmcpParserState::ExpectingMultiline && isListing(this->current.getCommand()))
+            this->body = this->head;
+    }
+
+    // A trailing \r might be the first half of a delimiter that is split between two reads.
+    this->scan = qMax(this->head, this->buffer.size() - 1);
+}
+
+bool AmcpParser::isListing(AmcpResponse::Command command) const
+{
+    return command == AmcpResponse::Command::CLS || command == AmcpResponse::Command::TLS ||
+           command == AmcpResponse::Command::DATALIST || command == AmcpResponse::Command::THUMBNAILLIST;
+}
+
+AmcpResponse::Command AmcpParser::translateCommand(const QString& command) const
+{
+    if (command == "LOAD") return AmcpResponse::Command::LOAD;
+    else if (command == "LOADBG") return AmcpResponse::Command::LOADBG;
+    else if (command == "PLAY") return AmcpResponse::Command::PLAY;
+    else if (command == "STOP") return AmcpResponse::Command::STOP;
+    else if (command == "CG") return AmcpResponse::Command::CG;
+    else if (command == "CLS") return AmcpResponse::Command::CLS;
+    else if (command == "CINF") return AmcpResponse::Command::CINF;
+    else if (command == "VERSION") return AmcpResponse::Command::VERSION;
+    else if (command == "TLS") return AmcpResponse::Command::TLS;
+    else if (command == "INFO") return AmcpResponse::Command::INFO;
+    else if (command == "INFO SYSTEM") return AmcpResponse::Command::INFOSYSTEM;
+    else if (command == "DATA LIST") return AmcpResponse::Command::DATALIST;
+    else if (command == "DATA RETRIEVE") return AmcpResponse::Command::DATARETRIEVE;
+    else if (command == "CLEAR") return AmcpResponse::Command::CLEAR;
+    else if (command == "SET") return AmcpResponse::Command::SET;
+    else if (command == "MIXER") return AmcpResponse::Command::MIXER;
+    else if (command == "CALL") return AmcpResponse::Command::CALL;
+    else if (command == "REMOVE") return AmcpResponse::Command::REMOVE;
+    else if (command == "ADD") return AmcpResponse::Command::ADD;
+    else if (command == "SWAP") return AmcpResponse::Command::SWAP;
+    else if (command == "STATUS") return AmcpResponse::Command::STATUS;
+    else if (command == "ERROR") return AmcpResponse::Command::ERROR;
+    else if (command == "THUMBNAIL LIST") return AmcpResponse::Command::THUMBNAILLIST;
+    else if (command == "THUMBNAIL RETRIEVE") return AmcpResponse::Command::THUMBNAILRETRIEVE;
+
+    return AmcpResponse::Command::NONE;
+}
+
+void AmcpParser::parseLine(const QString& line, QList<AmcpResponse>& responses)
+{
+    switch (this->state)
+    {
+        case AmcpParserState::ExpectingHeader:
+            parseHeader(line, responses);
+            break;
+        case AmcpParserState::ExpectingTwoline:
+            parseTwoline(line, responses);
+            break;
+        case AmcpParserState::ExpectingMultiline:
+            parseMultiline(line, responses);
+            break;
+        default:
+            break;
+    }
+}
+
+void AmcpParser::parseHeader(const QString& line, QList<AmcpResponse>& responses)
+{
+    if (line.length() == 0)
+        return;
+
+    QStringList tokens = line.split(" ");
+
+    int code = tokens.at(0).toInt();
+    this->current.setHeader(code, line);
+
+    switch (code)
+    {
+        case 200: // The command has been executed and several lines of data are being returned.
+            this->state = AmcpParserState::ExpectingMultiline;
+            break;
+        case 201: // The command has been executed and a line of data is being returned.
+        case 400: // Command not understood.
+            this->state = AmcpParserState::ExpectingTwoline;
+            break;
+        default:
+            complete(responses);
+            return;
+    }
+
+    if (tokens.count() > 3)
+        this->current.setCommand(translateCommand(QString("%1 %2").arg(tokens.at(1)).arg(tokens.at(2))));
+    else if (tokens.count() > 1)
+        this->current.setCommand(translateCommand(tokens.at(1)));
+}
+
+void AmcpParser::parseTwoline(const QString& line, QList<AmcpResponse>& responses)
+{
+    this->current.appendLine(line);
+
+    complete(responses);
+}
+
+void AmcpParser::parseMultiline(const QString& line, QList<AmcpResponse>& responses)
+{
+    if (line.length() == 0)
+        complete(responses);
+    else
+        this->current.appendLine(line);
+}
+
+void AmcpParser::complete(QList<AmcpResponse>& responses)
+{
+    responses.append(this->current);
+
+    this->current = AmcpResponse();
+    this->state = AmcpParserState::ExpectingHeader;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "AmcpResponse.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+class CASPAR_EXPORT AmcpParser
+{
+    public:
+        explicit AmcpParser();
+
+        void reset();
+        void parse(const QByteArray& data, QList<AmcpResponse>& responses);
+
+    private:
+        enum class AmcpParserState
+        {
+            ExpectingHeader,
+            ExpectingTwoline,
+            ExpectingMultiline
+        };
+
+        QByteArray buffer;
+        int head = 0;
+        int scan = 0;
+        int body = -1;
+
+        AmcpResponse current;
+        AmcpParserState state = AmcpParserState::ExpectingHeader;
+
+        void parseLine(const QString& line, QList<AmcpResponse>& responses);
+        void parseHeader(const QString& line, QList<AmcpResponse>& responses);
+        void parseTwoline(const QString& line, QList<AmcpResponse>& responses);
+        void parseMultiline(const QString& line, QList<AmcpResponse>& responses);
+        void complete(QList<AmcpResponse>& responses);
+
+        bool isListing(AmcpResponse::Command command) const;
+        AmcpResponse::Command translateCommand(const QString& command) const;
+};
@@ -0,0 +1,92 @@
+#include "AmcpResponse.h"
+
+AmcpResponse::AmcpResponse(Command command, int code, const QString& header)
+    : command(command), code(code), header(header)
+{
+}
+
+AmcpResponse::Command AmcpResponse::getCommand() const
+{
+    return this->command;
+}
+
+int AmcpResponse::getCode() const
+{
+    return this->code;
+}
+
+const QString& AmcpResponse::getHeader() const
+{
+    return this->header;
+}
+
+const QList<QString>& AmcpResponse::getLines() const
+{
+    return this->lines;
+}
+
+const QByteArray& AmcpResponse::getBody() const
+{
+    return this->body;
+}
+
+const QList<CasparMedia>& AmcpResponse::getMedia() const
+{
+    return this->media;
+}
+
+const QList<CasparTemplate>& AmcpResponse::getTemplates() const
+{
+    return this->templates;
+}
+
+const QList<CasparData>& AmcpResponse::getData() const
+{
+    return this->data;
+}
+
+const QList<CasparThumbnail>& AmcpResponse::getThumbnails() const
+{
+    return this->thumbnails;
+}
+
+void AmcpResponse::setCommand(Command command)
+{
+    this->command = command;
+}
+
+void AmcpResponse::setHeader(int code, const QString& header)
+{
+    this->code = code;
+    this->header = header;
+}
+
+void AmcpResponse::appendLine(const QString& line)
+{
+    this->lines.append(line);
+}
+
+void AmcpResponse::setBody(const QByteArray& body)
+{
+    this->body = body;
+}
+
+void AmcpResponse::setMedia(const QList<CasparMedia>& media)
+{
+    this->media = media;
+}
+
+void AmcpResponse::setTemplates(const QList<CasparTemplate>& templates)
+{
+    this->templates = templates;
+}
+
+void AmcpResponse::setData(const QList<CasparData>& data)
+{
+    this->data = data;
+}
+
+void AmcpResponse::setThumbnails(const QList<CasparThumbnail>& thumbnails)
+{
+    this->thumbnails = thumbnails;
+}
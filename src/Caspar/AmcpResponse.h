@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/CasparData.h"
+#include "Models/CasparMedia.h"
+#include "Models/CasparTemplate.h"
+#include "Models/CasparThumbnail.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+#include <QtCore/QString>
+
+class CASPAR_EXPORT AmcpResponse
+{
+    public:
+        enum class Command
+        {
+            NONE,
+            CONNECTIONSTATE,
+            LOAD,
+            LOADBG,
+            PLAY,
+            STOP,
+            CG,
+            CLS,
+            CINF,
+            VERSION,
+            TLS,
+            INFO,
+            INFOSYSTEM,
+            DATALIST,
+            DATARETRIEVE,
+            CLEAR,
+            SET,
+            MIXER,
+            CALL,
+            REMOVE,
+            ADD,
+            SWAP,
+            STATUS,
+            ERROR,
+            THUMBNAILLIST,
+            THUMBNAILRETRIEVE
+        };
+
+        explicit AmcpResponse(Command command = Command::NONE, int code = 0, const QString& header = "");
+
+        Command getCommand() const;
+        int getCode() const;
+        const QString& getHeader() const;
+        const QList<QString>& getLines() const;
+        const QByteArray& getBody() const;
+
+        const QList<CasparMedia>& getMedia() const;
+        const QList<CasparTemplate>& getTemplates() const;
+        const QList<CasparData>& getData() const;
+        const QList<CasparThumbnail>& getThumbnails() const;
+
+        void setCommand(Command command);
+        void setHeader(int code, const QString& header);
+        void appendLine(const QString& line);
+        void setBody(const QByteArray& body);
+
+        void setMedia(const QList<CasparMedia>& media);
+        void setTemplates(const QList<CasparTemplate>& templates);
+        void setData(const QList<CasparData>& data);
+        void setThumbnails(const QList<CasparThumbnail>& thumbnails);
+
+    private:
+        Command command;
+        int code;
+        QString header;
+        QList<QString> lines;
+        QByteArray body;
+
+        QList<CasparMedia> media;
+        QList<CasparTemplate> templates;
+        QList<CasparData> data;
+        QList<CasparThumbnail> thumbnails;
+};
+
+Q_DECLARE_METATYPE(AmcpResponse)
@@ -15,7 +15,11 @@ HEADERS += \
     Models/CasparTemplate.h \
     Models/CasparMedia.h \
     Models/CasparData.h \
-    AmcpDevice.h
+    AmcpDevice.h \
+    AmcpConnection.h \
+    AmcpParser.h \
+    AmcpListParser.h \
+    AmcpResponse.h
 	
 SOURCES += \
     CasparDevice.cpp \
@@ -23,7 +27,11 @@ SOURCES += \
     Models/CasparTemplate.cpp \
     Models/CasparMedia.cpp \
     Models/CasparData.cpp \
-    AmcpDevice.cpp
+    AmcpDevice.cpp \
+    AmcpConnection.cpp \
+    AmcpParser.cpp \
+    AmcpListParser.cpp \
+    AmcpResponse.cpp
 
 DEPENDPATH += $$OUT_PWD/../Common $$PWD/../Common
 INCLUDEPATH += $$OUT_PWD/../Common $$PWD/../Common
@@ -1,6 +1,8 @@
 #include "CasparDevice.h"
 
-#include "Timecode.h"
+#include "AmcpListParser.h"
+
+#include "Global.h"
 
 #include "../Core/DatabaseManager.h"
 
@@ -9,7 +11,7 @@
 #include <QtNetwork/QHostInfo>
 
 CasparDevice::CasparDevice(const QString& address, int port, QObject* parent)
-    : AmcpDevice(address, port, parent)
+    : AmcpDevice(address, port, &CasparDevice::parseResponse, parent)
 {
 }
 
@@ -340,18 +342,24 @@ void CasparDevice::stopFileRecorder(int channel)
     writeMessage(QString("REMOVE %1 FILE").arg(channel));
 }
 
-void CasparDevice::startStream(int channel, int port, int quality, bool key, int width, int height)
+void CasparDevice::startStream(int channel, int port, int quality, bool key, int width, int height, bool counter, int frameRate)
 {
+    QStringList filters;
+    if (key)
+        filters.append("alphaextract");
+
     if (width > 0 && height > 0)
-    {
-        writeMessage(QString("ADD %1 STREAM udp://<client_ip_address>:%2 -format mpegts -vcodec libx264 -crf %3 -tune zerolatency -preset ultrafast -vf %4scale=%5:%6")
-                     .arg(channel).arg(port).arg(quality).arg((key == true) ? "alphaextract," : "").arg(width).arg(height));
-    }
-    else
-    {
-        writeMessage(QString("ADD %1 STREAM udp://<client_ip_address>:%2 -format mpegts -vcodec libx264 -crf %3 -tune zerolatency -preset ultrafast %4")
-                     .arg(channel).arg(port).arg(quality).arg((key == true) ? "-vf alphaextract" : ""));
-    }
+        filters.append(QString("scale=%1:%2").arg(width).arg(height));
+
+    if (frameRate > 0)
+        filters.append(QString("fps=fps=%1").arg(frameRate));
+
+    // The frame counter strip lets the client tell how long a frame took to reach the screen.
+    if (counter)
+        filters.append(Stream::COUNTER_FILTER);
+
+    writeMessage(QString("ADD %1 STREAM udp://<client_ip_address>:%2 -format mpegts -vcodec libx264 -crf %3 -tune zerolatency -preset ultrafast %4")
+                 .arg(channel).arg(port).arg(quality).arg((filters.isEmpty()) ? "" : QString("-vf %1").arg(filters.join(","))).trimmed());
 }
 
 void CasparDevice::stopStream(int channel, int port)
@@ -621,161 +629,88 @@ void CasparDevice::setAnchor(int channel, int videolayer, float positionX, float
                  .arg((defer == true) ? "DEFER" : ""));
 }
 
-void CasparDevice::sendNotification()
+void CasparDevice::parseResponse(AmcpResponse& response)
 {
-    if (AmcpDevice::response.count() > 0)
-        qDebug("Received message from %s:%d: %s\\r\\n", qPrintable(AmcpDevice::getAddress()), AmcpDevice::getPort(), qPrintable(AmcpDevice::response.at(0).trimmed()));
-
-    switch (AmcpDevice::command)
+    switch (response.getCommand())
     {
         case AmcpDevice::AmcpDeviceCommand::CLS:
-        {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 CLS OK.
-
-            QList<CasparMedia> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                QString type = response.split("\" ").at(1).trimmed().split(" ").at(0);
-
-                QString timecode;
-                if (response.split("\" ").at(1).trimmed().split(" ").count() > 5)
-                {
-                    // Format:
-                    // "AMB"  MOVIE  6445960 20121101160514 643 1/60
-                    // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
-                    // "GO1080P25"  MOVIE  16694084 20121101150514 445 1/25
-                    // "WIPE"  MOVIE  1268784 20121101150514 31 1/25
-                    // "HOOLOOVOO"  MOVIE  1111111 22222222222222 333 100/2997
-                    QString totalFrames = response.split("\" ").at(1).trimmed().split(" ").at(4);
-                    QStringList timebase = response.split("\" ").at(1).trimmed().split(" ").at(5).split("/");
-
-                    int frames = totalFrames.toInt();
-                    double fps = timebase.at(1).toDouble() / timebase.at(0).toDouble();
+            response.setMedia(AmcpListParser::parseMedia(response.getBody()));
+            break;
+        case AmcpDevice::AmcpDeviceCommand::TLS:
+            response.setTemplates(AmcpListParser::parseTemplates(response.getBody()));
+            break;
+        case AmcpDevice::AmcpDeviceCommand::DATALIST:
+            response.setData(AmcpListParser::parseData(response.getBody()));
+            break;
+        case AmcpDevice::AmcpDeviceCommand::THUMBNAILLIST:
+            response.setThumbnails(AmcpListParser::parseThumbnails(response.getBody()));
+            break;
+        default:
+            break;
+    }
 
-                    double time = frames * (1.0 / fps);
-                    timecode = Timecode::fromTime(time, fps, false);
-                }
+    // The raw listing is not needed on the GUI thread.
+    response.setBody(QByteArray());
+}
 
-                items.push_back(CasparMedia(name, type, timecode));
-            }
+void CasparDevice::sendNotification(const AmcpResponse& response)
+{
+    if (!response.getHeader().isEmpty())
+        qDebug("Received message from %s:%d: %s\\r\\n", qPrintable(AmcpDevice::getAddress()), AmcpDevice::getPort(), qPrintable(response.getHeader().trimmed()));
 
-            emit mediaChanged(items, *this);
+    switch (response.getCommand())
+    {
+        case AmcpDevice::AmcpDeviceCommand::CLS:
+        {
+            emit responseChanged(response.getHeader(), *this);
+            emit mediaChanged(response.getMedia(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::TLS:
         {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 TLS OK.
-
-            QList<CasparTemplate> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparTemplate(name));
-            }
-
-            emit templateChanged(items, *this);
+            emit responseChanged(response.getHeader(), *this);
+            emit templateChanged(response.getTemplates(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::INFO:
         {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 INFO OK.
-            emit infoChanged(AmcpDevice::response, *this);
+            emit infoChanged(response.getLines(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::INFOSYSTEM:
         {
-            AmcpDevice::response.removeFirst(); // First post is the header, 201 INFO SYSTEM OK.
-
-            emit infoSystemChanged(AmcpDevice::response, *this);
+            emit infoSystemChanged(response.getLines(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::DATALIST:
         {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 DATA LIST OK.
-
-            QList<CasparData> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparData(name));
-            }
-
-            emit dataChanged(items, *this);
+            emit responseChanged(response.getHeader(), *this);
+            emit dataChanged(response.getData(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::THUMBNAILLIST:
         {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 THUMBNAIL LIST OK.
-
-            QList<CasparThumbnail> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                QString timestamp = response.split("\" ").at(1).trimmed().split(" ").at(0);
-                QString size = response.split("\" ").at(1).trimmed().split(" ").at(1);
-
-                items.push_back(CasparThumbnail(name, timestamp, size));
-            }
-
-            emit thumbnailChanged(items, *this);
+            emit responseChanged(response.getHeader(), *this);
+            emit thumbnailChanged(response.getThumbnails(), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::THUMBNAILRETRIEVE:
         {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 THUMBNAIL RETRIEVE OK.
-
-            emit thumbnailRetrieveChanged(AmcpDevice::response.at(0), *this);
+            if (!response.getLines().isEmpty())
+                emit thumbnailRetrieveChanged(response.getLines().at(0), *this);
 
             break;
         }
         case AmcpDevice::AmcpDeviceCommand::VERSION:
         {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 VERSION OK.
-
-            emit versionChanged(AmcpDevice::response.at(0), *this);
+            if (!response.getLines().isEmpty())
+                emit versionChanged(response.getLines().at(0), *this);
 
             break;
         }
@@ -787,11 +722,9 @@ void CasparDevice::sendNotification()
         }
         default:
         {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
+            emit responseChanged(response.getHeader(), *this);
 
             break;
         }
     }
-
-    resetDevice();
 }
@@ -79,7 +79,7 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         void startFileRecorder(int channel, const QString& filename, const QString& codec, const QString& preset, const QString& tune, bool withAlpha);
         void stopFileRecorder(int channel);
 
-        void startStream(int channel, int port, int quality = 23, bool key = false, int width = 0, int height = 0);
+        void startStream(int channel, int port, int quality = 23, bool key = false, int width = 0, int height = 0, bool counter = false, int frameRate = 0);
         void stopStream(int channel, int port);
 
         void playDeviceInput(int channel, int videolayer, int device, const QString& format);
@@ -133,5 +133,8 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         Q_SIGNAL void thumbnailRetrieveChanged(const QString& data, CasparDevice&);
 
     protected:
-        void sendNotification();
+        void sendNotification(const AmcpResponse& response);
+
+    private:
+        static void parseResponse(AmcpResponse& response);
 };
@@ -12,12 +12,16 @@ HEADERS += \
     Shared.h \
     Timecode.h \
     Xml.h \
-    Playout.h
+    Playout.h \
+    Trace.h \
+    StallWatchdog.h
 	
 SOURCES += \
     Timecode.cpp \
     Xml.cpp \
-    Playout.cpp
+    Playout.cpp \
+    Trace.cpp \
+    StallWatchdog.cpp
 
 OTHER_FILES += \
     Version.h.in
@@ -60,6 +60,23 @@ namespace Stream
     static const int DEFAULT_PORT = 9250;
     static const int COMPACT_WIDTH = 288;
     static const int COMPACT_HEIGHT = 162;
+    static const int DEFAULT_NETWORK_CACHE = 200;
+    static const int BUFFER_COUNT = 3;
+    static const int COUNTER_BITS = 16;
+    static const int COUNTER_HEIGHT = 8;
+    static const QString COUNTER_FILTER = QString("split[video][strip];[strip]crop=iw:%1:0:0,geq=lum='if(mod(floor(N/pow(2,floor(X*%2/W))),2),235,16)':cb=128:cr=128[counter];[video][counter]overlay")
+                                              .arg(COUNTER_HEIGHT).arg(COUNTER_BITS);
+}
+
+namespace Multiview
+{
+    static const int MAX_TILES = 16;
+    static const int TILE_WIDTH = 480;
+    static const int TILE_HEIGHT = 270;
+    static const int STATISTICS_INTERVAL = 1000;
+    static const int CPU_BUDGET = 70; // Percent of all cores.
+    static const int DROP_BUDGET = 10; // Percent of the decoded frames.
+    static const int RECOVER_DELAY = 10; // Statistics intervals within budget before stepping back up.
 }
 
 namespace TriCaster
@@ -110,13 +127,6 @@ namespace Osc
     static const int COMPACT_PAUSE_X = 102;
     static const int COMPACT_PAUSE_Y = 0;
     static const QString DEFAULT_TIME = "00:00:00:00";
-    static const QString DEFAULT_TIME_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/time";
-    static const QString DEFAULT_FRAME_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/frame";
-    static const QString DEFAULT_FPS_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/fps";
-    static const QString DEFAULT_PATH_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/path";
-    static const QString DEFAULT_PAUSED_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/paused";
-    static const QString DEFAULT_LOOP_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/loop";
-    static const QString DEFAULT_AUDIO_FILTER = "#IPADDRESS#/channel/#CHANNEL#/mixer/audio/#AUDIOCHANNEL#/dBFS";
     static const QString DEFAULT_STOP_CONTROL_FILTER = "/control/#UID#/stop";
     static const QString DEFAULT_PLAY_CONTROL_FILTER = "/control/#UID#/play";
     static const QString DEFAULT_PLAYNOW_CONTROL_FILTER = "/control/#UID#/playnow";
@@ -154,6 +164,12 @@ namespace Route
     static const int DEFAULT_FROM_VIDEOLAYER = 1;
 }
 
+namespace Gpi
+{
+    static const int DEFAULT_DEBOUNCE_TIME = 10; // Milliseconds.
+    static const int LATENCY_BUCKET_COUNT = 10;
+}
+
 namespace GpiOutput
 {
     static const int DEFAULT_PORT = 0;
@@ -229,6 +245,8 @@ namespace Color
     static const QString DEFAULT_MIXER_COLOR = "Sienna";
     static const QString DEFAULT_TRICASTER_COLOR = "DarkOliveGreen";
     static const QString DEFAULT_ATEM_COLOR = "DarkOliveGreen";
+    static const QString DEFAULT_TALLY_PROGRAM_COLOR = "rgba(210, 0, 0, 255)";
+    static const QString DEFAULT_TALLY_PREVIEW_COLOR = "rgba(0, 170, 0, 255)";
     static const QString DEFAULT_PANASONIC_COLOR = "DarkOliveGreen";
     static const QString DEFAULT_PRODUCER_COLOR = "SeaGreen";
     static const QString DEFAULT_TEMPLATE_COLOR = "OliveDrab";
@@ -252,11 +270,6 @@ namespace Stylesheet
     static const QString DEFAULT_BORDER_COLOR = "42, 42, 42, 255";
 }
 
-namespace TemplateData
-{
-    static const QString DEFAULT_COMPONENT_DATA_XML = "<componentData id=\\\"#KEY\\\"><data id=\\\"text\\\" value=\\\"#VALUE\\\"/></componentData>";
-}
-
 namespace Output
 {
     static const int DEFAULT_CHANNEL = 1;
@@ -351,6 +364,7 @@ namespace Template
     static const bool DEFAULT_USE_UPPERCASE_DATA = false;
     static const bool DEFAULT_TRIGGER_ON_NEXT = false;
     static const bool DEFAULT_SEND_AS_JSON = false;
+    static const bool DEFAULT_UPDATE_CHANGED_ONLY = false;
 }
 
 namespace DeckLinkInput
@@ -384,6 +398,11 @@ namespace FadeToBlack
     static const QString DEFAULT_TRANSITION = "MIX";
 }
 
+namespace Database
+{
+    static const int WRITE_BATCH_INTERVAL = 250;
+}
+
 namespace Library
 {
     static const int TOOLS_PAGE_INDEX = 0;
@@ -393,6 +412,9 @@ namespace Library
     static const int MOVIE_PAGE_INDEX = 4;
     static const int DATA_PAGE_INDEX = 5;
     static const int PRESET_PAGE_INDEX = 6;
+
+    static const int SYNC_INTERVAL = 5000;
+    static const int OWNER_LEASE = 15000;
 }
 
 namespace Print
@@ -474,6 +496,7 @@ namespace Rundown
     static const QString ROUTECHANNEL = "ROUTECHANNEL";
     static const QString ROUTEVIDEOLAYER = "ROUTEVIDEOLAYER";
     static const int MAX_NUMBER_OF_RUNDONWS = 10;
+    static const int HIBERNATE_DELAY = 60000;
     static const QString DEFAULT_NAME = "New Rundown";
     static const QString DEFAULT_AUDIO_NAME = "Audio";
     static const QString DEFAULT_STILL_NAME = "Image";
@@ -491,6 +514,21 @@ namespace Rundown
     static const int COMPACT_THUMBNAIL_WIDTH = 28;
     static const int COMPACT_THUMBNAIL_HEIGHT = 16;
     static const int GROUP_INDENTION = 65;
+    static const int JOURNAL_MERGE_INTERVAL = 1000; // Edits of one item within a second are a single undo step.
+    static const int JOURNAL_CACHE_SIZE = 1024 * 1024;
+    static const int JOURNAL_COMPACT_ENTRIES = 250;
+}
+
+namespace AudioMeter
+{
+    static const int MAX_SERVERS = 8;
+    static const int MAX_CHANNELS = 8;
+    static const int MAX_AUDIO_CHANNELS = 32;
+    static const int REFRESH_INTERVAL = 40; // 25 fps.
+    static const int STALE_TIMEOUT = 500;
+    static const int PEAK_HOLD_TIME = 1500;
+    static const float DECAY_RATE = 20.0f; // dB per second.
+    static const float MINIMUM_LEVEL = -60.0f;
 }
 
 namespace Panel
@@ -0,0 +1,81 @@
+#include "StallWatchdog.h"
+#include "Trace.h"
+
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+
+StallWatchdog::StallWatchdog(int threshold, QObject* parent)
+    : QThread(parent), threshold(threshold), heartbeatTimer(this), watchedThread(QThread::currentThread())
+{
+    QThread::setObjectName("Watchdog");
+
+    this->clock.start();
+    this->heartbeat.store(0);
+
+    this->heartbeatTimer.setInterval(qMax(1, this->threshold / 4));
+    QObject::connect(&this->heartbeatTimer, SIGNAL(timeout()), this, SLOT(beat()));
+    this->heartbeatTimer.start();
+
+    QThread::start(QThread::HighPriority);
+
+    qDebug("Watching the GUI thread for stalls longer than %d msec", this->threshold);
+}
+
+StallWatchdog::~StallWatchdog()
+{
+    stop();
+}
+
+void StallWatchdog::stop()
+{
+    this->heartbeatTimer.stop();
+
+    {
+        QMutexLocker locker(&this->mutex);
+        this->stopped = true;
+        this->condition.wakeAll();
+    }
+
+    QThread::wait();
+}
+
+void StallWatchdog::beat()
+{
+    qint64 now = this->clock.elapsed();
+    qint64 last = this->heartbeat.fetchAndStoreOrdered(now);
+
+    // The stall is over, its full length is only known here.
+    qint64 stall = now - last - this->heartbeatTimer.interval();
+    if (stall > this->threshold)
+    {
+        qWarning("GUI thread was stalled for %lld msec", stall);
+        Trace::complete("watchdog", "Stall", Trace::now() - stall * 1000, stall * 1000);
+    }
+}
+
+void StallWatchdog::run()
+{
+    qint64 reported = -1;
+
+    QMutexLocker locker(&this->mutex);
+    while (!this->stopped)
+    {
+        this->condition.wait(&this->mutex, qMax(1, this->threshold / 2));
+        if (this->stopped)
+            break;
+
+        qint64 last = this->heartbeat.load();
+        qint64 lag = this->clock.elapsed() - last;
+        if (lag <= this->threshold || last == reported)
+            continue;
+
+        // Report once per stall, while the GUI thread is still stuck, so the span stack shows where.
+        reported = last;
+
+        QStringList stack = Trace::getStack(this->watchedThread);
+        if (stack.isEmpty())
+            qWarning("GUI thread stalled for %lld msec outside of any trace span", lag);
+        else
+            qWarning("GUI thread stalled for %lld msec in: %s", lag, qPrintable(stack.join(" > ")));
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+#include <QtCore/QWaitCondition>
+
+// Watches the GUI thread from a thread of its own. A timer on the GUI thread keeps a heartbeat,
+// when it falls behind by more than the threshold the trace spans the GUI thread is stuck in are logged.
+class COMMON_EXPORT StallWatchdog : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit StallWatchdog(int threshold, QObject* parent = 0);
+        ~StallWatchdog();
+
+        void stop();
+
+    protected:
+        void run();
+
+    private:
+        int threshold;
+        bool stopped = false;
+
+        QElapsedTimer clock;
+        QAtomicInteger<qint64> heartbeat;
+
+        QTimer heartbeatTimer;
+        QThread* watchedThread;
+
+        QMutex mutex;
+        QWaitCondition condition;
+
+        Q_SLOT void beat();
+};
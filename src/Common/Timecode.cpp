@@ -20,15 +20,34 @@ QString Timecode::fromTime(double time, double fps, bool useDropFrameNotation)
     int seconds;
     int frames;
 
-    QString smpteFormat;
-
     hour = (int)(time / 3600);
     minutes = (int)((time - hour * 3600) / 60);
     seconds = (int)(time - hour * 3600 - minutes * 60);
     frames = (int)((time - hour * 3600 - minutes * 60 - seconds) * fps);
 
-    if (useDropFrameNotation)
-        return smpteFormat.sprintf("%02d:%02d:%02d.%02d", hour, minutes, seconds, frames);
-    else
-        return smpteFormat.sprintf("%02d:%02d:%02d:%02d", hour, minutes, seconds, frames);
+    // Formatted by hand, this is called once per clip when parsing large media listings.
+    QString smpteFormat;
+    smpteFormat.reserve(11);
+
+    appendTwoDigits(smpteFormat, hour);
+    smpteFormat.append(QLatin1Char(':'));
+    appendTwoDigits(smpteFormat, minutes);
+    smpteFormat.append(QLatin1Char(':'));
+    appendTwoDigits(smpteFormat, seconds);
+    smpteFormat.append(QLatin1Char((useDropFrameNotation == true) ? '.' : ':'));
+    appendTwoDigits(smpteFormat, frames);
+
+    return smpteFormat;
+}
+
+void Timecode::appendTwoDigits(QString& result, int value)
+{
+    if (value < 0 || value > 99)
+    {
+        result.append(QString::number(value).rightJustified(2, QLatin1Char('0')));
+        return;
+    }
+
+    result.append(QLatin1Char('0' + value / 10));
+    result.append(QLatin1Char('0' + value % 10));
 }
@@ -13,4 +13,6 @@ class COMMON_EXPORT Timecode
 
     private:
         Timecode() {}
+
+        static void appendTwoDigits(QString& result, int value);
 };
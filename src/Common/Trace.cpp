@@ -0,0 +1,229 @@
+#include "Trace.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtCore/QThreadStorage>
+#include <QtCore/QVector>
+
+static const int MAX_EVENTS = 2000000; // Roughly 100 MB, enough for a long evening on air.
+
+namespace
+{
+    struct Span
+    {
+        const char* category;
+        const char* name;
+        qint64 start;
+    };
+
+    struct Event
+    {
+        const char* category;
+        const char* name;
+        qint64 start;
+        qint64 duration;
+        int thread;
+    };
+
+    struct ThreadState
+    {
+        int id;
+        QString name;
+
+        // Guards the stack, it is read by the watchdog while the owning thread is stalled.
+        QMutex mutex;
+        QVector<Span> stack;
+    };
+
+    bool recording = false;
+    QElapsedTimer clock;
+
+    QMutex stateMutex;
+    QHash<QThread*, QSharedPointer<ThreadState>> states;
+    QThreadStorage<QSharedPointer<ThreadState>> currentState;
+
+    QMutex eventMutex;
+    QVector<Event> events;
+    int droppedEvents = 0;
+
+    ThreadState* getCurrentState()
+    {
+        if (!currentState.hasLocalData())
+        {
+            QSharedPointer<ThreadState> state(new ThreadState());
+
+            QThread* thread = QThread::currentThread();
+            if (QCoreApplication::instance() != nullptr && thread == QCoreApplication::instance()->thread())
+                state->name = "GUI";
+            else
+                state->name = thread->objectName();
+
+            QMutexLocker locker(&stateMutex);
+
+            state->id = states.count() + 1;
+            if (state->name.isEmpty())
+                state->name = QString("Thread %1").arg(state->id);
+
+            states.insert(thread, state);
+            currentState.setLocalData(state);
+        }
+
+        return currentState.localData().data();
+    }
+
+    void append(const char* category, const char* name, qint64 start, qint64 duration, int thread)
+    {
+        QMutexLocker locker(&eventMutex);
+
+        if (events.count() >= MAX_EVENTS)
+        {
+            droppedEvents++;
+            return;
+        }
+
+        Event event = { category, name, start, duration, thread };
+        events.append(event);
+    }
+
+    QString escape(const char* value)
+    {
+        QString escaped = QString::fromUtf8(value);
+        escaped.replace("\\", "\\\\");
+        escaped.replace("\"", "\\\"");
+
+        return escaped;
+    }
+}
+
+bool Trace::enabled = false;
+
+void Trace::enable(bool record)
+{
+    clock.start();
+
+    recording = record;
+    Trace::enabled = true;
+
+    qDebug("Tracing enabled%s", (record == true) ? ", recording spans" : "");
+}
+
+qint64 Trace::now()
+{
+    return clock.nsecsElapsed() / 1000;
+}
+
+void Trace::begin(const char* category, const char* name)
+{
+    ThreadState* state = getCurrentState();
+
+    Span span = { category, name, now() };
+
+    QMutexLocker locker(&state->mutex);
+    state->stack.append(span);
+}
+
+void Trace::end()
+{
+    ThreadState* state = getCurrentState();
+
+    Span span;
+    {
+        QMutexLocker locker(&state->mutex);
+        if (state->stack.isEmpty())
+            return;
+
+        span = state->stack.takeLast();
+    }
+
+    if (recording)
+        append(span.category, span.name, span.start, now() - span.start, state->id);
+}
+
+void Trace::complete(const char* category, const char* name, qint64 start, qint64 duration)
+{
+    if (!Trace::enabled || !recording)
+        return;
+
+    append(category, name, start, duration, getCurrentState()->id);
+}
+
+QStringList Trace::getStack(QThread* thread)
+{
+    QSharedPointer<ThreadState> state;
+    {
+        QMutexLocker locker(&stateMutex);
+        state = states.value(thread);
+    }
+
+    QStringList stack;
+    if (state.isNull())
+        return stack;
+
+    qint64 time = now();
+
+    QMutexLocker locker(&state->mutex);
+    foreach (const Span& span, state->stack)
+        stack.append(QString("%1 (%2 msec)").arg(span.name).arg((time - span.start) / 1000));
+
+    return stack;
+}
+
+bool Trace::write(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("Unable to write trace to %s", qPrintable(path));
+        return false;
+    }
+
+    QVector<Event> recorded;
+    int dropped;
+    {
+        QMutexLocker locker(&eventMutex);
+        recorded = events;
+        dropped = droppedEvents;
+    }
+
+    qint64 pid = QCoreApplication::applicationPid();
+
+    // Written by hand, a QJsonDocument of a couple of million events would need several times the memory.
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+    stream << "{\"traceEvents\":[\n";
+
+    bool first = true;
+    {
+        QMutexLocker locker(&stateMutex);
+        foreach (const QSharedPointer<ThreadState>& state, states)
+        {
+            stream << ((first) ? "" : ",\n")
+                   << QString("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%1,\"tid\":%2,\"args\":{\"name\":\"%3\"}}")
+                      .arg(pid).arg(state->id).arg(escape(state->name.toUtf8().constData()));
+            first = false;
+        }
+    }
+
+    foreach (const Event& event, recorded)
+    {
+        stream << ((first) ? "" : ",\n")
+               << "{\"ph\":\"X\",\"cat\":\"" << event.category << "\",\"name\":\"" << escape(event.name)
+               << "\",\"pid\":" << pid << ",\"tid\":" << event.thread
+               << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+        first = false;
+    }
+
+    stream << "\n],\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+    stream.flush();
+
+    qDebug("Wrote %d trace events to %s", recorded.count(), qPrintable(path));
+
+    return true;
+}
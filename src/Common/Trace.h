@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+class QThread;
+
+// Scoped trace spans around the hot paths of the client. Spans are only recorded once tracing is
+// enabled, until then a span is a single branch. Recorded spans are written in the Chrome trace
+// event format and can be opened in chrome://tracing or Perfetto.
+class COMMON_EXPORT Trace
+{
+    public:
+        static bool isEnabled() { return Trace::enabled; }
+
+        static void enable(bool record);
+        static bool write(const QString& path);
+
+        static void begin(const char* category, const char* name);
+        static void end();
+        static void complete(const char* category, const char* name, qint64 start, qint64 duration);
+
+        static qint64 now();
+        static QStringList getStack(QThread* thread);
+
+    private:
+        Trace() {}
+
+        static bool enabled;
+};
+
+class TraceSpan
+{
+    public:
+        TraceSpan(const char* category, const char* name)
+            : active(Trace::isEnabled())
+        {
+            if (this->active)
+                Trace::begin(category, name);
+        }
+
+        ~TraceSpan()
+        {
+            if (this->active)
+                Trace::end();
+        }
+
+    private:
+        bool active;
+
+        Q_DISABLE_COPY(TraceSpan)
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SPAN(category, name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(category, name)
+#define TRACE_FUNCTION(category) TRACE_SPAN(category, Q_FUNC_INFO)
@@ -0,0 +1,106 @@
+#include "AsyncDatabaseManager.h"
+#include "DatabaseManager.h"
+#include "Trace.h"
+
+#include "Global.h"
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QMutexLocker>
+
+Q_GLOBAL_STATIC(AsyncDatabaseManager, asyncDatabaseManager)
+
+AsyncDatabaseManager::AsyncDatabaseManager()
+{
+}
+
+AsyncDatabaseManager& AsyncDatabaseManager::getInstance()
+{
+    return *asyncDatabaseManager();
+}
+
+void AsyncDatabaseManager::initialize()
+{
+    this->threaded = DatabaseManager::getInstance().supportsThreadedAccess();
+
+    // A single thread that never expires, the database connection it opens is bound to it.
+    this->pool.setMaxThreadCount(1);
+    this->pool.setExpiryTimeout(-1);
+
+    // Lives on the GUI thread, writers on any thread start it through the event loop.
+    this->flushTimer = new QTimer();
+    this->flushTimer->setSingleShot(true);
+    this->flushTimer->setInterval(Database::WRITE_BATCH_INTERVAL);
+    QObject::connect(this->flushTimer, &QTimer::timeout, [this]()
+    {
+        QtConcurrent::run(&this->pool, this, &AsyncDatabaseManager::flushWrites);
+    });
+
+    if (!this->threaded)
+        qDebug("Database does not support access from other threads, database queries will run on the GUI thread");
+}
+
+void AsyncDatabaseManager::uninitialize()
+{
+    if (this->flushTimer != NULL)
+    {
+        this->flushTimer->stop();
+        delete this->flushTimer;
+        this->flushTimer = NULL;
+    }
+
+    if (!this->threaded)
+        return;
+
+    QtConcurrent::run(&this->pool, this, &AsyncDatabaseManager::flushWrites);
+    QtConcurrent::run(&this->pool, this, &AsyncDatabaseManager::closeConnection);
+
+    this->pool.waitForDone();
+}
+
+void AsyncDatabaseManager::write(const std::function<void()>& statement)
+{
+    if (!this->threaded)
+    {
+        statement();
+        return;
+    }
+
+    QMutexLocker locker(&this->writeMutex);
+
+    this->pendingWrites.append(statement);
+    if (this->flushScheduled)
+        return;
+
+    // The first write of a batch opens the window, everything that arrives before it closes is one commit.
+    this->flushScheduled = true;
+    QMetaObject::invokeMethod(this->flushTimer, "start", Qt::QueuedConnection);
+}
+
+void AsyncDatabaseManager::flushWrites()
+{
+    TRACE_SPAN("database", "Flush writes");
+
+    QList<std::function<void()>> statements;
+    {
+        QMutexLocker locker(&this->writeMutex);
+
+        statements.swap(this->pendingWrites);
+        this->flushScheduled = false;
+    }
+
+    if (statements.isEmpty())
+        return;
+
+    // Everything written since the last flush is committed in one transaction.
+    DatabaseManager::getInstance().beginTransaction();
+
+    foreach (const std::function<void()>& statement, statements)
+        statement();
+
+    DatabaseManager::getInstance().commitTransaction();
+}
+
+void AsyncDatabaseManager::closeConnection()
+{
+    DatabaseManager::getInstance().closeThreadConnection();
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <functional>
+
+#include <QtCore/QFuture>
+#include <QtCore/QFutureInterface>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+// Runs DatabaseManager calls on a dedicated database thread with a connection of its own,
+// so that slow backends such as a remote MySQL server never block the GUI thread. Writes are
+// collected for a short while and committed together.
+class CORE_EXPORT AsyncDatabaseManager
+{
+    public:
+        explicit AsyncDatabaseManager();
+
+        static AsyncDatabaseManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        template <typename T>
+        QFuture<T> read(const std::function<T()>& query);
+
+        template <typename T>
+        void read(const std::function<T()>& query, QObject* context, const std::function<void(const T&)>& callback);
+
+        void write(const std::function<void()>& statement);
+
+    private:
+        bool threaded = false;
+        QThreadPool pool;
+
+        QMutex writeMutex;
+        bool flushScheduled = false;
+        QList<std::function<void()>> pendingWrites;
+        QTimer* flushTimer = NULL;
+
+        void flushWrites();
+        void closeConnection();
+};
+
+template <typename T>
+QFuture<T> AsyncDatabaseManager::read(const std::function<T()>& query)
+{
+    if (this->threaded)
+        return QtConcurrent::run(&this->pool, query);
+
+    // Without a database thread the query runs right away, the result is still handed out through a future.
+    QFutureInterface<T> future;
+    future.reportStarted();
+    future.reportResult(query());
+    future.reportFinished();
+
+    return future.future();
+}
+
+template <typename T>
+void AsyncDatabaseManager::read(const std::function<T()>& query, QObject* context, const std::function<void(const T&)>& callback)
+{
+    // The watcher is owned by the context, a result that arrives after the context is gone is dropped.
+    QFutureWatcher<T>* watcher = new QFutureWatcher<T>(context);
+    QObject::connect(watcher, &QFutureWatcherBase::finished, context, [watcher, callback]()
+    {
+        callback(watcher->result());
+        watcher->deleteLater();
+    });
+
+    watcher->setFuture(read(query));
+}
@@ -0,0 +1,238 @@
+#include "AudioMeterManager.h"
+#include "OscDeviceManager.h"
+#include "OscWebSocketManager.h"
+
+#include <QtCore/QtGlobal>
+
+#include <QtNetwork/QHostAddress>
+
+#include <stdlib.h>
+#include <string.h>
+
+Q_GLOBAL_STATIC(AudioMeterManager, audioMeterManager)
+
+namespace
+{
+    // Parses the number in front of the next '/' and moves past it, 0 when there is none.
+    int parseIndex(const char*& path)
+    {
+        char* end = NULL;
+        long value = strtol(path, &end, 10);
+        if (end == path || *end != '/')
+            return 0;
+
+        path = end + 1;
+        return static_cast<int>(value);
+    }
+
+    bool readFloat(const osc::ReceivedMessage& message, float& value)
+    {
+        if (message.ArgumentCount() == 0)
+            return false;
+
+        const osc::ReceivedMessageArgument& argument = *message.ArgumentsBegin();
+        if (argument.IsFloat())
+            value = argument.AsFloat();
+        else if (argument.IsDouble())
+            value = static_cast<float>(argument.AsDouble());
+        else if (argument.IsInt32())
+            value = static_cast<float>(argument.AsInt32());
+        else if (argument.IsInt64())
+            value = static_cast<float>(argument.AsInt64());
+        else
+            return false;
+
+        return true;
+    }
+}
+
+AudioMeterManager::AudioMeterManager()
+{
+    this->clock.start();
+
+    for (int i = 0; i < AudioMeter::MAX_SERVERS; i++)
+    {
+        this->servers[i].address.store(0);
+
+        for (int j = 0; j < AudioMeter::MAX_CHANNELS; j++)
+        {
+            ChannelState& channel = this->servers[i].channels[j];
+            channel.audioChannels.store(0);
+
+            for (int k = 0; k < AudioMeter::MAX_AUDIO_CHANNELS; k++)
+            {
+                MeterState& meter = channel.meters[k];
+                meter.level.store(qRound(AudioMeter::MINIMUM_LEVEL * 100));
+                meter.peak.store(qRound(AudioMeter::MINIMUM_LEVEL * 100));
+                meter.updated.store(-1);
+                meter.holdUntil.store(0);
+            }
+        }
+    }
+}
+
+AudioMeterManager& AudioMeterManager::getInstance()
+{
+    return *audioMeterManager();
+}
+
+void AudioMeterManager::initialize()
+{
+    OscDeviceManager::getInstance().getOscListener()->setMessageHandler(this);
+    OscWebSocketManager::getInstance().getOscWebSocketListener()->setMessageHandler(this);
+}
+
+void AudioMeterManager::uninitialize()
+{
+    OscDeviceManager::getInstance().getOscListener()->setMessageHandler(nullptr);
+    OscWebSocketManager::getInstance().getOscWebSocketListener()->setMessageHandler(nullptr);
+}
+
+AudioMeterManager::ServerState* AudioMeterManager::findServer(quint32 address, bool create)
+{
+    for (int i = 0; i < AudioMeter::MAX_SERVERS; i++)
+    {
+        quint32 current = this->servers[i].address.load();
+        if (current == address)
+            return &this->servers[i];
+
+        // Claim the first free slot. Both listeners may race for it, the loser checks what the winner stored.
+        if (current == 0 && create)
+        {
+            if (this->servers[i].address.testAndSetOrdered(0, address) || this->servers[i].address.load() == address)
+                return &this->servers[i];
+        }
+    }
+
+    return NULL;
+}
+
+const AudioMeterManager::ServerState* AudioMeterManager::findServer(quint32 address) const
+{
+    for (int i = 0; i < AudioMeter::MAX_SERVERS; i++)
+    {
+        if (this->servers[i].address.load() == address)
+            return &this->servers[i];
+    }
+
+    return NULL;
+}
+
+bool AudioMeterManager::handleMessage(quint32 address, const osc::ReceivedMessage& message)
+{
+    // Format: /channel/<channel>/mixer/audio/<audiochannel>/dBFS or /channel/<channel>/mixer/audio/nb_channels
+    const char* path = message.AddressPattern();
+    if (strncmp(path, "/channel/", 9) != 0)
+        return false;
+
+    path += 9;
+    int channel = parseIndex(path);
+    if (channel == 0 || strncmp(path, "mixer/audio/", 12) != 0)
+        return false;
+
+    path += 12;
+    if (channel < 1 || channel > AudioMeter::MAX_CHANNELS)
+        return false;
+
+    // Only the dBFS stream is consumed, it is the one that would flood the batches. Anything else, the
+    // channel count included, is noted and passed on for the subscriptions.
+    float value;
+    if (strcmp(path, "nb_channels") == 0)
+    {
+        ServerState* server = (readFloat(message, value)) ? findServer(address, true) : NULL;
+        if (server != NULL)
+            server->channels[channel - 1].audioChannels.store(qBound(0, static_cast<int>(value), static_cast<int>(AudioMeter::MAX_AUDIO_CHANNELS)));
+
+        return false;
+    }
+
+    int audioChannel = parseIndex(path);
+    if (audioChannel == 0 || strcmp(path, "dBFS") != 0)
+        return false;
+
+    if (audioChannel < 1 || audioChannel > AudioMeter::MAX_AUDIO_CHANNELS || !readFloat(message, value))
+        return false;
+
+    ServerState* server = findServer(address, true);
+    if (server == NULL)
+        return false;
+
+    ChannelState& state = server->channels[channel - 1];
+    if (state.audioChannels.load() < audioChannel)
+        state.audioChannels.store(audioChannel); // Older servers never send nb_channels.
+
+    updateMeter(state.meters[audioChannel - 1], value);
+
+    return true;
+}
+
+void AudioMeterManager::updateMeter(MeterState& meter, float level)
+{
+    qint64 now = this->clock.elapsed();
+    level = qBound(AudioMeter::MINIMUM_LEVEL, level, 0.0f);
+
+    // The last update doubles as the start of the decay, none yet counts from the start of the clock.
+    qint64 time = qMax(Q_INT64_C(0), meter.updated.load());
+    qint64 holdUntil = meter.holdUntil.load();
+
+    // Instant attack, the level then falls back at a fixed rate.
+    float elapsed = (now - time) / 1000.0f;
+    float current = qMax(AudioMeter::MINIMUM_LEVEL, meter.level.load() / 100.0f - AudioMeter::DECAY_RATE * elapsed);
+    current = qMax(current, level);
+
+    // The peak holds for a while before it falls at the same rate.
+    float peak = meter.peak.load() / 100.0f;
+    if (level >= peak)
+    {
+        peak = level;
+        meter.holdUntil.store(now + AudioMeter::PEAK_HOLD_TIME);
+    }
+    else if (now > holdUntil)
+    {
+        float decay = AudioMeter::DECAY_RATE * (now - qMax(holdUntil, time)) / 1000.0f;
+        peak = qMax(current, peak - decay);
+    }
+
+    meter.level.store(qRound(current * 100));
+    meter.peak.store(qRound(peak * 100));
+    meter.updated.storeRelease(now);
+}
+
+int AudioMeterManager::readMeters(const QString& address, int channel, QVector<Meter>& meters) const
+{
+    meters.clear();
+
+    if (channel < 1 || channel > AudioMeter::MAX_CHANNELS)
+        return 0;
+
+    const ServerState* server = findServer(QHostAddress(address).toIPv4Address());
+    if (server == NULL)
+        return 0;
+
+    const ChannelState& state = server->channels[channel - 1];
+    int count = state.audioChannels.load();
+
+    qint64 now = this->clock.elapsed();
+    for (int i = 0; i < count; i++)
+    {
+        const MeterState& meter = state.meters[i];
+
+        Meter value = { AudioMeter::MINIMUM_LEVEL, AudioMeter::MINIMUM_LEVEL };
+
+        // A meter that stopped updating, i.e. the channel was removed or the server went away, drops to the floor.
+        qint64 updated = meter.updated.loadAcquire();
+        if (updated >= 0 && now - updated < AudioMeter::STALE_TIMEOUT)
+        {
+            value.level = meter.level.load() / 100.0f;
+            value.peak = meter.peak.load() / 100.0f;
+
+            // Between messages the decay continues here, without writing anything back.
+            float elapsed = (now - updated) / 1000.0f;
+            value.level = qMax(AudioMeter::MINIMUM_LEVEL, value.level - AudioMeter::DECAY_RATE * elapsed);
+        }
+
+        meters.append(value);
+    }
+
+    return count;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Global.h"
+
+#include "OscMessageHandler.h"
+
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+// Audio levels from /channel/N/mixer/audio/... for every server, channel and audio channel.
+// The UDP socket thread, or the GUI thread for WebSocket clients, folds each dBFS message into the
+// level and peak right away, so the meters never see the listener's batching. The GUI thread reads the latest values at its own pace.
+class CORE_EXPORT AudioMeterManager : public OscMessageHandler
+{
+    public:
+        struct Meter
+        {
+            float level;
+            float peak;
+        };
+
+        explicit AudioMeterManager();
+
+        static AudioMeterManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        int readMeters(const QString& address, int channel, QVector<Meter>& meters) const;
+
+        bool handleMessage(quint32 address, const osc::ReceivedMessage& message);
+
+    private:
+        struct MeterState
+        {
+            // Written by the listeners only, both of them, in hundredths of a dB. Times are clock milliseconds,
+            // 64 bit so they don't wrap with the uptime.
+            QAtomicInt level;
+            QAtomicInt peak;
+            QAtomicInteger<qint64> updated;
+            QAtomicInteger<qint64> holdUntil;
+        };
+
+        struct ChannelState
+        {
+            QAtomicInt audioChannels;
+            MeterState meters[AudioMeter::MAX_AUDIO_CHANNELS];
+        };
+
+        struct ServerState
+        {
+            QAtomicInteger<quint32> address;
+            ChannelState channels[AudioMeter::MAX_CHANNELS];
+        };
+
+        QElapsedTimer clock;
+        ServerState servers[AudioMeter::MAX_SERVERS];
+
+        ServerState* findServer(quint32 address, bool create);
+        const ServerState* findServer(quint32 address) const;
+
+        void updateMeter(MeterState& meter, float level);
+};
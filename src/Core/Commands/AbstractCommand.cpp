@@ -1,5 +1,6 @@
 #include "AbstractCommand.h"
 
+#include <QtCore/QMetaMethod>
 #include <QtCore/QXmlStreamWriter>
 
 AbstractCommand::AbstractCommand(QObject* parent)
@@ -99,6 +100,18 @@ void AbstractCommand::setStoryId(const QString& storyId)
     emit storyIdChanged(this->storyId);
 }
 
+void AbstractCommand::copyProperties(const AbstractCommand* command)
+{
+    setChannel(command->getChannel());
+    setVideolayer(command->getVideolayer());
+    setDelay(command->getDelay());
+    setDuration(command->getDuration());
+    setAllowGpi(command->getAllowGpi());
+    setAllowRemoteTriggering(command->getAllowRemoteTriggering());
+    setRemoteTriggerId(command->getRemoteTriggerId());
+    setStoryId(command->getStoryId());
+}
+
 void AbstractCommand::readProperties(boost::property_tree::wptree& pt)
 {
     setChannel(pt.get(L"channel", Output::DEFAULT_CHANNEL));
@@ -122,3 +135,38 @@ void AbstractCommand::writeProperties(QXmlStreamWriter* writer)
     writer->writeTextElement("remotetriggerid", getRemoteTriggerId());
     writer->writeTextElement("storyid", getStoryId());
 }
+
+bool AbstractCommand::isDirty() const
+{
+    return this->dirty;
+}
+
+void AbstractCommand::setDirty(bool dirty)
+{
+    this->dirty = dirty;
+}
+
+void AbstractCommand::trackChanges()
+{
+    if (this->tracking)
+        return;
+
+    // Needs the complete class, so it can't be done from our constructor. Every setter emits a signal named
+    // after its property, any of them means the command was edited.
+    QMetaMethod slot = staticMetaObject.method(staticMetaObject.indexOfSlot("propertyChanged()"));
+    for (int i = QObject::staticMetaObject.methodCount(); i < metaObject()->methodCount(); i++)
+    {
+        QMetaMethod method = metaObject()->method(i);
+        if (method.methodType() == QMetaMethod::Signal && method.name().endsWith("Changed"))
+            QObject::connect(this, method, this, slot);
+    }
+
+    this->tracking = true;
+}
+
+void AbstractCommand::propertyChanged()
+{
+    this->dirty = true;
+
+    emit changed();
+}
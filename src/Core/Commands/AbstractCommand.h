@@ -38,9 +38,17 @@ class CORE_EXPORT AbstractCommand : public QObject, public AbstractProperties
         virtual void setRemoteTriggerId(const QString& remoteTriggerId);
         virtual void setStoryId(const QString& storyId);
 
+        virtual AbstractCommand* clone() const = 0;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
+        bool isDirty() const;
+        void setDirty(bool dirty);
+        void trackChanges();
+
+        Q_SIGNAL void changed();
+
     protected:
         explicit AbstractCommand(QObject* parent = 0);
 
@@ -56,6 +64,11 @@ class CORE_EXPORT AbstractCommand : public QObject, public AbstractProperties
 
 
     private:
+        bool dirty = false;
+        bool tracking = false;
+
+        Q_SLOT void propertyChanged();
+
         Q_SIGNAL void channelChanged(int);
         Q_SIGNAL void videolayerChanged(int);
         Q_SIGNAL void delayChanged(int);
@@ -7,6 +7,30 @@ AnchorCommand::AnchorCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AnchorCommand::clone() const
+{
+    AnchorCommand* command = new AnchorCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AnchorCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AnchorCommand* source = dynamic_cast<const AnchorCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setPositionX(source->getPositionX());
+    setPositionY(source->getPositionY());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setDefer(source->getDefer());
+}
+
 float AnchorCommand::getPositionX() const
 {
     return this->positionX;
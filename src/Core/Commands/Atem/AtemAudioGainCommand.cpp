@@ -7,6 +7,27 @@ AtemAudioGainCommand::AtemAudioGainCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemAudioGainCommand::clone() const
+{
+    AtemAudioGainCommand* command = new AtemAudioGainCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemAudioGainCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemAudioGainCommand* source = dynamic_cast<const AtemAudioGainCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setInput(source->getInput());
+    setGain(source->getGain());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AtemAudioGainCommand::getInput() const
 {
     return this->input;
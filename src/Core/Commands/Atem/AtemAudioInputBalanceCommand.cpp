@@ -7,6 +7,27 @@ AtemAudioInputBalanceCommand::AtemAudioInputBalanceCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemAudioInputBalanceCommand::clone() const
+{
+    AtemAudioInputBalanceCommand* command = new AtemAudioInputBalanceCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemAudioInputBalanceCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemAudioInputBalanceCommand* source = dynamic_cast<const AtemAudioInputBalanceCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setInput(source->getInput());
+    setBalance(source->getBalance());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AtemAudioInputBalanceCommand::getInput() const
 {
     return this->input;
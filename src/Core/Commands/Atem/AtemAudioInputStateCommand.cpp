@@ -7,6 +7,27 @@ AtemAudioInputStateCommand::AtemAudioInputStateCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemAudioInputStateCommand::clone() const
+{
+    AtemAudioInputStateCommand* command = new AtemAudioInputStateCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemAudioInputStateCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemAudioInputStateCommand* source = dynamic_cast<const AtemAudioInputStateCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setInput(source->getInput());
+    setState(source->getState());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AtemAudioInputStateCommand::getInput() const
 {
     return this->input;
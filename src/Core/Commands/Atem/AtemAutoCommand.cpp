@@ -7,6 +7,29 @@ AtemAutoCommand::AtemAutoCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemAutoCommand::clone() const
+{
+    AtemAutoCommand* command = new AtemAutoCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemAutoCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemAutoCommand* source = dynamic_cast<const AtemAutoCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setStep(source->getStep());
+    setSpeed(source->getSpeed());
+    setTransition(source->getTransition());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setMixerStep(source->getMixerStep());
+}
+
 const QString& AtemAutoCommand::getStep() const
 {
     return this->step;
@@ -7,6 +7,27 @@ AtemCutCommand::AtemCutCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemCutCommand::clone() const
+{
+    AtemCutCommand* command = new AtemCutCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemCutCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemCutCommand* source = dynamic_cast<const AtemCutCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setStep(source->getStep());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setMixerStep(source->getMixerStep());
+}
+
 const QString& AtemCutCommand::getStep() const
 {
     return this->step;
@@ -7,6 +7,27 @@ AtemFadeToBlackCommand::AtemFadeToBlackCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemFadeToBlackCommand::clone() const
+{
+    AtemFadeToBlackCommand* command = new AtemFadeToBlackCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemFadeToBlackCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemFadeToBlackCommand* source = dynamic_cast<const AtemFadeToBlackCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setTriggerOnNext(source->getTriggerOnNext());
+    setMixerStep(source->getMixerStep());
+    setSpeed(source->getSpeed());
+}
+
 bool AtemFadeToBlackCommand::getTriggerOnNext() const
 {
     return this->triggerOnNext;
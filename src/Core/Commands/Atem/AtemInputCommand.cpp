@@ -7,6 +7,28 @@ AtemInputCommand::AtemInputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemInputCommand::clone() const
+{
+    AtemInputCommand* command = new AtemInputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemInputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemInputCommand* source = dynamic_cast<const AtemInputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setSwitcher(source->getSwitcher());
+    setInput(source->getInput());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setMixerStep(source->getMixerStep());
+}
+
 const QString& AtemInputCommand::getSwitcher() const
 {
     return this->switcher;
@@ -7,6 +7,28 @@ AtemKeyerStateCommand::AtemKeyerStateCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemKeyerStateCommand::clone() const
+{
+    AtemKeyerStateCommand* command = new AtemKeyerStateCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemKeyerStateCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemKeyerStateCommand* source = dynamic_cast<const AtemKeyerStateCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setKeyer(source->getKeyer());
+    setState(source->getState());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setMixerStep(source->getMixerStep());
+}
+
 const QString& AtemKeyerStateCommand::getMixerStep() const
 {
     return this->mixerStep;
@@ -7,6 +7,26 @@ AtemMacroCommand::AtemMacroCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemMacroCommand::clone() const
+{
+    AtemMacroCommand* command = new AtemMacroCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemMacroCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemMacroCommand* source = dynamic_cast<const AtemMacroCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setMacro(source->getMacro());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AtemMacroCommand::getMacro() const
 {
     return this->macro;
@@ -7,6 +7,26 @@ AtemVideoFormatCommand::AtemVideoFormatCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AtemVideoFormatCommand::clone() const
+{
+    AtemVideoFormatCommand* command = new AtemVideoFormatCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AtemVideoFormatCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AtemVideoFormatCommand* source = dynamic_cast<const AtemVideoFormatCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setFormat(source->getFormat());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AtemVideoFormatCommand::getFormat() const
 {
     return this->format;
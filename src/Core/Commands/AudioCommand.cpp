@@ -8,6 +8,32 @@ AudioCommand::AudioCommand(QObject* parent)
     this->videolayer = Output::DEFAULT_AUDIO_VIDEOLAYER;
 }
 
+AbstractCommand* AudioCommand::clone() const
+{
+    AudioCommand* command = new AudioCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AudioCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AudioCommand* source = dynamic_cast<const AudioCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setAudioName(source->getAudioName());
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setLoop(source->getLoop());
+    setUseAuto(source->getUseAuto());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AudioCommand::getAudioName() const
 {
     return this->audioName;
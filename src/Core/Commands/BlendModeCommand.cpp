@@ -7,6 +7,25 @@ BlendModeCommand::BlendModeCommand(QObject* parent)
 {
 }
 
+AbstractCommand* BlendModeCommand::clone() const
+{
+    BlendModeCommand* command = new BlendModeCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void BlendModeCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const BlendModeCommand* source = dynamic_cast<const BlendModeCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setBlendMode(source->getBlendMode());
+}
+
 const QString& BlendModeCommand::getBlendMode() const
 {
     return this->blendMode;
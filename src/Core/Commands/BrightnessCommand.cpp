@@ -7,6 +7,28 @@ BrightnessCommand::BrightnessCommand(QObject* parent)
 {
 }
 
+AbstractCommand* BrightnessCommand::clone() const
+{
+    BrightnessCommand* command = new BrightnessCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void BrightnessCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const BrightnessCommand* source = dynamic_cast<const BrightnessCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setBrightness(source->getBrightness());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float BrightnessCommand::getBrightness() const
 {
     return this->brightness;
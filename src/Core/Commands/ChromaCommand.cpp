@@ -7,6 +7,28 @@ ChromaCommand::ChromaCommand(QObject* parent)
 {
 }
 
+AbstractCommand* ChromaCommand::clone() const
+{
+    ChromaCommand* command = new ChromaCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void ChromaCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const ChromaCommand* source = dynamic_cast<const ChromaCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setKey(source->getKey());
+    setThreshold(source->getThreshold());
+    setSpread(source->getSpread());
+    setSpill(source->getSpill());
+}
+
 const QString& ChromaCommand::getKey() const
 {
     return this->key;
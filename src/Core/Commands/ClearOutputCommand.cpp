@@ -7,6 +7,26 @@ ClearOutputCommand::ClearOutputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* ClearOutputCommand::clone() const
+{
+    ClearOutputCommand* command = new ClearOutputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void ClearOutputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const ClearOutputCommand* source = dynamic_cast<const ClearOutputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setClearChannel(source->getClearChannel());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 bool ClearOutputCommand::getClearChannel() const
 {
     return this->clearChannel;
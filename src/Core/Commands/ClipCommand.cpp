@@ -7,6 +7,31 @@ ClipCommand::ClipCommand(QObject* parent)
 {
 }
 
+AbstractCommand* ClipCommand::clone() const
+{
+    ClipCommand* command = new ClipCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void ClipCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const ClipCommand* source = dynamic_cast<const ClipCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setLeft(source->getLeft());
+    setWidth(source->getWidth());
+    setTop(source->getTop());
+    setHeight(source->getHeight());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float ClipCommand::getLeft() const
 {
     return this->left;
@@ -4,3 +4,11 @@ CommitCommand::CommitCommand(QObject* parent)
     : AbstractCommand(parent)
 {
 }
+
+AbstractCommand* CommitCommand::clone() const
+{
+    CommitCommand* command = new CommitCommand();
+    command->copyProperties(this);
+
+    return command;
+}
@@ -11,4 +11,6 @@ class CORE_EXPORT CommitCommand : public AbstractCommand
 
     public:
         explicit CommitCommand(QObject* parent = 0);
+
+        virtual AbstractCommand* clone() const;
 };
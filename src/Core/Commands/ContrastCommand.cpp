@@ -7,6 +7,28 @@ ContrastCommand::ContrastCommand(QObject* parent)
 {
 }
 
+AbstractCommand* ContrastCommand::clone() const
+{
+    ContrastCommand* command = new ContrastCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void ContrastCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const ContrastCommand* source = dynamic_cast<const ContrastCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setContrast(source->getContrast());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float ContrastCommand::getContrast() const
 {
     return this->contrast;
@@ -7,6 +7,31 @@ CropCommand::CropCommand(QObject* parent)
 {
 }
 
+AbstractCommand* CropCommand::clone() const
+{
+    CropCommand* command = new CropCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void CropCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const CropCommand* source = dynamic_cast<const CropCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setLeft(source->getLeft());
+    setTop(source->getTop());
+    setRight(source->getRight());
+    setBottom(source->getBottom());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float CropCommand::getLeft() const
 {
     return this->left;
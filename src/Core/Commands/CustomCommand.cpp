@@ -7,6 +7,36 @@ CustomCommand::CustomCommand(QObject* parent)
 {
 }
 
+AbstractCommand* CustomCommand::clone() const
+{
+    CustomCommand* command = new CustomCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void CustomCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const CustomCommand* source = dynamic_cast<const CustomCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setStopCommand(source->getStopCommand());
+    setPlayCommand(source->getPlayCommand());
+    setLoadCommand(source->getLoadCommand());
+    setPauseCommand(source->getPauseCommand());
+    setNextCommand(source->getNextCommand());
+    setUpdateCommand(source->getUpdateCommand());
+    setInvokeCommand(source->getInvokeCommand());
+    setPreviewCommand(source->getPreviewCommand());
+    setClearCommand(source->getClearCommand());
+    setClearVideolayerCommand(source->getClearVideolayerCommand());
+    setClearChannelCommand(source->getClearChannelCommand());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& CustomCommand::getStopCommand() const
 {
     return this->stopCommand;
@@ -7,6 +7,30 @@ DeckLinkInputCommand::DeckLinkInputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* DeckLinkInputCommand::clone() const
+{
+    DeckLinkInputCommand* command = new DeckLinkInputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void DeckLinkInputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const DeckLinkInputCommand* source = dynamic_cast<const DeckLinkInputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setDevice(source->getDevice());
+    setFormat(source->getFormat());
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+}
+
 int DeckLinkInputCommand::getDevice() const
 {
     return this->device;
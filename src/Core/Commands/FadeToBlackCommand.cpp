@@ -8,6 +8,30 @@ FadeToBlackCommand::FadeToBlackCommand(QObject* parent)
     this->videolayer = Output::DEFAULT_FLASH_VIDEOLAYER;
 }
 
+AbstractCommand* FadeToBlackCommand::clone() const
+{
+    FadeToBlackCommand* command = new FadeToBlackCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void FadeToBlackCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const FadeToBlackCommand* source = dynamic_cast<const FadeToBlackCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setUseAuto(source->getUseAuto());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& FadeToBlackCommand::getColor() const
 {
     return this->color;
@@ -7,6 +7,29 @@ FileRecorderCommand::FileRecorderCommand(QObject* parent)
 {
 }
 
+AbstractCommand* FileRecorderCommand::clone() const
+{
+    FileRecorderCommand* command = new FileRecorderCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void FileRecorderCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const FileRecorderCommand* source = dynamic_cast<const FileRecorderCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setOutput(source->getOutput());
+    setCodec(source->getCodec());
+    setPreset(source->getPreset());
+    setTune(source->getTune());
+    setWithAlpha(source->getWithAlpha());
+}
+
 const QString& FileRecorderCommand::getOutput() const
 {
     return this->output;
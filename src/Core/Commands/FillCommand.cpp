@@ -7,6 +7,33 @@ FillCommand::FillCommand(QObject* parent)
 {
 }
 
+AbstractCommand* FillCommand::clone() const
+{
+    FillCommand* command = new FillCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void FillCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const FillCommand* source = dynamic_cast<const FillCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setPositionX(source->getPositionX());
+    setPositionY(source->getPositionY());
+    setScaleX(source->getScaleX());
+    setScaleY(source->getScaleY());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setDefer(source->getDefer());
+    setUseMipmap(source->getUseMipmap());
+}
+
 float FillCommand::getPositionX() const
 {
     return this->positionX;
@@ -7,6 +7,26 @@ GpiOutputCommand::GpiOutputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* GpiOutputCommand::clone() const
+{
+    GpiOutputCommand* command = new GpiOutputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void GpiOutputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const GpiOutputCommand* source = dynamic_cast<const GpiOutputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setGpoPort(source->getGpoPort());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 int GpiOutputCommand::getGpoPort() const
 {
     return this->gpoPort;
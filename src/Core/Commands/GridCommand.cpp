@@ -7,6 +7,28 @@ GridCommand::GridCommand(QObject* parent)
 {
 }
 
+AbstractCommand* GridCommand::clone() const
+{
+    GridCommand* command = new GridCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void GridCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const GridCommand* source = dynamic_cast<const GridCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setGrid(source->getGrid());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 int GridCommand::getGrid() const
 {
     return this->grid;
@@ -7,6 +7,27 @@ GroupCommand::GroupCommand(QObject* parent)
 {
 }
 
+AbstractCommand* GroupCommand::clone() const
+{
+    GroupCommand* command = new GroupCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void GroupCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const GroupCommand* source = dynamic_cast<const GroupCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setNotes(source->getNotes());
+    setAutoStep(source->getAutoStep());
+    setAutoPlay(source->getAutoPlay());
+}
+
 bool GroupCommand::getAutoStep() const
 {
     return this->autoStep;
@@ -7,6 +7,32 @@ HtmlCommand::HtmlCommand(QObject* parent)
 {
 }
 
+AbstractCommand* HtmlCommand::clone() const
+{
+    HtmlCommand* command = new HtmlCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void HtmlCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const HtmlCommand* source = dynamic_cast<const HtmlCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setTransition(source->getTransition());
+    setUrl(source->getUrl());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setFreezeOnLoad(source->getFreezeOnLoad());
+    setUseAuto(source->getUseAuto());
+}
+
 const QString& HtmlCommand::getUrl() const
 {
     return this->url;
@@ -7,6 +7,27 @@ HttpGetCommand::HttpGetCommand(QObject* parent)
 {
 }
 
+AbstractCommand* HttpGetCommand::clone() const
+{
+    HttpGetCommand* command = new HttpGetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void HttpGetCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const HttpGetCommand* source = dynamic_cast<const HttpGetCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setUrl(source->getUrl());
+    setHttpDataModels(source->getHttpDataModels());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& HttpGetCommand::getUrl() const
 {
     return this->url;
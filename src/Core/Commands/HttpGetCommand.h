@@ -23,6 +23,8 @@ class CORE_EXPORT HttpGetCommand : public AbstractCommand
     public:
         explicit HttpGetCommand(QObject* parent = 0);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
@@ -7,6 +7,27 @@ HttpPostCommand::HttpPostCommand(QObject* parent)
 {
 }
 
+AbstractCommand* HttpPostCommand::clone() const
+{
+    HttpPostCommand* command = new HttpPostCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void HttpPostCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const HttpPostCommand* source = dynamic_cast<const HttpPostCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setUrl(source->getUrl());
+    setHttpDataModels(source->getHttpDataModels());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& HttpPostCommand::getUrl() const
 {
     return this->url;
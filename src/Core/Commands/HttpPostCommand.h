@@ -23,6 +23,8 @@ class CORE_EXPORT HttpPostCommand : public AbstractCommand
     public:
         explicit HttpPostCommand(QObject* parent = 0);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
@@ -7,6 +7,29 @@ ImageScrollerCommand::ImageScrollerCommand(QObject* parent)
 {
 }
 
+AbstractCommand* ImageScrollerCommand::clone() const
+{
+    ImageScrollerCommand* command = new ImageScrollerCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void ImageScrollerCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const ImageScrollerCommand* source = dynamic_cast<const ImageScrollerCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setImageScrollerName(source->getImageScrollerName());
+    setBlur(source->getBlur());
+    setSpeed(source->getSpeed());
+    setPremultiply(source->getPremultiply());
+    setProgressive(source->getProgressive());
+}
+
 int ImageScrollerCommand::getBlur() const
 {
     return this->blur;
@@ -7,6 +7,25 @@ KeyerCommand::KeyerCommand(QObject* parent)
 {
 }
 
+AbstractCommand* KeyerCommand::clone() const
+{
+    KeyerCommand* command = new KeyerCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void KeyerCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const KeyerCommand* source = dynamic_cast<const KeyerCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setDefer(source->getDefer());
+}
+
 bool KeyerCommand::getDefer() const
 {
     return this->defer;
@@ -24,6 +24,8 @@ class CORE_EXPORT KeyerCommand : public AbstractCommand
         bool getDefer() const;
         void setDefer(bool defer);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
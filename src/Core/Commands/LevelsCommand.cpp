@@ -7,6 +7,32 @@ LevelsCommand::LevelsCommand(QObject* parent)
 {
 }
 
+AbstractCommand* LevelsCommand::clone() const
+{
+    LevelsCommand* command = new LevelsCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void LevelsCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const LevelsCommand* source = dynamic_cast<const LevelsCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setMinIn(source->getMinIn());
+    setMaxIn(source->getMaxIn());
+    setMinOut(source->getMinOut());
+    setMaxOut(source->getMaxOut());
+    setGamma(source->getGamma());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float LevelsCommand::getMinIn() const
 {
     return this->minIn;
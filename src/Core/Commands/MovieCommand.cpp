@@ -7,6 +7,35 @@ MovieCommand::MovieCommand(QObject* parent)
 {
 }
 
+AbstractCommand* MovieCommand::clone() const
+{
+    MovieCommand* command = new MovieCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void MovieCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const MovieCommand* source = dynamic_cast<const MovieCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setVideoName(source->getVideoName());
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setLoop(source->getLoop());
+    setSeek(source->getSeek());
+    setLength(source->getLength());
+    setFreezeOnLoad(source->getFreezeOnLoad());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setAutoPlay(source->getAutoPlay());
+}
+
 const QString& MovieCommand::getVideoName() const
 {
     return this->videoName;
@@ -7,6 +7,29 @@ OpacityCommand::OpacityCommand(QObject* parent)
 {
 }
 
+AbstractCommand* OpacityCommand::clone() const
+{
+    OpacityCommand* command = new OpacityCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void OpacityCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const OpacityCommand* source = dynamic_cast<const OpacityCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setOpacity(source->getOpacity());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setDefer(source->getDefer());
+}
+
 float OpacityCommand::getOpacity() const
 {
     return this->opacity;
@@ -21,6 +21,8 @@ class CORE_EXPORT OpacityCommand : public AbstractCommand
     public:
         explicit OpacityCommand(QObject* parent = 0);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
@@ -7,6 +7,30 @@ OscOutputCommand::OscOutputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* OscOutputCommand::clone() const
+{
+    OscOutputCommand* command = new OscOutputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void OscOutputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const OscOutputCommand* source = dynamic_cast<const OscOutputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setOutput(source->getOutput());
+    setPath(source->getPath());
+    setMessage(source->getMessage());
+    setType(source->getType());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setUseBundle(source->getUseBundle());
+}
+
 const QString& OscOutputCommand::getOutput() const
 {
     return this->output;
@@ -7,6 +7,27 @@ PanasonicPresetCommand::PanasonicPresetCommand(QObject* parent)
 {
 }
 
+AbstractCommand* PanasonicPresetCommand::clone() const
+{
+    PanasonicPresetCommand* command = new PanasonicPresetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void PanasonicPresetCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const PanasonicPresetCommand* source = dynamic_cast<const PanasonicPresetCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setAddress(source->getAddress());
+    setPreset(source->getPreset());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& PanasonicPresetCommand::getAddress() const
 {
     return this->address;
@@ -7,6 +7,37 @@ PerspectiveCommand::PerspectiveCommand(QObject* parent)
 {
 }
 
+AbstractCommand* PerspectiveCommand::clone() const
+{
+    PerspectiveCommand* command = new PerspectiveCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void PerspectiveCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const PerspectiveCommand* source = dynamic_cast<const PerspectiveCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setUpperLeftX(source->getUpperLeftX());
+    setUpperLeftY(source->getUpperLeftY());
+    setUpperRightX(source->getUpperRightX());
+    setUpperRightY(source->getUpperRightY());
+    setLowerRightX(source->getLowerRightX());
+    setLowerRightY(source->getLowerRightY());
+    setLowerLeftX(source->getLowerLeftX());
+    setLowerLeftY(source->getLowerLeftY());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setDefer(source->getDefer());
+    setUseMipmap(source->getUseMipmap());
+}
+
 float PerspectiveCommand::getUpperLeftX() const
 {
     return this->upperLeftX;
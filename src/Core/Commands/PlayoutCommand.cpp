@@ -7,6 +7,25 @@ PlayoutCommand::PlayoutCommand(QObject* parent)
 {
 }
 
+AbstractCommand* PlayoutCommand::clone() const
+{
+    PlayoutCommand* command = new PlayoutCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void PlayoutCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const PlayoutCommand* source = dynamic_cast<const PlayoutCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setPlayoutCommand(source->getPlayoutCommand());
+}
+
 const QString& PlayoutCommand::getPlayoutCommand() const
 {
     return this->command;
@@ -7,6 +7,25 @@ PrintCommand::PrintCommand(QObject* parent)
 {
 }
 
+AbstractCommand* PrintCommand::clone() const
+{
+    PrintCommand* command = new PrintCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void PrintCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const PrintCommand* source = dynamic_cast<const PrintCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setOutput(source->getOutput());
+}
+
 const QString& PrintCommand::getOutput() const
 {
     return this->output;
@@ -24,6 +24,8 @@ class CORE_EXPORT PrintCommand : public AbstractCommand
         const QString& getOutput() const;
         void setOutput(const QString& output);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
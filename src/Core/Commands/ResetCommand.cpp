@@ -6,3 +6,11 @@ ResetCommand::ResetCommand(QObject* parent)
     : AbstractCommand(parent)
 {
 }
+
+AbstractCommand* ResetCommand::clone() const
+{
+    ResetCommand* command = new ResetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
@@ -11,4 +11,6 @@ class CORE_EXPORT ResetCommand : public AbstractCommand
 
     public:
         explicit ResetCommand(QObject* parent = 0);
+
+        virtual AbstractCommand* clone() const;
 };
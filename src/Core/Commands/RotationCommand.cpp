@@ -7,6 +7,29 @@ RotationCommand::RotationCommand(QObject* parent)
 {
 }
 
+AbstractCommand* RotationCommand::clone() const
+{
+    RotationCommand* command = new RotationCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void RotationCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const RotationCommand* source = dynamic_cast<const RotationCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setRotation(source->getRotation());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setDefer(source->getDefer());
+}
+
 float RotationCommand::getRotation() const
 {
     return this->rotation;
@@ -7,6 +7,25 @@ RouteChannelCommand::RouteChannelCommand(QObject* parent)
 {
 }
 
+AbstractCommand* RouteChannelCommand::clone() const
+{
+    RouteChannelCommand* command = new RouteChannelCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void RouteChannelCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const RouteChannelCommand* source = dynamic_cast<const RouteChannelCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setFromChannel(source->getFromChannel());
+}
+
 int RouteChannelCommand::getFromChannel() const
 {
     return this->fromChannel;
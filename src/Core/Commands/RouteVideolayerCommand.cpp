@@ -7,6 +7,26 @@ RouteVideolayerCommand::RouteVideolayerCommand(QObject* parent)
 {
 }
 
+AbstractCommand* RouteVideolayerCommand::clone() const
+{
+    RouteVideolayerCommand* command = new RouteVideolayerCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void RouteVideolayerCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const RouteVideolayerCommand* source = dynamic_cast<const RouteVideolayerCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setFromChannel(source->getFromChannel());
+    setFromVideolayer(source->getFromVideolayer());
+}
+
 int RouteVideolayerCommand::getFromChannel() const
 {
     return this->fromChannel;
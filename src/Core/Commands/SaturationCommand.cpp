@@ -7,6 +7,28 @@ SaturationCommand::SaturationCommand(QObject* parent)
 {
 }
 
+AbstractCommand* SaturationCommand::clone() const
+{
+    SaturationCommand* command = new SaturationCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void SaturationCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const SaturationCommand* source = dynamic_cast<const SaturationCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setSaturation(source->getSaturation());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float SaturationCommand::getSaturation() const
 {
     return this->saturation;
@@ -4,3 +4,11 @@ SeparatorCommand::SeparatorCommand(QObject* parent)
     : AbstractCommand(parent)
 {
 }
+
+AbstractCommand* SeparatorCommand::clone() const
+{
+    SeparatorCommand* command = new SeparatorCommand();
+    command->copyProperties(this);
+
+    return command;
+}
@@ -17,4 +17,6 @@ class CORE_EXPORT SeparatorCommand : public AbstractCommand
 
     public:
         explicit SeparatorCommand(QObject* parent = 0);
+
+        virtual AbstractCommand* clone() const;
 };
@@ -9,6 +9,31 @@ SolidColorCommand::SolidColorCommand(QObject* parent)
 {
 }
 
+AbstractCommand* SolidColorCommand::clone() const
+{
+    SolidColorCommand* command = new SolidColorCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void SolidColorCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const SolidColorCommand* source = dynamic_cast<const SolidColorCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setColor(source->getColor());
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setUseAuto(source->getUseAuto());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& SolidColorCommand::getColor() const
 {
     return this->color;
@@ -7,6 +7,27 @@ SonyPresetCommand::SonyPresetCommand(QObject* parent)
 {
 }
 
+AbstractCommand* SonyPresetCommand::clone() const
+{
+    SonyPresetCommand* command = new SonyPresetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void SonyPresetCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const SonyPresetCommand* source = dynamic_cast<const SonyPresetCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setAddress(source->getAddress());
+    setPreset(source->getPreset());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& SonyPresetCommand::getAddress() const
 {
     return this->address;
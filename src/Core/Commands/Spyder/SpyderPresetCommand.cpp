@@ -7,6 +7,27 @@ SpyderPresetCommand::SpyderPresetCommand(QObject* parent)
 {
 }
 
+AbstractCommand* SpyderPresetCommand::clone() const
+{
+    SpyderPresetCommand* command = new SpyderPresetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void SpyderPresetCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const SpyderPresetCommand* source = dynamic_cast<const SpyderPresetCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setAddress(source->getAddress());
+    setPreset(source->getPreset());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& SpyderPresetCommand::getAddress() const
 {
     return this->address;
@@ -7,6 +7,31 @@ StillCommand::StillCommand(QObject* parent)
 {
 }
 
+AbstractCommand* StillCommand::clone() const
+{
+    StillCommand* command = new StillCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void StillCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const StillCommand* source = dynamic_cast<const StillCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setImageName(source->getImageName());
+    setTransition(source->getTransition());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDirection(source->getDirection());
+    setUseAuto(source->getUseAuto());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& StillCommand::getImageName() const
 {
     return this->imageName;
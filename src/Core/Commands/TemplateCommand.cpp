@@ -1,15 +1,87 @@
 #include "TemplateCommand.h"
 
-#include "Xml.h"
-
+#include <QtCore/QHash>
 #include <QtCore/QXmlStreamWriter>
 
+namespace
+{
+    // The payload ends up inside a quoted AMCP parameter, so both escapings are applied here in one pass.
+    void appendXml(QString& data, const QString& value)
+    {
+        for (int i = 0; i < value.size(); i++)
+        {
+            const QChar character = value.at(i);
+            switch (character.unicode())
+            {
+                case '&': data.append("&amp;"); break;
+                case '\'': data.append("&apos;"); break;
+                case '"': data.append("&quot;"); break;
+                case '<': data.append("&lt;"); break;
+                case '>': data.append("&gt;"); break;
+                case '\n': data.append("&#10;"); break;
+                case '\r': data.append("&#13;"); break;
+                case '\\': data.append("\\\\"); break;
+                default: data.append(character); break;
+            }
+        }
+    }
+
+    void appendJson(QString& data, const QString& value)
+    {
+        for (int i = 0; i < value.size(); i++)
+        {
+            const QChar character = value.at(i);
+            switch (character.unicode())
+            {
+                case '"': data.append("\\\\\\\""); break;
+                case '\\': data.append("\\\\\\\\"); break;
+                case '\n': data.append("\\\\n"); break;
+                case '\r': data.append("\\\\r"); break;
+                case '\t': data.append("\\\\t"); break;
+                default:
+                    if (character.unicode() < 0x20)
+                        data.append(QString("\\\\u%1").arg(character.unicode(), 4, 16, QChar('0')));
+                    else
+                        data.append(character);
+                    break;
+            }
+        }
+    }
+}
+
 TemplateCommand::TemplateCommand(QObject* parent)
     : AbstractCommand(parent)
 {
     this->videolayer = Output::DEFAULT_FLASH_VIDEOLAYER;
 }
 
+AbstractCommand* TemplateCommand::clone() const
+{
+    TemplateCommand* command = new TemplateCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void TemplateCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const TemplateCommand* source = dynamic_cast<const TemplateCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setFlashlayer(source->getFlashlayer());
+    setInvoke(source->getInvoke());
+    setTemplateName(source->getTemplateName());
+    setTemplateDataModels(source->getTemplateDataModels());
+    setUseStoredData(source->getUseStoredData());
+    setUseUppercaseData(source->getUseUppercaseData());
+    setTriggerOnNext(source->getTriggerOnNext());
+    setSendAsJson(source->getSendAsJson());
+    setUpdateChangedOnly(source->getUpdateChangedOnly());
+}
+
 int TemplateCommand::getFlashlayer() const
 {
     return this->flashlayer;
@@ -42,43 +114,83 @@ const QString& TemplateCommand::getTemplateName() const
 
 const QString TemplateCommand::getTemplateData() const
 {
-    QString templateData;
+    // Built once per edit, a ticker plays and updates the same data many times over.
+    if (!this->templateDataValid)
+    {
+        if (this->useStoredData)
+            this->templateData = (this->models.count() > 0) ? this->models.at(0).getValue() : "";
+        else
+            this->templateData = buildTemplateData(this->models);
+
+        this->templateDataValid = true;
+    }
+
+    return this->templateData;
+}
+
+const QString TemplateCommand::getTemplateData(const QList<KeyValueModel>& previous) const
+{
     if (this->useStoredData)
+        return getTemplateData();
+
+    QHash<QString, QString> values;
+    foreach (const KeyValueModel& model, previous)
+        values[model.getKey()] = model.getValue();
+
+    QList<KeyValueModel> changes;
+    foreach (const KeyValueModel& model, this->models)
     {
-        if (this->models.count() == 0)
-            return "";
+        QHash<QString, QString>::iterator value = values.find(model.getKey());
+        if (value == values.end() || value.value() != model.getValue())
+            changes.append(model);
 
-        templateData.append(this->models.at(0).getValue());
+        if (value != values.end())
+            values.erase(value);
     }
-    else
+
+    // Fields removed since then are cleared on the template.
+    for (QHash<QString, QString>::const_iterator value = values.constBegin(); value != values.constEnd(); ++value)
+        changes.append(KeyValueModel(value.key(), ""));
+
+    if (changes.isEmpty())
+        return "";
+
+    return buildTemplateData(changes);
+}
+
+QString TemplateCommand::buildTemplateData(const QList<KeyValueModel>& models) const
+{
+    QString templateData;
+    templateData.reserve(64 + models.count() * 96);
+
+    if (this->sendAsJson)
     {
-        if (this->sendAsJson)
+        templateData.append("{");
+        for (int i = 0; i < models.count(); i++)
         {
-            templateData.append("{");
-            foreach (KeyValueModel model, this->models)
-            {
-                templateData.append(QString("\\\"%1\\\":\\\"%2\\\",").arg(model.getKey())
-                                                                     .arg((this->useUppercaseData == true) ? model.getValue().toUpper() : model.getValue()));
-            }
-            templateData.chop(1);
-            templateData.append("}");
+            if (i > 0)
+                templateData.append(",");
+
+            templateData.append("\\\"");
+            appendJson(templateData, models.at(i).getKey());
+            templateData.append("\\\":\\\"");
+            appendJson(templateData, (this->useUppercaseData) ? models.at(i).getValue().toUpper() : models.at(i).getValue());
+            templateData.append("\\\"");
         }
-        else
+        templateData.append("}");
+    }
+    else
+    {
+        templateData.append("<templateData>");
+        foreach (const KeyValueModel& model, models)
         {
-            templateData.append("<templateData>");
-            foreach (KeyValueModel model, this->models)
-            {
-                QString componentData = TemplateData::DEFAULT_COMPONENT_DATA_XML;
-                componentData.replace("#KEY", model.getKey());
-
-                QString value = model.getValue();
-                value = Xml::encode(value).replace("\\", "\\\\");
-                componentData.replace("#VALUE", (this->useUppercaseData == true) ? value.toUpper() : value);
-
-                templateData.append(componentData);
-            }
-            templateData.append("</templateData>");
+            templateData.append("<componentData id=\\\"");
+            appendXml(templateData, model.getKey());
+            templateData.append("\\\"><data id=\\\"text\\\" value=\\\"");
+            appendXml(templateData, (this->useUppercaseData) ? model.getValue().toUpper() : model.getValue());
+            templateData.append("\\\"/></componentData>");
         }
+        templateData.append("</templateData>");
     }
 
     return templateData;
@@ -94,6 +206,11 @@ bool TemplateCommand::getTriggerOnNext() const
     return this->triggerOnNext;
 }
 
+bool TemplateCommand::getUpdateChangedOnly() const
+{
+    return this->updateChangedOnly;
+}
+
 void TemplateCommand::setFlashlayer(int flashlayer)
 {
     this->flashlayer = flashlayer;
@@ -109,18 +226,21 @@ void TemplateCommand::setInvoke(const QString& invoke)
 void TemplateCommand::setUseStoredData(bool useStoredData)
 {
     this->useStoredData = useStoredData;
+    this->templateDataValid = false;
     emit useStoredDataChanged(this->useStoredData);
 }
 
 void TemplateCommand::setSendAsJson(bool sendAsJson)
 {
     this->sendAsJson = sendAsJson;
+    this->templateDataValid = false;
     emit sendAsJsonChanged(this->sendAsJson);
 }
 
 void TemplateCommand::setUseUppercaseData(bool useUppercaseData)
 {
     this->useUppercaseData = useUppercaseData;
+    this->templateDataValid = false;
     emit useUppercaseDataChanged(this->useUppercaseData);
 }
 
@@ -133,6 +253,7 @@ void TemplateCommand::setTemplateName(const QString& templateName)
 void TemplateCommand::setTemplateDataModels(const QList<KeyValueModel>& models)
 {
     this->models = models;
+    this->templateDataValid = false;
     emit templateDataChanged(this->models);
 }
 
@@ -142,6 +263,12 @@ void TemplateCommand::setTriggerOnNext(bool triggerOnNext)
     emit triggerOnNextChanged(this->triggerOnNext);
 }
 
+void TemplateCommand::setUpdateChangedOnly(bool updateChangedOnly)
+{
+    this->updateChangedOnly = updateChangedOnly;
+    emit updateChangedOnlyChanged(this->updateChangedOnly);
+}
+
 void TemplateCommand::readProperties(boost::property_tree::wptree& pt)
 {
     AbstractCommand::readProperties(pt);
@@ -152,6 +279,7 @@ void TemplateCommand::readProperties(boost::property_tree::wptree& pt)
     setUseUppercaseData(pt.get(L"useuppercasedata", Template::DEFAULT_USE_UPPERCASE_DATA));
     setTriggerOnNext(pt.get(L"triggeronnext", Template::DEFAULT_TRIGGER_ON_NEXT));
     setSendAsJson(pt.get(L"sendasjson", Template::DEFAULT_SEND_AS_JSON));
+    setUpdateChangedOnly(pt.get(L"updatechangedonly", Template::DEFAULT_UPDATE_CHANGED_ONLY));
 
     if (pt.count(L"templatedata") > 0)
     {
@@ -160,6 +288,8 @@ void TemplateCommand::readProperties(boost::property_tree::wptree& pt)
             this->models.push_back(KeyValueModel(QString::fromStdWString(value.second.get<std::wstring>(L"id")),
                                                  QString::fromStdWString(value.second.get<std::wstring>(L"value"))));
         }
+
+        this->templateDataValid = false;
     }
 }
 
@@ -173,6 +303,7 @@ void TemplateCommand::writeProperties(QXmlStreamWriter* writer)
     writer->writeTextElement("useuppercasedata", (getUseUppercaseData() == true) ? "true" : "false");
     writer->writeTextElement("triggeronnext", (getTriggerOnNext() == true) ? "true" : "false");
     writer->writeTextElement("sendasjson", (getSendAsJson() == true) ? "true" : "false");
+    writer->writeTextElement("updatechangedonly", (getUpdateChangedOnly() == true) ? "true" : "false");
 
 
     if (this->models.count() > 0)
@@ -22,6 +22,8 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
     public:
         explicit TemplateCommand(QObject* parent = 0);
 
+        virtual AbstractCommand* clone() const;
+        virtual void copyProperties(const AbstractCommand* command);
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
@@ -32,8 +34,10 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         bool getUseUppercaseData() const;
         const QString& getTemplateName() const;
         const QString getTemplateData() const;
+        const QString getTemplateData(const QList<KeyValueModel>& previous) const;
         const QList<KeyValueModel>& getTemplateDataModels() const;
         bool getTriggerOnNext() const;
+        bool getUpdateChangedOnly() const;
 
         void setFlashlayer(int flashlayer); 
         void setInvoke(const QString& invoke);
@@ -43,6 +47,7 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         void setTemplateName(const QString& templateName);
         void setTemplateDataModels(const QList<KeyValueModel>& models);
         void setTriggerOnNext(bool triggerOnNext);
+        void setUpdateChangedOnly(bool updateChangedOnly);
 
     private:
         int flashlayer = Template::DEFAULT_FLASHLAYER;
@@ -53,6 +58,12 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         QList<KeyValueModel> models;
         bool triggerOnNext = Template::DEFAULT_TRIGGER_ON_NEXT;
         bool sendAsJson = Template::DEFAULT_SEND_AS_JSON;
+        bool updateChangedOnly = Template::DEFAULT_UPDATE_CHANGED_ONLY;
+
+        mutable QString templateData;
+        mutable bool templateDataValid = false;
+
+        QString buildTemplateData(const QList<KeyValueModel>& models) const;
 
         Q_SIGNAL void flashlayerChanged(int);
         Q_SIGNAL void invokeChanged(const QString&);
@@ -62,4 +73,5 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         Q_SIGNAL void templateNameChanged(const QString&);
         Q_SIGNAL void templateDataChanged(const QList<KeyValueModel>&);
         Q_SIGNAL void triggerOnNextChanged(bool);
+        Q_SIGNAL void updateChangedOnlyChanged(bool);
 };
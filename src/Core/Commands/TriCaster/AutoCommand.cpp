@@ -7,6 +7,28 @@ AutoCommand::AutoCommand(QObject* parent)
 {
 }
 
+AbstractCommand* AutoCommand::clone() const
+{
+    AutoCommand* command = new AutoCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void AutoCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const AutoCommand* source = dynamic_cast<const AutoCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setStep(source->getStep());
+    setSpeed(source->getSpeed());
+    setTransition(source->getTransition());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& AutoCommand::getStep() const
 {
     return this->step;
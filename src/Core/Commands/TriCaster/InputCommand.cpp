@@ -7,6 +7,27 @@ InputCommand::InputCommand(QObject* parent)
 {
 }
 
+AbstractCommand* InputCommand::clone() const
+{
+    InputCommand* command = new InputCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void InputCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const InputCommand* source = dynamic_cast<const InputCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setSwitcher(source->getSwitcher());
+    setInput(source->getInput());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& InputCommand::getSwitcher() const
 {
     return this->switcher;
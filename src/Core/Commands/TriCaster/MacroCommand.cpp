@@ -7,6 +7,26 @@ MacroCommand::MacroCommand(QObject* parent)
 {
 }
 
+AbstractCommand* MacroCommand::clone() const
+{
+    MacroCommand* command = new MacroCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void MacroCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const MacroCommand* source = dynamic_cast<const MacroCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setMacro(source->getMacro());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& MacroCommand::getMacro() const
 {
     return this->macro;
@@ -7,6 +7,27 @@ NetworkSourceCommand::NetworkSourceCommand(QObject* parent)
 {
 }
 
+AbstractCommand* NetworkSourceCommand::clone() const
+{
+    NetworkSourceCommand* command = new NetworkSourceCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void NetworkSourceCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const NetworkSourceCommand* source = dynamic_cast<const NetworkSourceCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setTarget(source->getTarget());
+    setSource(source->getSource());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& NetworkSourceCommand::getSource() const
 {
     return this->source;
@@ -7,6 +7,27 @@ PresetCommand::PresetCommand(QObject* parent)
 {
 }
 
+AbstractCommand* PresetCommand::clone() const
+{
+    PresetCommand* command = new PresetCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void PresetCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const PresetCommand* source = dynamic_cast<const PresetCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setSource(source->getSource());
+    setPreset(source->getPreset());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& PresetCommand::getSource() const
 {
     return this->source;
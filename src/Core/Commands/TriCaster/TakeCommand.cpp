@@ -7,6 +7,26 @@ TakeCommand::TakeCommand(QObject* parent)
 {
 }
 
+AbstractCommand* TakeCommand::clone() const
+{
+    TakeCommand* command = new TakeCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void TakeCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const TakeCommand* source = dynamic_cast<const TakeCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setStep(source->getStep());
+    setTriggerOnNext(source->getTriggerOnNext());
+}
+
 const QString& TakeCommand::getStep() const
 {
     return this->step;
@@ -8,6 +8,28 @@ VolumeCommand::VolumeCommand(QObject* parent)
     this->videolayer = Output::DEFAULT_AUDIO_VIDEOLAYER;
 }
 
+AbstractCommand* VolumeCommand::clone() const
+{
+    VolumeCommand* command = new VolumeCommand();
+    command->copyProperties(this);
+
+    return command;
+}
+
+void VolumeCommand::copyProperties(const AbstractCommand* command)
+{
+    AbstractCommand::copyProperties(command);
+
+    const VolumeCommand* source = dynamic_cast<const VolumeCommand*>(command);
+    if (source == NULL)
+        return;
+
+    setVolume(source->getVolume());
+    setTransitionDuration(source->getTransitionDuration());
+    setTween(source->getTween());
+    setDefer(source->getDefer());
+}
+
 float VolumeCommand::getVolume() const
 {
     return this->volume;
@@ -1,4 +1,4 @@
-QT += core sql network widgets
+QT += core sql network widgets concurrent
 
 CONFIG += c++11
 
@@ -8,6 +8,7 @@ TEMPLATE = lib
 DEFINES += CORE_LIBRARY
 
 HEADERS += \
+    AsyncDatabaseManager.h \
     DatabaseManager.h \
     DeviceManager.h \
     Shared.h \
@@ -85,7 +86,6 @@ HEADERS += \
     Commands/CustomCommand.h \
     OscSubscription.h \
     Events/Inspector/VideolayerChangedEvent.h \
-    Models/OscFileModel.h \
     Events/Inspector/AddTemplateDataEvent.h \
     Events/Action/AddActionItemEvent.h \
     Commands/ChromaCommand.h \
@@ -105,7 +105,11 @@ HEADERS += \
     Models/TriCaster/TriCasterSwitcherModel.h \
     Models/TriCaster/TriCasterSourceModel.h \
     Models/TriCaster/TriCasterDeviceModel.h \
+    AudioMeterManager.h \
     OscDeviceManager.h \
+    OscLayerState.h \
+    OscStateManager.h \
+    PresetManager.h \
     TriCasterDeviceManager.h \
     Events/Rundown/ExecuteRundownItemEvent.h \
     Commands/TriCaster/NetworkSourceCommand.h \
@@ -153,6 +157,7 @@ HEADERS += \
     Events/CloseApplicationEvent.h \
     Commands/FadeToBlackCommand.h \
     Events/Rundown/PasteItemPropertiesEvent.h \
+    Events/Rundown/FindInRundownEvent.h \
     Events/Rundown/CopyItemPropertiesEvent.h \
     Events/Library/LibraryFilterChangedEvent.h \
     Events/ExportPresetMenuEvent.h \
@@ -191,9 +196,13 @@ HEADERS += \
     Events/Rundown/CurrentItemChangedEvent.h \
     Commands/Atem/AtemMacroCommand.h \
     OscWebSocketManager.h \
-    Commands/Atem/AtemFadeToBlackCommand.h
+    Commands/Atem/AtemFadeToBlackCommand.h \
+    Executors/AbstractCommandExecutor.h \
+    Executors/MovieCommandExecutor.h \
+    Executors/TemplateCommandExecutor.h
 
 SOURCES += \
+    AsyncDatabaseManager.cpp \
     DatabaseManager.cpp \
     DeviceManager.cpp \
     Commands/TemplateCommand.cpp \
@@ -270,7 +279,6 @@ SOURCES += \
     Commands/CustomCommand.cpp \
     OscSubscription.cpp \
     Events/Inspector/VideolayerChangedEvent.cpp \
-    Models/OscFileModel.cpp \
     Events/Inspector/AddTemplateDataEvent.cpp \
     Events/Action/AddActionItemEvent.cpp \
     Commands/ChromaCommand.cpp \
@@ -290,7 +298,11 @@ SOURCES += \
     Models/TriCaster/TriCasterSwitcherModel.cpp \
     Models/TriCaster/TriCasterSourceModel.cpp \
     Models/TriCaster/TriCasterDeviceModel.cpp \
+    AudioMeterManager.cpp \
     OscDeviceManager.cpp \
+    OscLayerState.cpp \
+    OscStateManager.cpp \
+    PresetManager.cpp \
     TriCasterDeviceManager.cpp \
     Events/Rundown/ExecuteRundownItemEvent.cpp \
     Commands/TriCaster/NetworkSourceCommand.cpp \
@@ -338,6 +350,7 @@ SOURCES += \
     Events/CloseApplicationEvent.cpp \
     Commands/FadeToBlackCommand.cpp \
     Events/Rundown/PasteItemPropertiesEvent.cpp \
+    Events/Rundown/FindInRundownEvent.cpp \
     Events/Rundown/CopyItemPropertiesEvent.cpp \
     Events/Library/LibraryFilterChangedEvent.cpp \
     Events/ExportPresetMenuEvent.cpp \
@@ -376,7 +389,10 @@ SOURCES += \
     Events/Rundown/CurrentItemChangedEvent.cpp \
     Commands/Atem/AtemMacroCommand.cpp \
     OscWebSocketManager.cpp \
-    Commands/Atem/AtemFadeToBlackCommand.cpp
+    Commands/Atem/AtemFadeToBlackCommand.cpp \
+    Executors/AbstractCommandExecutor.cpp \
+    Executors/MovieCommandExecutor.cpp \
+    Executors/TemplateCommandExecutor.cpp
 
 DISTFILES += \
     Sql/ChangeScript-208.sql \
@@ -385,7 +401,10 @@ DISTFILES += \
     Sql/ChangeScript-210.sql \
     Sql/ChangeScript-211.sql \
     Sql/ChangeScript-212.sql \
-    Sql/ChangeScript-213.sql
+    Sql/ChangeScript-213.sql \
+    Sql/ChangeScript-214.sql \
+    Sql/ChangeScript-215.sql \
+    Sql/ChangeScript-216.sql
 
 RESOURCES += \
     Core.qrc
@@ -1,13 +1,18 @@
 #include "DatabaseManager.h"
 
 #include "Version.h"
+#include "Trace.h"
 
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
 #include <QtCore/QTime>
 #include <QtCore/QVariant>
 
+#include <QtSql/QSqlDatabase>
 #include <QtSql/QSqlDriver>
 #include <QtSql/QSqlError>
 #include <QtSql/QSqlQuery>
@@ -15,7 +20,6 @@
 Q_GLOBAL_STATIC(DatabaseManager, databaseManager)
 
 DatabaseManager::DatabaseManager()
-    : mutex(QMutex::Recursive)
 {
 }
 
@@ -26,14 +30,107 @@ DatabaseManager& DatabaseManager::getInstance()
 
 void DatabaseManager::initialize()
 {
-    QMutexLocker locker(&mutex);
-
-    if (QSqlDatabase::database().tables().count() == 0)
+    // Remember how the default connection was set up, other threads open their own connection the same way.
+    QSqlDatabase database = QSqlDatabase::database();
+    this->driverName = database.driverName();
+    this->hostName = database.hostName();
+    this->databaseName = database.databaseName();
+    this->userName = database.userName();
+    this->password = database.password();
+    this->port = database.port();
+    this->connectOptions = database.connectOptions();
+
+    if (database.tables().count() == 0)
         createDatabase();
     else
         upgradeDatabase();
 }
 
+bool DatabaseManager::supportsThreadedAccess() const
+{
+    // A second connection to an in memory SQLite database would be a new, empty database.
+    return !(this->driverName == "QSQLITE" && this->databaseName == ":memory:");
+}
+
+QSqlDatabase DatabaseManager::database() const
+{
+    // The default connection belongs to the GUI thread, any other thread gets a connection of its own.
+    if (QThread::currentThread() == QCoreApplication::instance()->thread())
+        return QSqlDatabase::database();
+
+    QString connectionName = getThreadConnectionName();
+    if (QSqlDatabase::contains(connectionName))
+        return QSqlDatabase::database(connectionName);
+
+    QSqlDatabase database = QSqlDatabase::addDatabase(this->driverName, connectionName);
+    database.setHostName(this->hostName);
+    database.setDatabaseName(this->databaseName);
+    database.setUserName(this->userName);
+    database.setPassword(this->password);
+    database.setPort(this->port);
+    database.setConnectOptions(this->connectOptions);
+
+    if (!database.open())
+        qCritical("Failed to open database connection %s, Error: %s", qPrintable(connectionName), qPrintable(database.lastError().text()));
+
+    // Pool threads come and go, their connection goes with them. The slot runs on the finishing thread.
+    QObject::connect(QThread::currentThread(), &QThread::finished, [connectionName]()
+    {
+        {
+            QSqlDatabase database = QSqlDatabase::database(connectionName, false);
+            database.close();
+        }
+
+        QSqlDatabase::removeDatabase(connectionName);
+    });
+
+    return database;
+}
+
+void DatabaseManager::closeThreadConnection()
+{
+    QString connectionName = getThreadConnectionName();
+    if (!QSqlDatabase::contains(connectionName))
+        return;
+
+    {
+        QSqlDatabase database = QSqlDatabase::database(connectionName, false);
+        database.close();
+    }
+
+    QSqlDatabase::removeDatabase(connectionName);
+}
+
+QString DatabaseManager::getThreadConnectionName() const
+{
+    return QString("DatabaseManager-%1").arg(reinterpret_cast<quintptr>(QThread::currentThread()));
+}
+
+void DatabaseManager::beginTransaction()
+{
+    // Nested transactions are folded into the outermost one, which lets writes be batched. On SQLite only one
+    // thread writes at a time, the other connections would otherwise wait on its file lock or fail. A server
+    // database handles concurrent transactions itself, the GUI thread must not queue behind a worker's batch.
+    if (this->transactionDepth.localData()++ == 0)
+    {
+        if (this->driverName == "QSQLITE")
+            this->writeMutex.lock();
+
+        database().transaction();
+    }
+}
+
+void DatabaseManager::commitTransaction()
+{
+    if (--this->transactionDepth.localData() == 0)
+    {
+        database().commit();
+
+        if (this->driverName == "QSQLITE")
+            this->writeMutex.unlock();
+    }
+}
+
 void DatabaseManager::createDatabase()
 {
     QFile file(":/Scripts/Sql/Schema.sql");
@@ -43,7 +140,7 @@ void DatabaseManager::createDatabase()
 
         file.close();
 
-        QSqlQuery sql;
+        QSqlQuery sql(database());
         foreach (QString query, queries)
         {
             if (query.trimmed().isEmpty())
@@ -78,7 +175,7 @@ void DatabaseManager::createDatabase()
 
 void DatabaseManager::upgradeDatabase()
 {
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT c.Id, c.Name, c.Value FROM Configuration c WHERE c.Name = 'DatabaseVersion'"))
        qFatal("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -95,11 +192,14 @@ void DatabaseManager::upgradeDatabase()
 
             file.close();
 
-            foreach(const QString& query, queries)
+            foreach(QString query, queries)
             {
                  if (query.trimmed().isEmpty())
                      continue;
 
+                 if (sql.driver()->dbmsType() == QSqlDriver::SQLite)
+                     query.remove("AUTO_INCREMENT");
+
                  if (!sql.exec(query))
                     qFatal("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
             }
@@ -120,11 +220,11 @@ void DatabaseManager::upgradeDatabase()
 
 void DatabaseManager::updateConfiguration(const ConfigurationModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE Configuration SET Value = :Value "
                 "WHERE Name = :Name");
     sql.bindValue(":Value", model.getValue());
@@ -133,14 +233,36 @@ void DatabaseManager::updateConfiguration(const ConfigurationModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    // Clients sharing the database drop their cached settings when the version moves.
+    updateLibraryVersion("CONFIGURATION");
+
+    commitTransaction();
+
+    QMutexLocker locker(&this->configurationMutex);
+    this->configurations.remove(model.getName());
+}
+
+void DatabaseManager::clearConfigurationCache()
+{
+    QMutexLocker locker(&this->configurationMutex);
+    this->configurations.clear();
 }
 
 ConfigurationModel DatabaseManager::getConfigurationByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    // Every rundown item reads a few settings when it is created, a rundown with hundreds of items would ask
+    // for the same ones hundreds of times. updateConfiguration() drops what it changes, settings changed by
+    // another client sharing the database are dropped when LibraryManager sees the CONFIGURATION version move.
+    {
+        QMutexLocker locker(&this->configurationMutex);
+        QHash<QString, ConfigurationModel>::const_iterator iterator = this->configurations.constFind(name);
+        if (iterator != this->configurations.constEnd())
+            return iterator.value();
+    }
+
+    QSqlQuery sql(database());
     sql.prepare("SELECT c.Id, c.Name, c.Value FROM Configuration c "
                 "WHERE c.Name = :Name");
     sql.bindValue(":Name", name);
@@ -150,14 +272,19 @@ ConfigurationModel DatabaseManager::getConfigurationByName(const QString& name)
 
     sql.first();
 
-    return ConfigurationModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString());
+    ConfigurationModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString());
+
+    QMutexLocker locker(&this->configurationMutex);
+    this->configurations.insert(name, model);
+
+    return model;
 }
 
 QList<FormatModel> DatabaseManager::getFormat()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT f.Id, f.Name, f.Width, f.Height, f.FramesPerSecond FROM Format f"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -170,9 +297,9 @@ QList<FormatModel> DatabaseManager::getFormat()
 
 FormatModel DatabaseManager::getFormat(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT f.Id, f.Name, f.Width, f.Height, f.FramesPerSecond FROM Format f "
                 "WHERE f.Name = :Name");
     sql.bindValue(":Name", name);
@@ -187,9 +314,9 @@ FormatModel DatabaseManager::getFormat(const QString& name)
 
 QList<QString> DatabaseManager::getOpenRecent()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT o.Id, o.Value FROM OpenRecent o ORDER BY o.Id DESC"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -202,11 +329,11 @@ QList<QString> DatabaseManager::getOpenRecent()
 
 void DatabaseManager::insertOpenRecent(const QString& path)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO OpenRecent (Value) "
                 "VALUES(:Value)");
     sql.bindValue(":Value", path);
@@ -217,27 +344,27 @@ void DatabaseManager::insertOpenRecent(const QString& path)
     if (!sql.exec("DELETE FROM OpenRecent WHERE Id > 10"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteOpenRecent()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("DELETE FROM OpenRecent"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<PresetModel> DatabaseManager::getPreset()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT p.Id, p.Name, p.Value FROM Preset p"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -250,9 +377,9 @@ QList<PresetModel> DatabaseManager::getPreset()
 
 PresetModel DatabaseManager::getPreset(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT p.Id, p.Name, p.Value FROM Preset p "
                 "WHERE p.Name = :Name");
     sql.bindValue(":Name", name);
@@ -267,9 +394,9 @@ PresetModel DatabaseManager::getPreset(const QString& name)
 
 QList<PresetModel> DatabaseManager::getPresetByFilter(const QString& filter)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT p.Id, p.Name, p.Value FROM Preset p "
                 "WHERE p.Name LIKE :Name "
                 "ORDER BY p.Name, p.Id");
@@ -285,47 +412,52 @@ QList<PresetModel> DatabaseManager::getPresetByFilter(const QString& filter)
     return models;
 }
 
-void DatabaseManager::insertPreset(const PresetModel& model)
+int DatabaseManager::insertPreset(const PresetModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO Preset (Name, Value) "
                 "VALUES(:Name, :Value)");
     sql.bindValue(":Name", model.getName());
     sql.bindValue(":Value", model.getValue());
 
+    int id = 0;
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+    else
+        id = sql.lastInsertId().toInt();
+
+    commitTransaction();
 
-    QSqlDatabase::database().commit();
+    return id;
 }
 
 void DatabaseManager::deletePreset(int id)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
     QString query = QString("DELETE FROM Preset WHERE Id = %1").arg(id);
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM Preset WHERE Id = :Id");
     sql.bindValue(":Id", id);
 
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<BlendModeModel> DatabaseManager::getBlendMode()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT b.Id, b.Value FROM BlendMode b"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -338,9 +470,9 @@ QList<BlendModeModel> DatabaseManager::getBlendMode()
 
 QList<ChromaModel> DatabaseManager::getChroma()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT c.Id, c.Value FROM Chroma c"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -353,9 +485,9 @@ QList<ChromaModel> DatabaseManager::getChroma()
 
 QList<DirectionModel> DatabaseManager::getDirection()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT d.Id, d.Value FROM Direction d"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -368,9 +500,9 @@ QList<DirectionModel> DatabaseManager::getDirection()
 
 QList<TransitionModel> DatabaseManager::getTransition()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Value FROM Transition t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -383,9 +515,9 @@ QList<TransitionModel> DatabaseManager::getTransition()
 
 QList<TweenModel> DatabaseManager::getTween()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Value FROM Tween t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -398,7 +530,9 @@ QList<TweenModel> DatabaseManager::getTween()
 
 QList<OscOutputModel> DatabaseManager::getOscOutput()
 {
-    QSqlQuery sql;
+    TRACE_FUNCTION("database");
+
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o ORDER BY o.Name"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -412,11 +546,11 @@ QList<OscOutputModel> DatabaseManager::getOscOutput()
 
 void DatabaseManager::insertOscOutput(const OscOutputModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO OscOutput (Name, Address, Port, Description) "
                 "VALUES(:Name, :Address, :Port, :Description)");
     sql.bindValue(":Name", model.getName());
@@ -427,14 +561,14 @@ void DatabaseManager::insertOscOutput(const OscOutputModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 OscOutputModel DatabaseManager::getOscOutputByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
                 "WHERE o.Name = :Name");
     sql.bindValue(":Name", name);
@@ -450,9 +584,9 @@ OscOutputModel DatabaseManager::getOscOutputByName(const QString& name)
 
 OscOutputModel DatabaseManager::getOscOutputByAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
                 "WHERE o.Address = :Address");
     sql.bindValue(":Address", address);
@@ -468,11 +602,11 @@ OscOutputModel DatabaseManager::getOscOutputByAddress(const QString& address)
 
 void DatabaseManager::updateOscOutput(const OscOutputModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE OscOutput SET Name = :Name, Address = :Address, Port = :Port, Description = :Description "
                 "WHERE Id = :Id");
     sql.bindValue(":Name", model.getName());
@@ -484,18 +618,18 @@ void DatabaseManager::updateOscOutput(const OscOutputModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteOscOutput(int id)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
     QString query = QString().arg(id);
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM OscOutput "
                 "WHERE Id = :Id");
     sql.bindValue(":Id", id);
@@ -503,14 +637,14 @@ void DatabaseManager::deleteOscOutput(int id)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<AtemStepModel> DatabaseManager::getAtemStep()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemStep t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -523,9 +657,9 @@ QList<AtemStepModel> DatabaseManager::getAtemStep()
 
 QList<AtemAudioInputStateModel> DatabaseManager::getAtemAudioInputState()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemAudioInputState t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -538,9 +672,9 @@ QList<AtemAudioInputStateModel> DatabaseManager::getAtemAudioInputState()
 
 QList<AtemKeyerModel> DatabaseManager::getAtemKeyer()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemKeyer t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -553,9 +687,9 @@ QList<AtemKeyerModel> DatabaseManager::getAtemKeyer()
 
 QList<AtemSwitcherModel> DatabaseManager::getAtemSwitcher()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemSwitcher t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -568,9 +702,9 @@ QList<AtemSwitcherModel> DatabaseManager::getAtemSwitcher()
 
 QList<AtemVideoFormatModel> DatabaseManager::getAtemVideoFormat()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemVideoFormat t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -583,9 +717,9 @@ QList<AtemVideoFormatModel> DatabaseManager::getAtemVideoFormat()
 
 QList<AtemAutoTransitionModel> DatabaseManager::getAtemAutoTransition()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Name, t.Value FROM AtemAutoTransition t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -598,9 +732,9 @@ QList<AtemAutoTransitionModel> DatabaseManager::getAtemAutoTransition()
 
 QList<AtemDeviceModel> DatabaseManager::getAtemDevice()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT o.Id, o.Name, o.Address, o.Description FROM AtemDevice o ORDER BY o.Name"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -613,9 +747,9 @@ QList<AtemDeviceModel> DatabaseManager::getAtemDevice()
 
 AtemDeviceModel DatabaseManager::getAtemDeviceByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
                 "WHERE d.Name = :Name");
     sql.bindValue(":Name", name);
@@ -630,9 +764,9 @@ AtemDeviceModel DatabaseManager::getAtemDeviceByName(const QString& name)
 
 AtemDeviceModel DatabaseManager::getAtemDeviceByAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
                 "WHERE d.Address = :Address");
     sql.bindValue(":Address", address);
@@ -647,11 +781,11 @@ AtemDeviceModel DatabaseManager::getAtemDeviceByAddress(const QString& address)
 
 void DatabaseManager::insertAtemDevice(const AtemDeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO AtemDevice (Name, Address, Description) "
                 "VALUES(:Name, :Address, :Description)");
     sql.bindValue(":Name", model.getName());
@@ -661,16 +795,16 @@ void DatabaseManager::insertAtemDevice(const AtemDeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateAtemDevice(const AtemDeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE AtemDevice SET Name = :Name, Address = :Address, Description = :Description "
                 "WHERE Id = :Id");
     sql.bindValue(":Name", model.getName());
@@ -681,16 +815,16 @@ void DatabaseManager::updateAtemDevice(const AtemDeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteAtemDevice(int id)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM AtemDevice "
                 "WHERE Id = :Id");
     sql.bindValue(":Id", id);
@@ -698,14 +832,14 @@ void DatabaseManager::deleteAtemDevice(int id)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<TriCasterProductModel> DatabaseManager::getTriCasterProduct()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT p.Id, p.Name FROM TriCasterProduct p"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -718,11 +852,11 @@ QList<TriCasterProductModel> DatabaseManager::getTriCasterProduct()
 
 QList<TriCasterInputModel> DatabaseManager::getTriCasterInput()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterInput t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -739,11 +873,11 @@ QList<TriCasterInputModel> DatabaseManager::getTriCasterInput()
 
 QList<TriCasterStepModel> DatabaseManager::getTriCasterStep()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterStep t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -760,11 +894,11 @@ QList<TriCasterStepModel> DatabaseManager::getTriCasterStep()
 
 QList<TriCasterAutoSpeedModel> DatabaseManager::getTriCasterAutoSpeed()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoSpeed t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -781,11 +915,11 @@ QList<TriCasterAutoSpeedModel> DatabaseManager::getTriCasterAutoSpeed()
 
 QList<TriCasterAutoTransitionModel> DatabaseManager::getTriCasterAutoTransition()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoTransition t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -802,11 +936,11 @@ QList<TriCasterAutoTransitionModel> DatabaseManager::getTriCasterAutoTransition(
 
 QList<TriCasterPresetModel> DatabaseManager::getTriCasterPreset()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterPreset t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -823,11 +957,11 @@ QList<TriCasterPresetModel> DatabaseManager::getTriCasterPreset()
 
 QList<TriCasterSourceModel> DatabaseManager::getTriCasterSource()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSource t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -844,11 +978,11 @@ QList<TriCasterSourceModel> DatabaseManager::getTriCasterSource()
 
 QList<TriCasterSwitcherModel> DatabaseManager::getTriCasterSwitcher()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSwitcher t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -865,11 +999,11 @@ QList<TriCasterSwitcherModel> DatabaseManager::getTriCasterSwitcher()
 
 QList<TriCasterNetworkTargetModel> DatabaseManager::getTriCasterNetworkTarget()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterNetworkTarget t "
                 "WHERE t.Products LIKE :Products");
     sql.bindValue(":Products", QString("%%1%").arg(product));
@@ -886,9 +1020,9 @@ QList<TriCasterNetworkTargetModel> DatabaseManager::getTriCasterNetworkTarget()
 
 QList<TriCasterDeviceModel> DatabaseManager::getTriCasterDevice()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d ORDER BY d.Name"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -902,9 +1036,9 @@ QList<TriCasterDeviceModel> DatabaseManager::getTriCasterDevice()
 
 TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
                 "WHERE d.Name = :Name");
     sql.bindValue(":Name", name);
@@ -920,9 +1054,9 @@ TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByName(const QString& na
 
 TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
                 "WHERE d.Address = :Address");
     sql.bindValue(":Address", address);
@@ -938,11 +1072,11 @@ TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByAddress(const QString&
 
 void DatabaseManager::insertTriCasterDevice(const TriCasterDeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO TriCasterDevice (Name, Address, Port, Description) "
                 "VALUES(:Name, :Address, :Port, :Description)");
     sql.bindValue(":Name", model.getName());
@@ -953,16 +1087,16 @@ void DatabaseManager::insertTriCasterDevice(const TriCasterDeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateTriCasterDevice(const TriCasterDeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE TriCasterDevice SET Name = :Name, Address = :Address, Port = :Port, Description = :Description "
                 "WHERE Id = :Id");
     sql.bindValue(":Name", model.getName());
@@ -974,16 +1108,16 @@ void DatabaseManager::updateTriCasterDevice(const TriCasterDeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteTriCasterDevice(int id)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM TriCasterDevice "
                 "WHERE Id = :Id");
     sql.bindValue(":Id", id);
@@ -991,14 +1125,14 @@ void DatabaseManager::deleteTriCasterDevice(int id)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<GpiPortModel> DatabaseManager::getGpiPorts()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT Id, RisingEdge, Action FROM GpiPort ORDER BY Id"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1011,11 +1145,11 @@ QList<GpiPortModel> DatabaseManager::getGpiPorts()
 
 void DatabaseManager::updateGpiPort(const GpiPortModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE GpiPort SET Action = :Action, RisingEdge = :RisingEdge "
                 "WHERE Id = :Id");
     sql.bindValue(":Action", Playout::toString(model.getAction()));
@@ -1025,14 +1159,14 @@ void DatabaseManager::updateGpiPort(const GpiPortModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<GpoPortModel> DatabaseManager::getGpoPorts()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT Id, RisingEdge, PulseLengthMillis FROM GpoPort ORDER BY Id"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1045,11 +1179,11 @@ QList<GpoPortModel> DatabaseManager::getGpoPorts()
 
 void DatabaseManager::updateGpoPort(const GpoPortModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE GpoPort SET PulseLengthMillis = :PulseLengthMillis, RisingEdge = :RisingEdge "
                 "WHERE Id = :Id");
     sql.bindValue(":PulseLengthMillis", model.getPulseLengthMillis());
@@ -1059,14 +1193,14 @@ void DatabaseManager::updateGpoPort(const GpoPortModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<TypeModel> DatabaseManager::getType()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT t.Id, t.Value FROM Type t"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1079,9 +1213,9 @@ QList<TypeModel> DatabaseManager::getType()
 
 TypeModel DatabaseManager::getTypeByValue(const QString& value)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id FROM Type t "
                 "WHERE t.Value = :Value");
     sql.bindValue(":Value", value);
@@ -1096,7 +1230,9 @@ TypeModel DatabaseManager::getTypeByValue(const QString& value)
 
 QList<DeviceModel> DatabaseManager::getDevice()
 {
-    QSqlQuery sql;
+    TRACE_FUNCTION("database");
+
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d ORDER BY d.Name"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1112,9 +1248,9 @@ QList<DeviceModel> DatabaseManager::getDevice()
 
 DeviceModel DatabaseManager::getDeviceById(int deviceId)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d "
                 "WHERE d.Id = :Id");
     sql.bindValue(":Id", deviceId);
@@ -1131,9 +1267,9 @@ DeviceModel DatabaseManager::getDeviceById(int deviceId)
 
 DeviceModel DatabaseManager::getDeviceByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d "
                 "WHERE d.Name = :Name");
     sql.bindValue(":Name", name);
@@ -1150,9 +1286,9 @@ DeviceModel DatabaseManager::getDeviceByName(const QString& name)
 
 DeviceModel DatabaseManager::getDeviceByAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d "
                 "WHERE d.Address = :Address");
     sql.bindValue(":Address", address);
@@ -1169,11 +1305,11 @@ DeviceModel DatabaseManager::getDeviceByAddress(const QString& address)
 
 void DatabaseManager::insertDevice(const DeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("INSERT INTO Device (Name, Address, Port, Username, Password, Description, Version, Shadow, Channels, ChannelFormats, PreviewChannel, LockedChannel) "
                 "VALUES(:Name, :Address, :Port, :Username, :Password, :Description, :Version, :Shadow, :Channels, :ChannelFormats, :PreviewChannel, :LockedChannel)");
     sql.bindValue(":Name", model.getName());
@@ -1192,16 +1328,16 @@ void DatabaseManager::insertDevice(const DeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateDevice(const DeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE Device SET Name = :Name, Address = :Address, Port = :Port, Username = :Username, Password = :Password, Description = :Description, Version = :Version, Shadow = :Shadow, Channels = :Channels, ChannelFormats = :ChannelFormats, PreviewChannel = :PreviewChannel, LockedChannel = :LockedChannel "
                 "WHERE Id = :Id");
     sql.bindValue(":Name", model.getName());
@@ -1221,16 +1357,16 @@ void DatabaseManager::updateDevice(const DeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateDeviceVersion(const DeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE Device SET Version = :Version "
                 "WHERE Address = :Address");
     sql.bindValue(":Version", model.getVersion());
@@ -1239,16 +1375,16 @@ void DatabaseManager::updateDeviceVersion(const DeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateDeviceChannels(const DeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE Device SET Channels = :Channels "
                 "WHERE Address = :Address");
     sql.bindValue(":Channels", model.getChannels());
@@ -1257,16 +1393,16 @@ void DatabaseManager::updateDeviceChannels(const DeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateDeviceChannelFormats(const DeviceModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("UPDATE Device SET ChannelFormats = :ChannelFormats "
                 "WHERE Address = :Address");
     sql.bindValue(":ChannelFormats", model.getChannelFormats());
@@ -1275,16 +1411,16 @@ void DatabaseManager::updateDeviceChannelFormats(const DeviceModel& model)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteDevice(int id)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM Device "
                 "WHERE Id = :Id");
     sql.bindValue(":Id",id);
@@ -1306,14 +1442,14 @@ void DatabaseManager::deleteDevice(int id)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<LibraryModel> DatabaseManager::getLibraryMedia()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) ORDER BY l.Name, l.DeviceId"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1328,9 +1464,9 @@ QList<LibraryModel> DatabaseManager::getLibraryMedia()
 
 QList<LibraryModel> DatabaseManager::getLibraryTemplate()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 ORDER BY l.Name, l.DeviceId"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1345,9 +1481,9 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplate()
 
 QList<LibraryModel> DatabaseManager::getLibraryData()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 ORDER BY l.Name, l.DeviceId"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1362,9 +1498,9 @@ QList<LibraryModel> DatabaseManager::getLibraryData()
 
 QList<LibraryModel> DatabaseManager::getLibraryMediaByFilter(const QString& filter, QList<QString> devices)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {    
@@ -1401,9 +1537,9 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByFilter(const QString& filt
 
 QList<LibraryModel> DatabaseManager::getLibraryTemplateByFilter(const QString& filter, QList<QString> devices)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {
@@ -1440,9 +1576,9 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByFilter(const QString& f
 
 QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filter, QList<QString> devices)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {  
@@ -1479,9 +1615,9 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filte
 
 QList<LibraryModel> DatabaseManager::getLibraryByDeviceId(int deviceId)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
                 "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = :Id "
                 "ORDER BY l.Name, l.DeviceId");
@@ -1501,9 +1637,9 @@ QList<LibraryModel> DatabaseManager::getLibraryByDeviceId(int deviceId)
 
 QList<LibraryModel> DatabaseManager::getLibraryByDeviceIdAndFilter(int deviceId, const QString& filter)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
 
     if (filter.isEmpty())
     {
@@ -1535,9 +1671,9 @@ QList<LibraryModel> DatabaseManager::getLibraryByDeviceIdAndFilter(int deviceId,
 
 QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
                 "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND d.Address = :Address "
                 "ORDER BY l.Id, l.DeviceId");
@@ -1557,9 +1693,9 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QStrin
 
 QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
                 "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND d.Address = :Address "
                 "ORDER BY l.Id, l.DeviceId");
@@ -1579,9 +1715,9 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QSt
 
 QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
                 "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND d.Address = :Address "
                 "ORDER BY l.Id, l.DeviceId");
@@ -1601,9 +1737,9 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString
 
 QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString& name, int deviceId)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
                 "WHERE  l.Name = :Name AND l.DeviceId = :DeviceId AND l.DeviceId = d.Id AND l.TypeId = t.Id");
     sql.bindValue(":Name", name);
@@ -1623,14 +1759,14 @@ QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString&
 
 void DatabaseManager::updateLibraryMedia(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
 
     if (deleteModels.count() > 0)
     {
@@ -1670,20 +1806,20 @@ void DatabaseManager::updateLibraryMedia(const QString& address, const QList<Lib
         }
     }
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateLibraryTemplate(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
     int typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName(Rundown::TEMPLATE))->getId();
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (deleteModels.count() > 0)
     {
         for (int i = 0; i < deleteModels.count(); i++)
@@ -1714,19 +1850,19 @@ void DatabaseManager::updateLibraryTemplate(const QString& address, const QList<
         }
     }
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::updateLibraryData(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (deleteModels.count() > 0)
     {
         for (int i = 0; i < deleteModels.count(); i++)
@@ -1768,16 +1904,16 @@ void DatabaseManager::updateLibraryData(const QString& address, const QList<Libr
         }
     }
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 void DatabaseManager::deleteLibrary(int deviceId)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("DELETE FROM Library "
                 "WHERE DeviceId = :DeviceId");
     sql.bindValue(":DeviceId", deviceId);
@@ -1785,14 +1921,14 @@ void DatabaseManager::deleteLibrary(int deviceId)
     if (!sql.exec())
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
 
 QList<ThumbnailModel> DatabaseManager::getThumbnailByDeviceAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
                 "WHERE d.Address = :Address AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
     sql.bindValue(":Address", address);
@@ -1810,9 +1946,9 @@ QList<ThumbnailModel> DatabaseManager::getThumbnailByDeviceAddress(const QString
 
 ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     sql.prepare("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Name, d.Address FROM Thumbnail t, Library l, Device d "
                 "WHERE l.Name = :Name AND d.Name = :DeviceName AND l.ThumbnailId = t.Id");
     sql.bindValue(":Name", name);
@@ -1829,14 +1965,14 @@ ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& n
 
 void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
     int deviceId = getDeviceByAddress(model.getAddress()).getId();
     const QList<LibraryModel>& libraryModels = getLibraryByNameAndDeviceId(model.getName(), deviceId);
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (libraryModels.count() > 0)
     {
         for (int i = 0; i < libraryModels.count(); i++)
@@ -1877,16 +2013,117 @@ void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
         }
     }
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
+}
+
+bool DatabaseManager::claimLibraryOwner(const QString& owner, qint64 staleLease)
+{
+    TRACE_FUNCTION("database");
+
+    beginTransaction();
+
+    // The lease is a generation counter rather than a timestamp, so the clocks of the clients never have
+    // to agree. We renew our own lease, or take over when nobody owns the library or the lease has not
+    // moved since the caller last saw it.
+    QSqlQuery sql(database());
+    sql.prepare("UPDATE LibrarySync SET Owner = :Owner, Lease = Lease + 1 "
+                "WHERE Owner = :CurrentOwner OR Owner = '' OR Lease = :StaleLease");
+    sql.bindValue(":Owner", owner);
+    sql.bindValue(":CurrentOwner", owner);
+    sql.bindValue(":StaleLease", staleLease);
+
+    bool claimed = false;
+    if (!sql.exec())
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+    else
+        claimed = sql.numRowsAffected() > 0;
+
+    commitTransaction();
+
+    return claimed;
+}
+
+void DatabaseManager::releaseLibraryOwner(const QString& owner)
+{
+    TRACE_FUNCTION("database");
+
+    beginTransaction();
+
+    QSqlQuery sql(database());
+    sql.prepare("UPDATE LibrarySync SET Owner = '', Lease = Lease + 1 "
+                "WHERE Owner = :Owner");
+    sql.bindValue(":Owner", owner);
+
+    if (!sql.exec())
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    commitTransaction();
+}
+
+qint64 DatabaseManager::getLibraryLease()
+{
+    TRACE_FUNCTION("database");
+
+    QSqlQuery sql(database());
+    if (!sql.exec("SELECT s.Lease FROM LibrarySync s"))
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    if (!sql.first())
+        return 0;
+
+    return sql.value(0).toLongLong();
+}
+
+QMap<QString, qint64> DatabaseManager::getLibraryVersions()
+{
+    TRACE_FUNCTION("database");
+
+    QSqlQuery sql(database());
+    if (!sql.exec("SELECT v.Type, v.Version FROM LibraryVersion v"))
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    QMap<QString, qint64> versions;
+    while (sql.next())
+        versions.insert(sql.value(0).toString(), sql.value(1).toLongLong());
+
+    return versions;
+}
+
+qint64 DatabaseManager::updateLibraryVersion(const QString& type)
+{
+    TRACE_FUNCTION("database");
+
+    beginTransaction();
+
+    QSqlQuery sql(database());
+    sql.prepare("UPDATE LibraryVersion SET Version = Version + 1 "
+                "WHERE Type = :Type");
+    sql.bindValue(":Type", type);
+
+    if (!sql.exec())
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    sql.prepare("SELECT v.Version FROM LibraryVersion v "
+                "WHERE v.Type = :Type");
+    sql.bindValue(":Type", type);
+
+    if (!sql.exec())
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    qint64 version = sql.first() ? sql.value(0).toLongLong() : 0;
+
+    commitTransaction();
+
+    return version;
 }
 
 void DatabaseManager::deleteThumbnails()
 {
-    QMutexLocker locker(&mutex);
+    TRACE_FUNCTION("database");
 
-    QSqlDatabase::database().transaction();
+    beginTransaction();
 
-    QSqlQuery sql;
+    QSqlQuery sql(database());
     if (!sql.exec("DELETE FROM Thumbnail"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
@@ -1905,5 +2142,5 @@ void DatabaseManager::deleteThumbnails()
         }
     }
 
-    QSqlDatabase::database().commit();
+    commitTransaction();
 }
@@ -39,8 +39,13 @@
 #include "Models/TriCaster/TriCasterDeviceModel.h"
 #include "Models/TriCaster/TriCasterNetworkTargetModel.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QMap>
 #include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QThreadStorage>
+
+class QSqlDatabase;
 
 class CORE_EXPORT DatabaseManager
 {
@@ -52,8 +57,15 @@ class CORE_EXPORT DatabaseManager
         void initialize();
         void uninitialize() {}
 
+        bool supportsThreadedAccess() const;
+        void closeThreadConnection();
+
+        void beginTransaction();
+        void commitTransaction();
+
         ConfigurationModel getConfigurationByName(const QString& name);
         void updateConfiguration(const ConfigurationModel& model);
+        void clearConfigurationCache();
 
         QList<FormatModel> getFormat();
         FormatModel getFormat(const QString& name);
@@ -65,7 +77,7 @@ class CORE_EXPORT DatabaseManager
         QList<PresetModel> getPreset();
         PresetModel getPreset(const QString& name);
         QList<PresetModel> getPresetByFilter(const QString& filter);
-        void insertPreset(const PresetModel& model);
+        int insertPreset(const PresetModel& model);
         void deletePreset(int id);
 
         QList<BlendModeModel> getBlendMode();
@@ -146,13 +158,34 @@ class CORE_EXPORT DatabaseManager
         void updateLibraryData(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels);
         void deleteLibrary(int deviceId);
 
+        bool claimLibraryOwner(const QString& owner, qint64 staleLease);
+        void releaseLibraryOwner(const QString& owner);
+        qint64 getLibraryLease();
+        QMap<QString, qint64> getLibraryVersions();
+        qint64 updateLibraryVersion(const QString& type);
+
         QList<ThumbnailModel> getThumbnailByDeviceAddress(const QString& address);
         ThumbnailModel getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName);
         void updateThumbnail(const ThumbnailModel& model);
         void deleteThumbnails();
 
     private:
-        QMutex mutex;
+        QString driverName;
+        QString hostName;
+        QString databaseName;
+        QString userName;
+        QString password;
+        int port = -1;
+        QString connectOptions;
+
+        QThreadStorage<int> transactionDepth;
+        QMutex writeMutex;
+
+        QMutex configurationMutex;
+        QHash<QString, ConfigurationModel> configurations;
+
+        QSqlDatabase database() const;
+        QString getThreadConnectionName() const;
 
         void createDatabase();
         void upgradeDatabase();
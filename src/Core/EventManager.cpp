@@ -1,4 +1,5 @@
 #include "EventManager.h"
+#include "Trace.h"
 
 #include <QtWidgets/QApplication>
 
@@ -23,346 +24,491 @@ void EventManager::uninitialize()
 
 void EventManager::fireClearDelayedCommands()
 {
+    TRACE_FUNCTION("event");
+
     emit clearDelayedCommands();
 }
 
 void EventManager::fireInsertRepositoryChangesEvent(const InsertRepositoryChangesEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit insertRepositoryChanges(event);
 }
 
 void EventManager::fireRepositoryRundownEvent(const RepositoryRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit repositoryRundown(event);
 }
 
 void EventManager::fireTriCasterDeviceChangedEvent(const TriCasterDeviceChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit tricasterDeviceChanged(event);
 }
 
 void EventManager::fireAtemDeviceChangedEvent(const AtemDeviceChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit atemDeviceChanged(event);
 }
 
 void EventManager::fireRemoveItemFromAutoPlayQueueEvent(const RemoveItemFromAutoPlayQueueEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit removeItemFromAutoPlayQueue(event);
 }
 
 void EventManager::fireClearCurrentPlayingItemEvent(const ClearCurrentPlayingItemEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit clearCurrentPlayingItem(event);
 }
 
 void EventManager::fireExecutePlayoutCommandEvent(const ExecutePlayoutCommandEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit executePlayoutCommand(event);
 }
 
 void EventManager::fireOpenRundownEvent(const OpenRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit openRundown(event);
 }
 
 void EventManager::fireOpenRundownMenuEvent(const OpenRundownMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit openRundownMenu(event);
 }
 
 void EventManager::fireDurationChangedEvent(const DurationChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit durationChanged(event);
 }
 
 void EventManager::fireReloadRundownMenuEvent(const ReloadRundownMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit reloadRundownMenu(event);
 }
 
 void EventManager::fireExportPresetMenuEvent(const ExportPresetMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit exportPresetMenu(event);
 }
 
 void EventManager::fireSaveAsPresetMenuEvent(const SaveAsPresetMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit saveAsPresetMenu(event);
 }
 
 void EventManager::fireSaveMenuEvent(const SaveMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit saveMenu(event);
 }
 
 void EventManager::fireSaveAsMenuEvent(const SaveAsMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit saveAsMenu(event);
 }
 
 void EventManager::fireToggleFullscreenEvent(const ToggleFullscreenEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit toggleFullscreen(event);
 }
 
 void EventManager::fireOpenRundownFromUrlEvent(const OpenRundownFromUrlEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit openRundownFromUrl(event);
 }
 
 void EventManager::fireSaveRundownEvent(const SaveRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit saveRundown(event);
 }
 
 void EventManager::fireCloseRundownEvent(const CloseRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit closeRundown(event);
 }
 
 void EventManager::fireReloadRundownEvent(const ReloadRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit reloadRundown(event);
 }
 
 void EventManager::fireAddTemplateDataEvent(const AddTemplateDataEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit addTemplateData(event);
 }
 
 void EventManager::fireShowAddTemplateDataDialogEvent(const ShowAddTemplateDataDialogEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit showAddTemplateDataDialog(event);
 }
 
 void EventManager::fireShowAddHttpGetDataDialogEvent(const ShowAddHttpGetDataDialogEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit showAddHttpGetDataDialog(event);
 }
 
 void EventManager::fireShowAddHttpPostDataDialogEvent(const ShowAddHttpPostDataDialogEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit showAddHttpPostDataDialog(event);
 }
 
 void EventManager::fireCurrentItemChangedEvent(const CurrentItemChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit currentItemChanged(event);
 }
 
 void EventManager::fireMarkItemAsUsedEvent(const MarkItemAsUsedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit markItemAsUsed(event);
 }
 
 void EventManager::fireMarkItemAsUnusedEvent(const MarkItemAsUnusedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit markItemAsUnused(event);
 }
 
 void EventManager::fireMarkAllItemsAsUsedEvent(const MarkAllItemsAsUsedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit markAllItemsAsUsed(event);
 }
 
 void EventManager::fireMarkAllItemsAsUnusedEvent(const MarkAllItemsAsUnusedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit markAllItemsAsUnused(event);
 }
 
 void EventManager::fireOscOutputChangedEvent(const OscOutputChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit oscOutputChanged(event);
 }
 
 void EventManager::fireRundownItemSelectedEvent(const RundownItemSelectedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit rundownItemSelected(event);
 }
 
 void EventManager::fireLibraryItemSelectedEvent(const LibraryItemSelectedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit libraryItemSelected(event);
 }
 
 void EventManager::fireDeleteRundownEvent(const DeleteRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit deleteRundown(event);
 }
 
 void EventManager::fireStatusbarEvent(const StatusbarEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit statusbar(event);
 }
 
 void EventManager::fireActiveRundownChangedEvent(const ActiveRundownChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit activeRundownChanged(event);
 }
 
 void EventManager::fireNewRundownEvent(const NewRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit newRundown(event);
 }
 
 void EventManager::fireNewRundownMenuEvent(const NewRundownMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit newRundownMenu(event);
 }
 
 void EventManager::fireOpenRundownFromUrlMenuEvent(const OpenRundownFromUrlMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit openRundownFromUrlMenu(event);
 }
 
 void EventManager::fireAllowRemoteTriggeringMenuEvent(const AllowRemoteTriggeringMenuEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit allowRemoteTriggeringMenu(event);
 }
 
 void EventManager::fireLibraryFilterChangedEvent(const LibraryFilterChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit libraryFilterChanged(event);
 }
 
 void EventManager::fireMediaChangedEvent(const MediaChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit mediaChanged(event);
 }
 
 void EventManager::fireTemplateChangedEvent(const TemplateChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit templateChanged(event);
 }
 
 void EventManager::fireDataChangedEvent(const DataChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit dataChanged(event);
 }
 
 void EventManager::fireImportPresetEvent(const ImportPresetEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit importPreset(event);
 }
 
 void EventManager::fireExportPresetEvent(const ExportPresetEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit exportPreset(event);
 }
 
 void EventManager::fireEmptyRundownEvent(const EmptyRundownEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit emptyRundown(event);
 }
 
 void EventManager::firePresetChangedEvent(const PresetChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit presetChanged(event);
 }
 
 void EventManager::fireRefreshLibraryEvent(const RefreshLibraryEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit refreshLibrary(event);
 }
 
 void EventManager::fireAutoRefreshLibraryEvent(const AutoRefreshLibraryEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit autoRefreshLibrary(event);
 }
 
 void EventManager::firePreviewEvent(const PreviewEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit preview(event);
 }
 
 void EventManager::fireChannelChangedEvent(const ChannelChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit channelChanged(event);
 }
 
 void EventManager::fireVideolayerChangedEvent(const VideolayerChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit videolayerChanged(event);
 }
 
 void EventManager::fireLabelChangedEvent(const LabelChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit labelChanged(event);
 }
 
 void EventManager::fireTargetChangedEvent(const TargetChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit targetChanged(event);
 }
 
 void EventManager::fireDeviceChangedEvent(const DeviceChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit deviceChanged(event);
 }
 
 void EventManager::fireAutoPlayNextRundownItemEvent(const AutoPlayNextRundownItemEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit autoPlayNextRundownItem(event);
 }
 
 void EventManager::fireAutoPlayChangedEvent(const AutoPlayChangedEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit autoPlayChanged(event);
 }
 
 void EventManager::fireSaveAsPresetEvent(const SaveAsPresetEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit saveAsPreset(event);
 }
 
 void EventManager::fireAutoPlayRundownItemEvent(const AutoPlayRundownItemEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit autoPlayRundownItem(event);
 }
 
 void EventManager::fireAddPresetItemEvent(const AddPresetItemEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit addPresetItem(event);
 }
 
 void EventManager::fireToggleCompactViewEvent(const CompactViewEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit toggleCompactView(event);
 }
 
 void EventManager::fireExecuteRundownItemEvent(const ExecuteRundownItemEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit executeRundownItem(event);
 }
 
 void EventManager::fireAllowRemoteTriggeringEvent(const AllowRemoteTriggeringEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit allowRemoteTriggering(event);
 }
 
 void EventManager::fireAddRudnownItemEvent(const LibraryModel& model)
 {
+    TRACE_FUNCTION("event");
+
     emit addRudnownItem(AddRudnownItemEvent(model));
 }
 
 void EventManager::fireCloseApplicationEvent(const CloseApplicationEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit closeApplication(CloseApplicationEvent(event));
 }
 
 void EventManager::fireCopyItemPropertiesEvent(const CopyItemPropertiesEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit copyItemProperties(CopyItemPropertiesEvent(event));
 }
 
 void EventManager::firePasteItemPropertiesEvent(const PasteItemPropertiesEvent& event)
 {
+    TRACE_FUNCTION("event");
+
     emit pasteItemProperties(PasteItemPropertiesEvent(event));
 }
 
+void EventManager::fireFindInRundownEvent(const FindInRundownEvent& event)
+{
+    TRACE_FUNCTION("event");
+
+    emit findInRundown(FindInRundownEvent(event));
+}
+
 void EventManager::fireAddRudnownItemEvent(const QString& type)
 {
+    TRACE_FUNCTION("event");
+
     if (type == Rundown::BLENDMODE)
         emit addRudnownItem(AddRudnownItemEvent(LibraryModel(0, "Blend Mode", "", "", Rundown::BLENDMODE, 0, "")));
     else if (type == Rundown::BRIGHTNESS)
@@ -68,6 +68,7 @@
 #include "Events/Rundown/SaveRundownEvent.h"
 #include "Events/Rundown/CopyItemPropertiesEvent.h"
 #include "Events/Rundown/PasteItemPropertiesEvent.h"
+#include "Events/Rundown/FindInRundownEvent.h"
 #include "Events/Rundown/InsertRepositoryChangesEvent.h"
 #include "Events/Rundown/ReloadRundownMenuEvent.h"
 #include "Events/Rundown/CurrentItemChangedEvent.h"
@@ -149,6 +150,7 @@ class CORE_EXPORT EventManager : public QObject
         Q_SIGNAL void closeApplication(const CloseApplicationEvent&);
         Q_SIGNAL void copyItemProperties(const CopyItemPropertiesEvent&);
         Q_SIGNAL void pasteItemProperties(const PasteItemPropertiesEvent&);
+        Q_SIGNAL void findInRundown(const FindInRundownEvent&);
         Q_SIGNAL void libraryFilterChanged(const LibraryFilterChangedEvent&);
         Q_SIGNAL void exportPresetMenu(const ExportPresetMenuEvent&);
         Q_SIGNAL void saveAsPresetMenu(const SaveAsPresetMenuEvent&);
@@ -223,6 +225,7 @@ class CORE_EXPORT EventManager : public QObject
         void fireCloseApplicationEvent(const CloseApplicationEvent&);
         void fireCopyItemPropertiesEvent(const CopyItemPropertiesEvent&);
         void firePasteItemPropertiesEvent(const PasteItemPropertiesEvent&);
+        void fireFindInRundownEvent(const FindInRundownEvent&);
         void fireLibraryFilterChangedEvent(const LibraryFilterChangedEvent&);
         void fireExportPresetMenuEvent(const ExportPresetMenuEvent&);
         void fireSaveAsPresetMenuEvent(const SaveAsPresetMenuEvent&);
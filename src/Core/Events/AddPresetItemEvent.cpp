@@ -2,12 +2,12 @@
 
 #include "Global.h"
 
-AddPresetItemEvent::AddPresetItemEvent(const QString& preset)
-    : preset(preset)
+AddPresetItemEvent::AddPresetItemEvent(int presetId)
+    : presetId(presetId)
 {
 }
 
-const QString& AddPresetItemEvent::getPreset() const
+int AddPresetItemEvent::getPresetId() const
 {
-    return this->preset;
+    return this->presetId;
 }
@@ -2,15 +2,13 @@
 
 #include "../Shared.h"
 
-#include <QtCore/QString>
-
 class CORE_EXPORT AddPresetItemEvent
 {
     public:
-        explicit AddPresetItemEvent(const QString& preset);
+        explicit AddPresetItemEvent(int presetId);
 
-        const QString& getPreset() const;
+        int getPresetId() const;
 
     private:
-        QString preset;
+        int presetId;
 };
@@ -0,0 +1,7 @@
+#include "FindInRundownEvent.h"
+
+#include "Global.h"
+
+FindInRundownEvent::FindInRundownEvent()
+{
+}
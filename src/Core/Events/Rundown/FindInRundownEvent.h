@@ -0,0 +1,11 @@
+#pragma once
+
+#include "../../Shared.h"
+
+#include <QtCore/QString>
+
+class CORE_EXPORT FindInRundownEvent
+{
+    public:
+        explicit FindInRundownEvent();
+};
@@ -0,0 +1,125 @@
+#include "AbstractCommandExecutor.h"
+
+#include "DatabaseManager.h"
+#include "DeviceManager.h"
+
+#include <math.h>
+
+#include <QtCore/QStringList>
+
+AbstractCommandExecutor::AbstractCommandExecutor(const LibraryModel* model, QObject* parent)
+    : QObject(parent),
+      model(model)
+{
+    this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
+
+    this->startTimer.setSingleShot(true);
+    this->stopTimer.setSingleShot(true);
+    this->previewStartTimer.setSingleShot(true);
+    this->previewStopTimer.setSingleShot(true);
+}
+
+AbstractCommandExecutor::~AbstractCommandExecutor()
+{
+}
+
+void AbstractCommandExecutor::clearDelayedCommands()
+{
+    stopTimers();
+}
+
+void AbstractCommandExecutor::stopTimers()
+{
+    this->startTimer.stop();
+    this->stopTimer.stop();
+    this->previewStartTimer.stop();
+    this->previewStopTimer.stop();
+}
+
+QList<AbstractCommandExecutor::Target> AbstractCommandExecutor::getTargets() const
+{
+    QList<Target> targets;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
+    if (device != NULL && device->isConnected())
+    {
+        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model->getDeviceName());
+
+        Target target = { device, (deviceModel != NULL) ? deviceModel->getPreviewChannel() : 0 };
+        targets.append(target);
+    }
+
+    // Shadow devices mirror everything the item's own device is told.
+    foreach (const DeviceModel& deviceModel, DeviceManager::getInstance().getDeviceModels())
+    {
+        if (deviceModel.getShadow() == "No")
+            continue;
+
+        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(deviceModel.getName());
+        if (deviceShadow != NULL && deviceShadow->isConnected())
+        {
+            Target target = { deviceShadow, deviceModel.getPreviewChannel() };
+            targets.append(target);
+        }
+    }
+
+    return targets;
+}
+
+bool AbstractCommandExecutor::schedule(const AbstractCommand& command, bool preview, const char* startMember, const char* stopMember)
+{
+    if (command.getDelay() < 0)
+        return false;
+
+    if (this->model->getDeviceName().isEmpty()) // The user need to select a device.
+        return false;
+
+    QTimer& startTimer = (preview) ? this->previewStartTimer : this->startTimer;
+    QTimer& stopTimer = (preview) ? this->previewStopTimer : this->stopTimer;
+
+    int channel = command.getChannel();
+    if (preview)
+    {
+        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model->getDeviceName());
+        if (deviceModel == NULL || deviceModel->getPreviewChannel() == 0)
+            return false;
+
+        channel = deviceModel->getPreviewChannel();
+    }
+
+    int startDelay = command.getDelay();
+    int stopDelay = (command.getDuration() > 0) ? command.getDelay() + command.getDuration() : 0;
+
+    if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
+    {
+        const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(this->model->getDeviceName()).getChannelFormats().split(",");
+        if (channel > channelFormats.count())
+            return false;
+
+        double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[channel - 1]).getFramesPerSecond().toDouble();
+
+        startDelay = floor(command.getDelay() * (1000 / framesPerSecond));
+        if (command.getDuration() > 0)
+            stopDelay = startDelay + floor(command.getDuration() * (1000 / framesPerSecond));
+    }
+
+    startTimer.disconnect(); // Disconnect all events.
+    QObject::connect(&startTimer, SIGNAL(timeout()), this, startMember);
+    startTimer.setInterval(startDelay);
+    startTimer.start();
+
+    // Only a command that stops again owns the stop timer, an update must not cancel the pending stop of a play.
+    if (stopMember != NULL)
+    {
+        stopTimer.stop();
+        if (stopDelay > 0)
+        {
+            stopTimer.disconnect(); // Disconnect all events.
+            QObject::connect(&stopTimer, SIGNAL(timeout()), this, stopMember);
+            stopTimer.setInterval(stopDelay);
+            stopTimer.start();
+        }
+    }
+
+    return true;
+}
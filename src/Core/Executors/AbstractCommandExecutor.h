@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include "Global.h"
+#include "Playout.h"
+
+#include "CasparDevice.h"
+
+#include "Commands/AbstractCommand.h"
+#include "Models/LibraryModel.h"
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+// Runs the playout commands of one rundown item against the servers, the item's own device and every shadow
+// device. The rundown widgets and the headless runner share these, so an item behaves the same with or
+// without a GUI. Delay and duration are scheduled here too, in frames or milliseconds as configured.
+class CORE_EXPORT AbstractCommandExecutor : public QObject
+{
+    Q_OBJECT
+
+    public:
+        virtual ~AbstractCommandExecutor();
+
+        virtual bool execute(Playout::PlayoutType type) = 0;
+        virtual void clearDelayedCommands();
+
+        Q_SIGNAL void executed(Playout::PlayoutType);
+
+    protected:
+        explicit AbstractCommandExecutor(const LibraryModel* model, QObject* parent = 0);
+
+        struct Target
+        {
+            QSharedPointer<CasparDevice> device;
+            int previewChannel;
+        };
+
+        const LibraryModel* model;
+        QString delayType;
+
+        QTimer startTimer;
+        QTimer stopTimer;
+        QTimer previewStartTimer;
+        QTimer previewStopTimer;
+
+        QList<Target> getTargets() const;
+        bool schedule(const AbstractCommand& command, bool preview, const char* startMember, const char* stopMember = NULL);
+        void stopTimers();
+};
@@ -0,0 +1,259 @@
+#include "MovieCommandExecutor.h"
+
+MovieCommandExecutor::MovieCommandExecutor(const MovieCommand* command, const LibraryModel* model, QObject* parent)
+    : AbstractCommandExecutor(model, parent),
+      command(command), loaded(false), paused(false), playing(false)
+{
+}
+
+bool MovieCommandExecutor::isLoaded() const
+{
+    return this->loaded;
+}
+
+bool MovieCommandExecutor::isPaused() const
+{
+    return this->paused;
+}
+
+bool MovieCommandExecutor::isPlaying() const
+{
+    return this->playing;
+}
+
+void MovieCommandExecutor::setState(bool loaded, bool paused, bool playing)
+{
+    this->loaded = loaded;
+    this->paused = paused;
+    this->playing = playing;
+}
+
+void MovieCommandExecutor::setPlaying(bool playing)
+{
+    this->playing = playing;
+}
+
+void MovieCommandExecutor::clearDelayedCommands()
+{
+    AbstractCommandExecutor::clearDelayedCommands();
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = false;
+}
+
+bool MovieCommandExecutor::execute(Playout::PlayoutType type)
+{
+    if (type == Playout::PlayoutType::Stop)
+        stop();
+    else if ((type == Playout::PlayoutType::Play && !this->command->getTriggerOnNext()) || type == Playout::PlayoutType::Update)
+    {
+        if (this->command->getAutoPlay())
+        {
+            if (this->command->getDelay() >= 0)
+                play();
+        }
+        else
+            schedule(*this->command, false, SLOT(play()), SLOT(stop()));
+    }
+    else if (type == Playout::PlayoutType::PlayNow)
+        play();
+    else if (type == Playout::PlayoutType::PauseResume)
+        pause();
+    else if (type == Playout::PlayoutType::Load)
+        load();
+    else if (type == Playout::PlayoutType::Next)
+    {
+        if (this->command->getAutoPlay())
+            next();
+        else if (this->command->getTriggerOnNext())
+            play();
+    }
+    else if (type == Playout::PlayoutType::Clear || type == Playout::PlayoutType::ClearVideoLayer)
+        clearVideolayer();
+    else if (type == Playout::PlayoutType::ClearChannel)
+        clearChannel();
+    else if (type == Playout::PlayoutType::Preview)
+        loadPreview();
+
+    return true;
+}
+
+void MovieCommandExecutor::playMovie(CasparDevice& device, bool autoPlay)
+{
+    device.playMovie(this->command->getChannel(), this->command->getVideolayer(), this->command->getVideoName(),
+                     this->command->getTransition(), this->command->getTransitionDuration(), this->command->getTween(),
+                     this->command->getDirection(), this->command->getSeek(), this->command->getLength(),
+                     this->command->getLoop(), autoPlay);
+}
+
+void MovieCommandExecutor::stop()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->stop(this->command->getChannel(), this->command->getVideolayer());
+
+        // Stop preview channels item.
+        if (target.previewChannel > 0)
+            target.device->stop(target.previewChannel, this->command->getVideolayer());
+    }
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = false;
+
+    emit executed(Playout::PlayoutType::Stop);
+}
+
+void MovieCommandExecutor::play()
+{
+    foreach (const Target& target, getTargets())
+    {
+        if (this->loaded)
+            target.device->play(this->command->getChannel(), this->command->getVideolayer());
+        else
+            playMovie(*target.device, this->command->getAutoPlay());
+    }
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = true;
+
+    emit executed(Playout::PlayoutType::Play);
+}
+
+void MovieCommandExecutor::pause()
+{
+    if (!this->playing)
+        return;
+
+    foreach (const Target& target, getTargets())
+    {
+        if (this->paused)
+            target.device->resume(this->command->getChannel(), this->command->getVideolayer());
+        else
+            target.device->pause(this->command->getChannel(), this->command->getVideolayer());
+    }
+
+    this->paused = !this->paused;
+
+    emit executed(Playout::PlayoutType::PauseResume);
+}
+
+void MovieCommandExecutor::load()
+{
+    foreach (const Target& target, getTargets())
+    {
+        target.device->loadMovie(this->command->getChannel(), this->command->getVideolayer(), this->command->getVideoName(),
+                                 this->command->getTransition(), this->command->getTransitionDuration(), this->command->getTween(),
+                                 this->command->getDirection(), this->command->getSeek(), this->command->getLength(),
+                                 this->command->getLoop(), this->command->getFreezeOnLoad(), false);
+    }
+
+    this->loaded = true;
+    this->paused = false;
+    this->playing = false;
+
+    emit executed(Playout::PlayoutType::Load);
+}
+
+bool MovieCommandExecutor::queue()
+{
+    // As with play, an AutoPlay clip only takes a negative delay to mean disabled. The server starts it
+    // the moment the clip on air ends, there is no point in time left for a positive delay to count from.
+    if (this->command->getDelay() < 0)
+        return false;
+
+    // Loaded into the background behind the clip on air, the server plays it when that clip ends.
+    foreach (const Target& target, getTargets())
+    {
+        target.device->loadMovie(this->command->getChannel(), this->command->getVideolayer(), this->command->getVideoName(),
+                                 this->command->getTransition(), this->command->getTransitionDuration(), this->command->getTween(),
+                                 this->command->getDirection(), this->command->getSeek(), this->command->getLength(),
+                                 this->command->getLoop(), false, true);
+    }
+
+    // Not playing until OSC reports the clip on the layer.
+    this->loaded = false;
+    this->paused = false;
+    this->playing = false;
+
+    return true;
+}
+
+void MovieCommandExecutor::loadPreview()
+{
+    foreach (const Target& target, getTargets())
+    {
+        if (target.previewChannel == 0)
+            continue;
+
+        target.device->loadMovie(target.previewChannel, this->command->getVideolayer(), this->command->getVideoName(),
+                                 this->command->getTransition(), this->command->getTransitionDuration(), this->command->getTween(),
+                                 this->command->getDirection(), this->command->getSeek(), this->command->getLength(),
+                                 this->command->getLoop(), true, false);
+    }
+
+    emit executed(Playout::PlayoutType::Preview);
+}
+
+void MovieCommandExecutor::next()
+{
+    if (!this->command->getAutoPlay())
+        return;
+
+    foreach (const Target& target, getTargets())
+        playMovie(*target.device, false);
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = true;
+
+    emit executed(Playout::PlayoutType::Next);
+}
+
+void MovieCommandExecutor::clearVideolayer()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->clearVideolayer(this->command->getChannel(), this->command->getVideolayer());
+
+        // Clear preview channels videolayer.
+        if (target.previewChannel > 0)
+            target.device->clearVideolayer(target.previewChannel, this->command->getVideolayer());
+    }
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = false;
+
+    emit executed(Playout::PlayoutType::ClearVideoLayer);
+}
+
+void MovieCommandExecutor::clearChannel()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->clearChannel(this->command->getChannel());
+        target.device->clearMixerChannel(this->command->getChannel());
+
+        // Clear preview channel.
+        if (target.previewChannel > 0)
+        {
+            target.device->clearChannel(target.previewChannel);
+            target.device->clearMixerChannel(target.previewChannel);
+        }
+    }
+
+    this->paused = false;
+    this->loaded = false;
+    this->playing = false;
+
+    emit executed(Playout::PlayoutType::ClearChannel);
+}
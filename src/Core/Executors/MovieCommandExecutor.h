@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../Shared.h"
+#include "AbstractCommandExecutor.h"
+
+#include "Commands/MovieCommand.h"
+
+#include <QtCore/QObject>
+
+class CORE_EXPORT MovieCommandExecutor : public AbstractCommandExecutor
+{
+    Q_OBJECT
+
+    public:
+        explicit MovieCommandExecutor(const MovieCommand* command, const LibraryModel* model, QObject* parent = 0);
+
+        virtual bool execute(Playout::PlayoutType type);
+        virtual void clearDelayedCommands();
+
+        bool queue();
+
+        bool isLoaded() const;
+        bool isPaused() const;
+        bool isPlaying() const;
+
+        void setState(bool loaded, bool paused, bool playing);
+        void setPlaying(bool playing);
+
+    private:
+        const MovieCommand* command;
+
+        bool loaded;
+        bool paused;
+        bool playing;
+
+        void playMovie(CasparDevice& device, bool autoPlay);
+
+        Q_SLOT void stop();
+        Q_SLOT void play();
+        Q_SLOT void pause();
+        Q_SLOT void load();
+        Q_SLOT void next();
+        Q_SLOT void loadPreview();
+        Q_SLOT void clearVideolayer();
+        Q_SLOT void clearChannel();
+};
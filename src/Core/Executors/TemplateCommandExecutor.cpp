@@ -0,0 +1,262 @@
+#include "TemplateCommandExecutor.h"
+
+TemplateCommandExecutor::TemplateCommandExecutor(const TemplateCommand* command, const LibraryModel* model, QObject* parent)
+    : AbstractCommandExecutor(model, parent),
+      command(command), loaded(false), onAir(false)
+{
+}
+
+bool TemplateCommandExecutor::isLoaded() const
+{
+    return this->loaded;
+}
+
+void TemplateCommandExecutor::setLoaded(bool loaded)
+{
+    this->loaded = loaded;
+}
+
+void TemplateCommandExecutor::clearDelayedCommands()
+{
+    AbstractCommandExecutor::clearDelayedCommands();
+
+    this->loaded = false;
+    setOnAir(false);
+}
+
+void TemplateCommandExecutor::setOnAir(bool onAir)
+{
+    this->onAir = onAir;
+
+    if (onAir)
+        this->sentModels = this->command->getTemplateDataModels();
+    else
+        this->sentModels.clear();
+}
+
+bool TemplateCommandExecutor::execute(Playout::PlayoutType type)
+{
+    if (type == Playout::PlayoutType::Stop)
+        stop();
+    else if (type == Playout::PlayoutType::Play && !this->command->getTriggerOnNext())
+        schedule(*this->command, false, SLOT(play()), SLOT(stop()));
+    else if (type == Playout::PlayoutType::PlayNow)
+        play();
+    else if (type == Playout::PlayoutType::Update)
+        schedule(*this->command, false, SLOT(update()));
+    else if (type == Playout::PlayoutType::Load)
+        load();
+    else if (type == Playout::PlayoutType::Next)
+    {
+        if (this->command->getTriggerOnNext())
+            play();
+        else
+            next();
+    }
+    else if (type == Playout::PlayoutType::Invoke)
+        invoke();
+    else if (type == Playout::PlayoutType::Clear)
+        clear();
+    else if (type == Playout::PlayoutType::ClearVideoLayer)
+        clearVideolayer();
+    else if (type == Playout::PlayoutType::ClearChannel)
+        clearChannel();
+    else if (type == Playout::PlayoutType::Preview)
+        schedule(*this->command, true, SLOT(playPreview()), SLOT(stopPreview()));
+
+    return true;
+}
+
+void TemplateCommandExecutor::playTemplate(CasparDevice& device, int channel, const QString& templateData)
+{
+    if (templateData.isEmpty())
+        device.playTemplate(channel, this->command->getVideolayer(), this->command->getFlashlayer(), this->command->getTemplateName());
+    else
+        device.playTemplate(channel, this->command->getVideolayer(), this->command->getFlashlayer(), this->command->getTemplateName(), templateData);
+}
+
+void TemplateCommandExecutor::stop()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->stopTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer());
+
+        // Stop preview channels item.
+        if (target.previewChannel > 0)
+            target.device->stopTemplate(target.previewChannel, this->command->getVideolayer(), this->command->getFlashlayer());
+    }
+
+    this->loaded = false;
+    setOnAir(false);
+
+    emit executed(Playout::PlayoutType::Stop);
+}
+
+void TemplateCommandExecutor::stopPreview()
+{
+    this->previewStartTimer.stop();
+    this->previewStopTimer.stop();
+
+    foreach (const Target& target, getTargets())
+    {
+        if (target.previewChannel > 0)
+            target.device->stopTemplate(target.previewChannel, this->command->getVideolayer(), this->command->getFlashlayer());
+    }
+}
+
+void TemplateCommandExecutor::play()
+{
+    // Built once, the same data goes to every server.
+    const QString templateData = (this->loaded) ? QString() : this->command->getTemplateData();
+
+    foreach (const Target& target, getTargets())
+    {
+        if (this->loaded)
+            target.device->playTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer());
+        else
+            playTemplate(*target.device, this->command->getChannel(), templateData);
+    }
+
+    // A loaded template got its data with the load.
+    if (!this->loaded)
+        setOnAir(true);
+
+    this->loaded = false;
+
+    emit executed(Playout::PlayoutType::Play);
+}
+
+void TemplateCommandExecutor::playPreview()
+{
+    const QString templateData = this->command->getTemplateData();
+
+    foreach (const Target& target, getTargets())
+    {
+        if (target.previewChannel > 0)
+            playTemplate(*target.device, target.previewChannel, templateData);
+    }
+
+    emit executed(Playout::PlayoutType::Preview);
+}
+
+void TemplateCommandExecutor::load()
+{
+    const QString templateData = this->command->getTemplateData();
+
+    foreach (const Target& target, getTargets())
+    {
+        if (templateData.isEmpty())
+            target.device->addTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer(),
+                                       this->command->getTemplateName(), false);
+        else
+            target.device->addTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer(),
+                                       this->command->getTemplateName(), false, templateData);
+    }
+
+    this->loaded = true;
+    setOnAir(true);
+
+    emit executed(Playout::PlayoutType::Load);
+}
+
+void TemplateCommandExecutor::next()
+{
+    foreach (const Target& target, getTargets())
+        target.device->nextTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer());
+
+    emit executed(Playout::PlayoutType::Next);
+}
+
+void TemplateCommandExecutor::update()
+{
+    QString templateData;
+    if (this->command->getUpdateChangedOnly() && this->onAir)
+    {
+        templateData = this->command->getTemplateData(this->sentModels);
+        if (templateData.isEmpty())
+        {
+            qDebug("Nothing changed in %s, no update sent", qPrintable(this->command->getTemplateName()));
+            return;
+        }
+    }
+    else
+        templateData = this->command->getTemplateData();
+
+    foreach (const Target& target, getTargets())
+        target.device->updateTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer(), templateData);
+
+    setOnAir(true);
+
+    emit executed(Playout::PlayoutType::Update);
+}
+
+void TemplateCommandExecutor::invoke()
+{
+    foreach (const Target& target, getTargets())
+        target.device->invokeTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer(), this->command->getInvoke());
+
+    emit executed(Playout::PlayoutType::Invoke);
+}
+
+void TemplateCommandExecutor::clear()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->removeTemplate(this->command->getChannel(), this->command->getVideolayer(), this->command->getFlashlayer());
+
+        // Clear preview channels item.
+        if (target.previewChannel > 0)
+            target.device->removeTemplate(target.previewChannel, this->command->getVideolayer(), this->command->getFlashlayer());
+    }
+
+    this->loaded = false;
+    setOnAir(false);
+
+    emit executed(Playout::PlayoutType::Clear);
+}
+
+void TemplateCommandExecutor::clearVideolayer()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->clearVideolayer(this->command->getChannel(), this->command->getVideolayer());
+
+        // Clear preview channels videolayer.
+        if (target.previewChannel > 0)
+            target.device->clearVideolayer(target.previewChannel, this->command->getVideolayer());
+    }
+
+    this->loaded = false;
+    setOnAir(false);
+
+    emit executed(Playout::PlayoutType::ClearVideoLayer);
+}
+
+void TemplateCommandExecutor::clearChannel()
+{
+    stopTimers();
+
+    foreach (const Target& target, getTargets())
+    {
+        target.device->clearChannel(this->command->getChannel());
+        target.device->clearMixerChannel(this->command->getChannel());
+
+        // Clear preview channel.
+        if (target.previewChannel > 0)
+        {
+            target.device->clearChannel(target.previewChannel);
+            target.device->clearMixerChannel(target.previewChannel);
+        }
+    }
+
+    this->loaded = false;
+    setOnAir(false);
+
+    emit executed(Playout::PlayoutType::ClearChannel);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../Shared.h"
+#include "AbstractCommandExecutor.h"
+
+#include "Commands/TemplateCommand.h"
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+
+class CORE_EXPORT TemplateCommandExecutor : public AbstractCommandExecutor
+{
+    Q_OBJECT
+
+    public:
+        explicit TemplateCommandExecutor(const TemplateCommand* command, const LibraryModel* model, QObject* parent = 0);
+
+        virtual bool execute(Playout::PlayoutType type);
+        virtual void clearDelayedCommands();
+
+        bool isLoaded() const;
+        void setLoaded(bool loaded);
+
+    private:
+        const TemplateCommand* command;
+
+        bool loaded;
+
+        // What the template on the output channel was last given, a changed only update is diffed against it.
+        bool onAir;
+        QList<KeyValueModel> sentModels;
+
+        void setOnAir(bool onAir);
+
+        void playTemplate(CasparDevice& device, int channel, const QString& templateData);
+
+        Q_SLOT void stop();
+        Q_SLOT void stopPreview();
+        Q_SLOT void play();
+        Q_SLOT void playPreview();
+        Q_SLOT void load();
+        Q_SLOT void next();
+        Q_SLOT void update();
+        Q_SLOT void invoke();
+        Q_SLOT void clear();
+        Q_SLOT void clearVideolayer();
+        Q_SLOT void clearChannel();
+};
@@ -2,13 +2,34 @@
 
 #include "DatabaseManager.h"
 
+#include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
 
 #include <QtWidgets/QApplication>
 
 Q_GLOBAL_STATIC(GpiManager, gpiManager)
 
+namespace
+{
+    const int LATENCY_BOUNDS[Gpi::LATENCY_BUCKET_COUNT - 1] = { 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 250000 };
+
+    const QEvent::Type GPI_TRIGGER_EVENT = static_cast<QEvent::Type>(QEvent::registerEventType());
+
+    class GpiTriggerEvent : public QEvent
+    {
+        public:
+            GpiTriggerEvent(int port, qint64 timestamp)
+                : QEvent(GPI_TRIGGER_EVENT), port(port), timestamp(timestamp)
+            {
+            }
+
+            int port;
+            qint64 timestamp;
+    };
+}
+
 GpiManager::GpiManager()
+    : latencyHistogram(Gpi::LATENCY_BUCKET_COUNT, 0), triggerCount(0), totalLatency(0), maxLatency(0)
 {
 }
 
@@ -24,6 +45,9 @@ void GpiManager::initialize()
 
     this->device = GpiDevice::Ptr(new GpiDevice(serialPort, baudRate));
 
+    // Direct, the slot only posts the trigger and is safe to run on the gpio-client thread.
+    QObject::connect(this->device.data(), SIGNAL(gpiTriggered(int, qint64, GpiDevice*)), this, SLOT(postTrigger(int, qint64, GpiDevice*)), Qt::DirectConnection);
+
     setupPorts();
 }
 
@@ -45,6 +69,9 @@ void GpiManager::setupPorts()
 {
     DatabaseManager& database = DatabaseManager::getInstance();
 
+    QString debounceTime = database.getConfigurationByName("GpiDebounceTime").getValue();
+    this->device->setDebounceTime((debounceTime.isEmpty()) ? Gpi::DEFAULT_DEBOUNCE_TIME : debounceTime.toInt());
+
     foreach (const GpiPortModel gpiPort, database.getGpiPorts())
         this->device->setupGpiPort(gpiPort.getPort(), gpiPort.isRisingEdge());
 
@@ -56,3 +83,75 @@ GpiDevice::Ptr GpiManager::getGpiDevice()
 {
     return device;
 }
+
+void GpiManager::postTrigger(int gpiPort, qint64 timestamp, GpiDevice* device)
+{
+    Q_UNUSED(device);
+
+    QCoreApplication::postEvent(this, new GpiTriggerEvent(gpiPort, timestamp), Qt::HighEventPriority);
+}
+
+void GpiManager::customEvent(QEvent* event)
+{
+    if (event->type() != GPI_TRIGGER_EVENT)
+        return;
+
+    const GpiTriggerEvent* trigger = static_cast<const GpiTriggerEvent*>(event);
+
+    emit gpiTriggered(trigger->port, trigger->timestamp);
+
+    // The AMCP writes are queued to the network threads by now, unless the item has a delay.
+    recordLatency(this->device->getTime() - trigger->timestamp);
+}
+
+void GpiManager::recordLatency(qint64 latency)
+{
+    int bucket = 0;
+    while (bucket < Gpi::LATENCY_BUCKET_COUNT - 1 && latency >= LATENCY_BOUNDS[bucket])
+        bucket++;
+
+    this->latencyHistogram[bucket]++;
+    this->triggerCount++;
+    this->totalLatency += latency;
+    this->maxLatency = qMax(this->maxLatency, latency);
+}
+
+QList<GpiManager::LatencyBucket> GpiManager::getLatencyHistogram() const
+{
+    QList<LatencyBucket> histogram;
+    for (int i = 0; i < Gpi::LATENCY_BUCKET_COUNT; i++)
+    {
+        LatencyBucket bucket = { (i < Gpi::LATENCY_BUCKET_COUNT - 1) ? LATENCY_BOUNDS[i] : -1, this->latencyHistogram.at(i) };
+        histogram.append(bucket);
+    }
+
+    return histogram;
+}
+
+int GpiManager::getTriggerCount() const
+{
+    return this->triggerCount;
+}
+
+int GpiManager::getDebouncedCount() const
+{
+    return (this->device != NULL) ? this->device->getDebouncedCount() : 0;
+}
+
+qint64 GpiManager::getAverageLatency() const
+{
+    return (this->triggerCount > 0) ? this->totalLatency / this->triggerCount : 0;
+}
+
+qint64 GpiManager::getMaxLatency() const
+{
+    return this->maxLatency;
+}
+
+void GpiManager::resetLatency()
+{
+    this->latencyHistogram.fill(0);
+    this->triggerCount = 0;
+    this->totalLatency = 0;
+    this->maxLatency = 0;
+}
@@ -2,16 +2,29 @@
 
 #include "Shared.h"
 
+#include "Global.h"
+
 #include "GpiDevice.h"
 
+#include <QtCore/QEvent>
 #include <QtCore/QObject>
 #include <QtCore/QList>
+#include <QtCore/QVector>
 
+// Triggers are taken off the gpio-client thread as posted events of high priority, so on a busy GUI thread
+// they are handled ahead of anything queued before them. The time from the pulse until the bound command
+// has been handed to the AMCP connections is kept in a histogram.
 class CORE_EXPORT GpiManager : public QObject
 {
     Q_OBJECT
 
     public:
+        struct LatencyBucket
+        {
+            int upperBound; // Microseconds, -1 for everything above the last bound.
+            int count;
+        };
+
         explicit GpiManager();
 
         static GpiManager& getInstance();
@@ -22,8 +35,29 @@ class CORE_EXPORT GpiManager : public QObject
 
         GpiDevice::Ptr getGpiDevice();
 
+        QList<LatencyBucket> getLatencyHistogram() const;
+        int getTriggerCount() const;
+        int getDebouncedCount() const;
+        qint64 getAverageLatency() const;
+        qint64 getMaxLatency() const;
+        void resetLatency();
+
+        // Handlers run on the GUI thread and execute the bound command before returning.
+        Q_SIGNAL void gpiTriggered(int, qint64);
+
+    protected:
+        void customEvent(QEvent* event);
+
     private:
+        GpiDevice::Ptr device;
+
+        QVector<int> latencyHistogram;
+        int triggerCount;
+        qint64 totalLatency;
+        qint64 maxLatency;
+
         void setupPorts();
+        void recordLatency(qint64 latency);
 
-        GpiDevice::Ptr device;
+        Q_SLOT void postTrigger(int, qint64, GpiDevice*);
 };
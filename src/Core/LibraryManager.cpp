@@ -1,20 +1,28 @@
 #include "LibraryManager.h"
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
+#include "PresetManager.h"
 #include "AtemDeviceManager.h"
 #include "TriCasterDeviceManager.h"
 #include "Events/StatusbarEvent.h"
 #include "Events/MediaChangedEvent.h"
 #include "Events/DataChangedEvent.h"
+#include "Events/PresetChangedEvent.h"
 #include "Events/Inspector/TemplateChangedEvent.h"
 #include "Models/DeviceModel.h"
 
+#include "Trace.h"
+
+#include <QtCore/QCoreApplication>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QTime>
 #include <QtCore/QTimer>
 #include <QtCore/QStringList>
 
+#include <QtNetwork/QHostInfo>
+
 #include <QtWidgets/QApplication>
 
 Q_GLOBAL_STATIC(LibraryManager, libraryManager)
@@ -23,6 +31,7 @@ LibraryManager::LibraryManager(QObject* parent)
     : QObject(parent)
 {
     QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    QObject::connect(&this->syncTimer, SIGNAL(timeout()), this, SLOT(synchronize()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceRemoved()), this, SLOT(deviceRemoved()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(autoRefreshLibrary(const AutoRefreshLibraryEvent&)), this, SLOT(autoRefreshLibrary(const AutoRefreshLibraryEvent&)));
@@ -36,6 +45,18 @@ LibraryManager& LibraryManager::getInstance()
 
 void LibraryManager::initialize()
 {
+    // With a shared database only one client talks to the servers, the others follow the change log.
+    this->shareLibrary = (DatabaseManager::getInstance().getConfigurationByName("ShareLibrary").getValue() == "true") ? true : false;
+    if (this->shareLibrary)
+    {
+        this->ownerName = QString("%1:%2").arg(QHostInfo::localHostName()).arg(QCoreApplication::applicationPid());
+        this->libraryVersions = DatabaseManager::getInstance().getLibraryVersions();
+        this->configurationVersion = this->libraryVersions.value("CONFIGURATION");
+
+        this->syncTimer.setInterval(Library::SYNC_INTERVAL);
+        this->syncTimer.start();
+    }
+
     EventManager::getInstance().fireRefreshLibraryEvent(RefreshLibraryEvent(0));
     EventManager::getInstance().fireAutoRefreshLibraryEvent(AutoRefreshLibraryEvent((DatabaseManager::getInstance().getConfigurationByName("AutoRefreshLibrary").getValue() == "true") ? true : false,
                                                                                     DatabaseManager::getInstance().getConfigurationByName("RefreshLibraryInterval").getValue().toInt() * 1000));
@@ -43,6 +64,126 @@ void LibraryManager::initialize()
 
 void LibraryManager::uninitialize()
 {
+    this->syncTimer.stop();
+
+    // Let another client take over right away instead of waiting for our lease to run out.
+    if (this->libraryOwner)
+        DatabaseManager::getInstance().releaseLibraryOwner(this->ownerName);
+}
+
+bool LibraryManager::isLibraryWriter() const
+{
+    return !this->shareLibrary || this->libraryOwner;
+}
+
+void LibraryManager::synchronize()
+{
+    // The owner bumps the lease on every renewal. We only take over once it has stood still for a whole
+    // lease period, measured on our own clock.
+    qint64 staleLease = (this->leaseTimer.isValid() && this->leaseTimer.elapsed() > Library::OWNER_LEASE) ? this->ownerLease : -1;
+
+    QString ownerName = this->ownerName;
+    AsyncDatabaseManager::getInstance().read<QPair<bool, qint64>>([ownerName, staleLease]()
+    {
+        QPair<bool, qint64> lease;
+        lease.first = DatabaseManager::getInstance().claimLibraryOwner(ownerName, staleLease);
+        lease.second = DatabaseManager::getInstance().getLibraryLease();
+
+        return lease;
+    }, this, [this](const QPair<bool, qint64>& lease)
+    {
+        if (lease.second != this->ownerLease)
+        {
+            this->ownerLease = lease.second;
+            this->leaseTimer.start();
+        }
+
+        if (lease.first != this->libraryOwner)
+            ownerChanged(lease.first);
+
+        AsyncDatabaseManager::getInstance().read<QMap<QString, qint64>>([]()
+        {
+            return DatabaseManager::getInstance().getLibraryVersions();
+        }, this, [this](const QMap<QString, qint64>& versions)
+        {
+            applyLibraryVersions(versions);
+        });
+    });
+}
+
+void LibraryManager::ownerChanged(bool owner)
+{
+    this->libraryOwner = owner;
+
+    if (owner)
+    {
+        qDebug("Library owner is now %s", qPrintable(this->ownerName));
+
+        refresh();
+    }
+    else
+    {
+        qDebug("Library ownership lost by %s", qPrintable(this->ownerName));
+
+        this->thumbnailWorkers.clear();
+    }
+}
+
+void LibraryManager::applyLibraryVersions(const QMap<QString, qint64>& versions)
+{
+    // Every client writes presets and settings, so the owner follows them as well.
+    reloadPresets(versions.value("PRESET"));
+
+    if (versions.value("CONFIGURATION") != this->configurationVersion)
+    {
+        this->configurationVersion = versions.value("CONFIGURATION");
+        DatabaseManager::getInstance().clearConfigurationCache();
+    }
+
+    if (this->libraryOwner)
+        return;
+
+    // Media, templates and data are versioned separately, only the views of the ones that changed reload.
+    bool media = versions.value("MEDIA") != this->libraryVersions.value("MEDIA");
+    bool templates = versions.value("TEMPLATE") != this->libraryVersions.value("TEMPLATE");
+    bool data = versions.value("DATA") != this->libraryVersions.value("DATA");
+
+    this->libraryVersions = versions;
+
+    if (media)
+        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+
+    if (templates)
+        EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
+
+    if (data)
+        EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
+}
+
+void LibraryManager::synchronizePresets()
+{
+    AsyncDatabaseManager::getInstance().read<qint64>([]()
+    {
+        return DatabaseManager::getInstance().getLibraryVersions().value("PRESET");
+    }, this, [this](const qint64& version)
+    {
+        reloadPresets(version);
+    });
+}
+
+void LibraryManager::reloadPresets(qint64 version)
+{
+    if (version == PresetManager::getInstance().getVersion())
+        return;
+
+    AsyncDatabaseManager::getInstance().read<QList<PresetModel>>([]()
+    {
+        return DatabaseManager::getInstance().getPreset();
+    }, this, [version](const QList<PresetModel>& models)
+    {
+        PresetManager::getInstance().reload(models, version);
+        EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent());
+    });
 }
 
 void LibraryManager::refreshLibrary(const RefreshLibraryEvent& event)
@@ -69,6 +210,10 @@ void LibraryManager::refresh()
     // Clear out all thumbnail workers.
     this->thumbnailWorkers.clear();
 
+    // Nothing polls the database without a shared library, presets saved by other clients show up on refresh.
+    if (!this->shareLibrary)
+        synchronizePresets();
+
     DeviceManager::getInstance().refresh();
     AtemDeviceManager::getInstance().refresh();
     TriCasterDeviceManager::getInstance().refresh();
@@ -76,6 +221,13 @@ void LibraryManager::refresh()
     if (DeviceManager::getInstance().getDeviceCount() == 0)
         return;
 
+    // Clients that do not own the shared library only catch up with the owner.
+    if (!isLibraryWriter())
+    {
+        synchronize();
+        return;
+    }
+
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Refreshing library..."));
 
     // Only refresh library for all devices.
@@ -119,11 +271,17 @@ void LibraryManager::deviceAdded(CasparDevice& device)
 
 void LibraryManager::versionChanged(const QString& version, CasparDevice& device)
 {
+    if (!isLibraryWriter())
+        return;
+
     DatabaseManager::getInstance().updateDeviceVersion(DeviceModel(0, "", device.getAddress(), 0, "", "", "", version, "", 0, "", 0, 0));
 }
 
 void LibraryManager::infoChanged(const QList<QString>& info, CasparDevice& device)
 {
+    if (!isLibraryWriter())
+        return;
+
     QStringList channelFormats;
     foreach (const QString& channelInfo, info)
         channelFormats.push_back(channelInfo.split(" ")[1]);
@@ -135,7 +293,7 @@ void LibraryManager::infoChanged(const QList<QString>& info, CasparDevice& devic
 void LibraryManager::connectionStateChanged(CasparDevice& device)
 {
     // Only refresh library for current device.
-    if (device.isConnected())
+    if (device.isConnected() && isLibraryWriter())
     {
         const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress());
         if (model == NULL || model->getShadow() == "Yes")
@@ -152,6 +310,8 @@ void LibraryManager::connectionStateChanged(CasparDevice& device)
 
 void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDevice& device)
 {
+    TRACE_FUNCTION("library");
+
     QTime time;
     time.start();
 
@@ -189,7 +349,14 @@ void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDe
 
     if (deleteModels.count() > 0 || insertModels.count() > 0)
     {
+        DatabaseManager::getInstance().beginTransaction();
         DatabaseManager::getInstance().updateLibraryMedia(device.getAddress(), deleteModels, insertModels);
+
+        if (this->shareLibrary)
+            DatabaseManager::getInstance().updateLibraryVersion("MEDIA");
+
+        DatabaseManager::getInstance().commitTransaction();
+
         EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
     }
 
@@ -198,6 +365,8 @@ void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDe
 
 void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems, CasparDevice& device)
 {
+    TRACE_FUNCTION("library");
+
     QTime time;
     time.start();
 
@@ -235,7 +404,14 @@ void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems,
 
     if (deleteModels.count() > 0 || insertModels.count() > 0)
     {
+        DatabaseManager::getInstance().beginTransaction();
         DatabaseManager::getInstance().updateLibraryTemplate(device.getAddress(), deleteModels, insertModels);
+
+        if (this->shareLibrary)
+            DatabaseManager::getInstance().updateLibraryVersion("TEMPLATE");
+
+        DatabaseManager::getInstance().commitTransaction();
+
         EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
     }
 
@@ -244,6 +420,8 @@ void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems,
 
 void LibraryManager::dataChanged(const QList<CasparData>& dataItems, CasparDevice& device)
 {
+    TRACE_FUNCTION("library");
+
     QTime time;
     time.start();
 
@@ -281,7 +459,14 @@ void LibraryManager::dataChanged(const QList<CasparData>& dataItems, CasparDevic
 
     if (deleteModels.count() > 0 || insertModels.count() > 0)
     {
+        DatabaseManager::getInstance().beginTransaction();
         DatabaseManager::getInstance().updateLibraryData(device.getAddress(), deleteModels, insertModels);
+
+        if (this->shareLibrary)
+            DatabaseManager::getInstance().updateLibraryVersion("DATA");
+
+        DatabaseManager::getInstance().commitTransaction();
+
         EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
     }
 
@@ -14,7 +14,10 @@
 #include "Models/CasparTemplate.h"
 #include "Models/CasparThumbnail.h"
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QPair>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QTimer>
 
@@ -31,10 +34,26 @@ class CORE_EXPORT LibraryManager : public QObject
         void uninitialize();
 
     private:
+        bool shareLibrary = false;
+        bool libraryOwner = false;
+        qint64 ownerLease = -1;
+        QString ownerName;
+        QElapsedTimer leaseTimer;
+        QMap<QString, qint64> libraryVersions;
+        qint64 configurationVersion = 0;
+
         QTimer refreshTimer;
+        QTimer syncTimer;
         QList<QSharedPointer<ThumbnailWorker>> thumbnailWorkers;
 
+        bool isLibraryWriter() const;
+        void ownerChanged(bool owner);
+        void applyLibraryVersions(const QMap<QString, qint64>& versions);
+        void synchronizePresets();
+        void reloadPresets(qint64 version);
+
         Q_SLOT void refresh();
+        Q_SLOT void synchronize();
         Q_SLOT void deviceRemoved();
         Q_SLOT void deviceAdded(CasparDevice&);
         Q_SLOT void versionChanged(const QString&, CasparDevice&);
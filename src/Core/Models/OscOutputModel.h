@@ -7,6 +7,7 @@
 class CORE_EXPORT OscOutputModel
 {
     public:
+        explicit OscOutputModel() : id(0), port(0) { }
         explicit OscOutputModel(int id, const QString& name, const QString& address, int port, const QString& description);
 
         int getId() const;
@@ -0,0 +1,100 @@
+#include "OscLayerState.h"
+
+OscLayerState::OscLayerState(QObject* parent)
+    : QObject(parent),
+      time(0), totalTime(0), frame(0), totalFrames(0), fps(0), paused(false), loop(false), changes(0)
+{
+}
+
+double OscLayerState::getTime() const
+{
+    return this->time;
+}
+
+double OscLayerState::getTotalTime() const
+{
+    return this->totalTime;
+}
+
+int OscLayerState::getFrame() const
+{
+    return this->frame;
+}
+
+int OscLayerState::getTotalFrames() const
+{
+    return this->totalFrames;
+}
+
+double OscLayerState::getFramesPerSecond() const
+{
+    return this->fps;
+}
+
+const QString& OscLayerState::getPath() const
+{
+    return this->path;
+}
+
+bool OscLayerState::getPaused() const
+{
+    return this->paused;
+}
+
+bool OscLayerState::getLoop() const
+{
+    return this->loop;
+}
+
+int OscLayerState::getChanges() const
+{
+    return this->changes;
+}
+
+void OscLayerState::setTime(double time, double totalTime)
+{
+    this->time = time;
+    this->totalTime = totalTime;
+    this->changes |= Time;
+}
+
+void OscLayerState::setFrame(int frame, int totalFrames)
+{
+    this->frame = frame;
+    this->totalFrames = totalFrames;
+    this->changes |= Frame;
+}
+
+void OscLayerState::setFramesPerSecond(double fps)
+{
+    this->fps = fps;
+    this->changes |= FramesPerSecond;
+}
+
+void OscLayerState::setPath(const QString& path)
+{
+    if (this->path != path)
+        this->path = path;
+
+    this->changes |= Path;
+}
+
+void OscLayerState::setPaused(bool paused)
+{
+    this->paused = paused;
+    this->changes |= Paused;
+}
+
+void OscLayerState::setLoop(bool loop)
+{
+    this->loop = loop;
+    this->changes |= Loop;
+}
+
+void OscLayerState::notify()
+{
+    // Listeners look at getChanges() to see which properties were reported since the last notification.
+    emit changed();
+
+    this->changes = 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// Playback state of a single layer on a server, as last reported over OSC.
+class CORE_EXPORT OscLayerState : public QObject
+{
+    Q_OBJECT
+
+    public:
+        enum Property
+        {
+            Time = 0x01,
+            Frame = 0x02,
+            FramesPerSecond = 0x04,
+            Path = 0x08,
+            Paused = 0x10,
+            Loop = 0x20
+        };
+
+        explicit OscLayerState(QObject* parent = 0);
+
+        double getTime() const;
+        double getTotalTime() const;
+        int getFrame() const;
+        int getTotalFrames() const;
+        double getFramesPerSecond() const;
+        const QString& getPath() const;
+        bool getPaused() const;
+        bool getLoop() const;
+
+        int getChanges() const;
+
+        void setTime(double time, double totalTime);
+        void setFrame(int frame, int totalFrames);
+        void setFramesPerSecond(double fps);
+        void setPath(const QString& path);
+        void setPaused(bool paused);
+        void setLoop(bool loop);
+
+        void notify();
+
+        Q_SIGNAL void changed();
+
+    private:
+        double time;
+        double totalTime;
+        int frame;
+        int totalFrames;
+        double fps;
+        QString path;
+        bool paused;
+        bool loop;
+
+        int changes;
+};
@@ -0,0 +1,121 @@
+#include "OscStateManager.h"
+#include "OscDeviceManager.h"
+#include "OscWebSocketManager.h"
+#include "Trace.h"
+
+#include <QtCore/QStringRef>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+Q_GLOBAL_STATIC(OscStateManager, oscStateManager)
+
+OscStateManager::OscStateManager()
+{
+}
+
+OscStateManager& OscStateManager::getInstance()
+{
+    return *oscStateManager();
+}
+
+void OscStateManager::initialize()
+{
+    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(OscWebSocketManager::getInstance().getOscWebSocketListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+}
+
+void OscStateManager::uninitialize()
+{
+}
+
+quint64 OscStateManager::getLayerKey(int channel, int videolayer)
+{
+    return (static_cast<quint64>(static_cast<quint32>(channel)) << 32) | static_cast<quint32>(videolayer);
+}
+
+OscLayerState* OscStateManager::getLayerState(const QString& address, int channel, int videolayer)
+{
+    QHash<quint64, OscLayerState*>& layerStates = this->layerStates[address];
+
+    quint64 key = getLayerKey(channel, videolayer);
+
+    OscLayerState* layerState = layerStates.value(key);
+    if (layerState == NULL)
+    {
+        layerState = new OscLayerState(this);
+        layerStates.insert(key, layerState);
+    }
+
+    return layerState;
+}
+
+void OscStateManager::messageReceived(const QString& path, const QList<QVariant>& arguments)
+{
+    // Format: <address>/channel/<channel>/stage/layer/<videolayer>/<property>
+    QVector<QStringRef> parts = path.splitRef('/', QString::SkipEmptyParts);
+    if (parts.count() < 7 || arguments.isEmpty() || parts[1] != "channel" || parts[3] != "stage" || parts[4] != "layer")
+        return;
+
+    bool channelOk = false, videolayerOk = false;
+    int channel = parts[2].toInt(&channelOk);
+    int videolayer = parts[5].toInt(&videolayerOk);
+    if (!channelOk || !videolayerOk)
+        return;
+
+    // Only a handful of servers, comparing against the reference saves building a string per message.
+    OscLayerState* layerState = NULL;
+    QHash<QString, QHash<quint64, OscLayerState*> >::const_iterator position;
+    for (position = this->layerStates.constBegin(); position != this->layerStates.constEnd(); ++position)
+    {
+        if (parts[0] == position.key())
+        {
+            layerState = position.value().value(getLayerKey(channel, videolayer));
+            break;
+        }
+    }
+
+    if (layerState == NULL)
+        return; // Nobody is looking at this layer.
+
+    const QStringRef& property = parts[6];
+    if (property == "file" && parts.count() > 7)
+    {
+        const QStringRef& fileProperty = parts[7];
+        if (fileProperty == "time" && arguments.count() > 1)
+            layerState->setTime(arguments.at(0).toDouble(), arguments.at(1).toDouble());
+        else if (fileProperty == "frame" && arguments.count() > 1)
+            layerState->setFrame(arguments.at(0).toInt(), arguments.at(1).toInt());
+        else if (fileProperty == "fps")
+            layerState->setFramesPerSecond(arguments.at(0).toDouble());
+        else if (fileProperty == "path")
+            layerState->setPath(arguments.at(0).toString());
+        else
+            return;
+    }
+    else if (property == "paused")
+        layerState->setPaused(arguments.at(0).toBool());
+    else if (property == "loop")
+        layerState->setLoop(arguments.at(0).toBool());
+    else
+        return;
+
+    // A batch from the listener touches several properties of a layer, notify once when the batch is done.
+    if (this->changedLayerStates.isEmpty())
+        QTimer::singleShot(0, this, SLOT(notifyLayerStates()));
+
+    if (!this->changedLayerStates.contains(layerState))
+        this->changedLayerStates.append(layerState);
+}
+
+void OscStateManager::notifyLayerStates()
+{
+    TRACE_SPAN("osc", "Notify layer states");
+
+    QList<OscLayerState*> layerStates;
+    layerStates.swap(this->changedLayerStates);
+
+    foreach (OscLayerState* layerState, layerStates)
+        layerState->notify();
+}
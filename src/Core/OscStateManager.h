@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Shared.h"
+#include "OscLayerState.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+// Keeps one OscLayerState per server, channel and layer. Incoming OSC messages are parsed once here
+// and every widget that shows the same layer shares the result.
+class CORE_EXPORT OscStateManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit OscStateManager();
+
+        static OscStateManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        OscLayerState* getLayerState(const QString& address, int channel, int videolayer);
+
+    private:
+        // By server address, then by channel and layer packed into one key.
+        QHash<QString, QHash<quint64, OscLayerState*> > layerStates;
+        QList<OscLayerState*> changedLayerStates;
+
+        static quint64 getLayerKey(int channel, int videolayer);
+
+        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void notifyLayerStates();
+};
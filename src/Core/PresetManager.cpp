@@ -0,0 +1,258 @@
+#include "PresetManager.h"
+
+#include "DatabaseManager.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/foreach.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include <QtCore/QRegExp>
+
+Q_GLOBAL_STATIC(PresetManager, presetManager)
+
+namespace
+{
+    bool lessThan(const PresetModel& first, const PresetModel& second)
+    {
+        if (first.getName() == second.getName())
+            return first.getId() < second.getId();
+
+        return first.getName() < second.getName();
+    }
+
+    void collectTypes(const boost::property_tree::wptree& items, QStringList& tags)
+    {
+        BOOST_FOREACH(const boost::property_tree::wptree::value_type& value, items)
+        {
+            if (value.first != L"item")
+                continue;
+
+            QString type = QString::fromStdWString(value.second.get(L"type", L"")).toLower();
+            if (!type.isEmpty() && !tags.contains(type))
+                tags.append(type);
+
+            boost::optional<const boost::property_tree::wptree&> children = value.second.get_child_optional(L"items");
+            if (children)
+                collectTypes(*children, tags);
+        }
+    }
+}
+
+PresetManager::PresetManager()
+    : version(0)
+{
+}
+
+PresetManager& PresetManager::getInstance()
+{
+    return *presetManager();
+}
+
+void PresetManager::initialize()
+{
+    TRACE_FUNCTION("library");
+
+    // The version is read first, a change slipping in between only makes us load the presets twice.
+    qint64 version = DatabaseManager::getInstance().getLibraryVersions().value("PRESET");
+    reload(DatabaseManager::getInstance().getPreset(), version);
+}
+
+void PresetManager::uninitialize()
+{
+    this->presets.clear();
+    this->index.clear();
+}
+
+qint64 PresetManager::getVersion() const
+{
+    return this->version;
+}
+
+void PresetManager::reload(const QList<PresetModel>& models, qint64 version)
+{
+    TRACE_FUNCTION("library");
+
+    this->presets.clear();
+    this->index.clear();
+
+    foreach (const PresetModel& model, models)
+        addPreset(model);
+
+    this->version = version;
+
+    qDebug("Loaded %d presets", this->presets.count());
+}
+
+void PresetManager::addPreset(const PresetModel& model)
+{
+    QSharedPointer<Preset> preset(new Preset(model));
+
+    try
+    {
+        std::wstringstream wstringstream;
+        wstringstream << model.getValue().toStdWString();
+
+        boost::property_tree::xml_parser::read_xml(wstringstream, preset->items);
+
+        collectTypes(preset->items.get_child(L"items"), preset->tags);
+        preset->valid = true;
+    }
+    catch (const boost::property_tree::ptree_error& error)
+    {
+        qWarning("Unable to parse the preset %s: %s", qPrintable(model.getName()), error.what());
+    }
+
+    foreach (const QString& word, model.getName().toLower().split(QRegExp("\\W+"), QString::SkipEmptyParts))
+    {
+        if (!preset->tags.contains(word))
+            preset->tags.append(word);
+    }
+
+    foreach (const QString& tag, preset->tags)
+        this->index[tag].insert(model.getId());
+
+    this->presets.insert(model.getId(), preset);
+}
+
+void PresetManager::removePreset(int id)
+{
+    QSharedPointer<Preset> preset = this->presets.take(id);
+    if (preset == NULL)
+        return;
+
+    foreach (const QString& tag, preset->tags)
+    {
+        QMap<QString, QSet<int>>::iterator iterator = this->index.find(tag);
+        if (iterator == this->index.end())
+            continue;
+
+        iterator.value().remove(id);
+        if (iterator.value().isEmpty())
+            this->index.erase(iterator);
+    }
+}
+
+QSet<int> PresetManager::findTagged(const QString& filter) const
+{
+    // Every word of the filter has to start one of the tags, the index is sorted so that is a range.
+    QSet<int> result;
+    bool first = true;
+
+    foreach (const QString& word, filter.toLower().split(QRegExp("\\W+"), QString::SkipEmptyParts))
+    {
+        QSet<int> matches;
+        for (QMap<QString, QSet<int>>::const_iterator iterator = this->index.lowerBound(word);
+             iterator != this->index.end() && iterator.key().startsWith(word); ++iterator)
+            matches.unite(iterator.value());
+
+        if (first)
+            result = matches;
+        else
+            result.intersect(matches);
+
+        first = false;
+        if (result.isEmpty())
+            break;
+    }
+
+    return result;
+}
+
+QList<PresetModel> PresetManager::getPresets(const QString& filter) const
+{
+    QList<PresetModel> models;
+
+    if (filter.isEmpty())
+    {
+        foreach (const QSharedPointer<Preset>& preset, this->presets)
+            models.append(preset->model);
+    }
+    else
+    {
+        QSet<int> tagged = findTagged(filter);
+        foreach (const QSharedPointer<Preset>& preset, this->presets)
+        {
+            // The name match keeps what the database filter used to find.
+            if (tagged.contains(preset->model.getId()) || preset->model.getName().contains(filter, Qt::CaseInsensitive))
+                models.append(preset->model);
+        }
+    }
+
+    std::sort(models.begin(), models.end(), lessThan);
+
+    return models;
+}
+
+PresetModel PresetManager::getPreset(int id) const
+{
+    QSharedPointer<Preset> preset = this->presets.value(id);
+    if (preset == NULL)
+        return PresetModel(0, "", "");
+
+    return preset->model;
+}
+
+bool PresetManager::hasPreset(int id) const
+{
+    return this->presets.contains(id);
+}
+
+bool PresetManager::matchesFilter(int id, const QString& filter) const
+{
+    QSharedPointer<Preset> preset = this->presets.value(id);
+    if (preset == NULL)
+        return false;
+
+    if (filter.isEmpty() || preset->model.getName().contains(filter, Qt::CaseInsensitive))
+        return true;
+
+    return findTagged(filter).contains(id);
+}
+
+bool PresetManager::getItems(int id, boost::property_tree::wptree& items) const
+{
+    QSharedPointer<Preset> preset = this->presets.value(id);
+    if (preset == NULL || !preset->valid)
+        return false;
+
+    items = preset->items;
+
+    return true;
+}
+
+int PresetManager::insertPreset(const PresetModel& model)
+{
+    DatabaseManager::getInstance().beginTransaction();
+
+    int id = DatabaseManager::getInstance().insertPreset(model);
+    qint64 version = DatabaseManager::getInstance().updateLibraryVersion("PRESET");
+
+    DatabaseManager::getInstance().commitTransaction();
+
+    if (id > 0)
+        addPreset(PresetModel(id, model.getName(), model.getValue()));
+
+    // Skipping a version means someone else changed the presets too, the next sync reloads them.
+    if (version == this->version + 1)
+        this->version = version;
+
+    return id;
+}
+
+void PresetManager::deletePreset(int id)
+{
+    DatabaseManager::getInstance().beginTransaction();
+
+    DatabaseManager::getInstance().deletePreset(id);
+    qint64 version = DatabaseManager::getInstance().updateLibraryVersion("PRESET");
+
+    DatabaseManager::getInstance().commitTransaction();
+
+    removePreset(id);
+
+    if (version == this->version + 1)
+        this->version = version;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Shared.h"
+#include "Models/PresetModel.h"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+// The preset library, kept parsed. Adding a preset to a rundown copies its item tree instead of
+// parsing the XML again, and the filter is answered from an index over the words of the names and
+// the item types each preset holds. The cache is reloaded when the preset version in the database
+// moves past ours, i.e. when another client sharing the database changed the presets.
+class CORE_EXPORT PresetManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit PresetManager();
+
+        static PresetManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        qint64 getVersion() const;
+        void reload(const QList<PresetModel>& models, qint64 version);
+
+        QList<PresetModel> getPresets(const QString& filter = QString()) const;
+        PresetModel getPreset(int id) const;
+        bool hasPreset(int id) const;
+        bool matchesFilter(int id, const QString& filter) const;
+
+        bool getItems(int id, boost::property_tree::wptree& items) const;
+
+        int insertPreset(const PresetModel& model);
+        void deletePreset(int id);
+
+    private:
+        struct Preset
+        {
+            Preset(const PresetModel& model) : model(model), valid(false) {}
+
+            PresetModel model;
+            boost::property_tree::wptree items;
+            bool valid;
+            QStringList tags;
+        };
+
+        qint64 version;
+        QMap<int, QSharedPointer<Preset>> presets;
+        QMap<QString, QSet<int>> index;
+
+        void addPreset(const PresetModel& model);
+        void removePreset(int id);
+        QSet<int> findTagged(const QString& filter) const;
+};
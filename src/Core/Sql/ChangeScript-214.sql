@@ -0,0 +1,7 @@
+CREATE TABLE LibrarySync (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Owner TEXT, Lease BIGINT);
+CREATE TABLE LibraryVersion (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Type TEXT, Version BIGINT);
+INSERT INTO LibrarySync (Owner, Lease) VALUES('', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('MEDIA', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('TEMPLATE', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('DATA', 0);
+INSERT INTO Configuration (Name, Value) VALUES('ShareLibrary', 'false');
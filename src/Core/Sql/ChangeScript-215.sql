@@ -0,0 +1 @@
+UPDATE Configuration SET Value = '200' WHERE Name = 'NetworkCache' AND Value = '1000';
@@ -0,0 +1 @@
+INSERT INTO Configuration (Name, Value) VALUES('GpiDebounceTime', '10');
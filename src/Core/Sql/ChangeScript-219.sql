@@ -0,0 +1 @@
+INSERT INTO LibraryVersion (Type, Version) VALUES('CONFIGURATION', 0);
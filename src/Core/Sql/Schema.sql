@@ -7,6 +7,8 @@ CREATE TABLE Format (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT, Width INT
 CREATE TABLE GpiPort (Id INTEGER PRIMARY KEY AUTO_INCREMENT, RisingEdge INTEGER, Action TEXT);
 CREATE TABLE GpoPort (Id INTEGER PRIMARY KEY AUTO_INCREMENT, RisingEdge INTEGER, PulseLengthMillis INTEGER);
 CREATE TABLE Library (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT, DeviceId INTEGER, TypeId INTEGER, ThumbnailId INTEGER, Timecode TEXT);
+CREATE TABLE LibrarySync (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Owner TEXT, Lease BIGINT);
+CREATE TABLE LibraryVersion (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Type TEXT, Version BIGINT);
 CREATE TABLE OpenRecent (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Value VARCHAR(255) UNIQUE);
 CREATE TABLE Preset (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT, Value TEXT);
 CREATE TABLE Thumbnail (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Data TEXT, Timestamp TEXT, Size TEXT);
@@ -72,6 +74,7 @@ INSERT INTO Configuration (Name, Value) VALUES('DisableInAndOutPoints', 'true');
 INSERT INTO Configuration (Name, Value) VALUES('RefreshLibraryInterval', '60');
 INSERT INTO Configuration (Name, Value) VALUES('GpiSerialPort', 'COM1');
 INSERT INTO Configuration (Name, Value) VALUES('GpiBaudRate', '115200');
+INSERT INTO Configuration (Name, Value) VALUES('GpiDebounceTime', '10');
 INSERT INTO Configuration (Name, Value) VALUES('OscPort', '6250');
 INSERT INTO Configuration (Name, Value) VALUES('TriCasterPort', '5950');
 INSERT INTO Configuration (Name, Value) VALUES('DelayType', 'Milliseconds');
@@ -90,11 +93,18 @@ INSERT INTO Configuration (Name, Value) VALUES('MarkUsedItems', 'false');
 INSERT INTO Configuration (Name, Value) VALUES('UseFreezeOnLoad', 'false');
 INSERT INTO Configuration (Name, Value) VALUES('DisableAudioInStream', 'true');
 INSERT INTO Configuration (Name, Value) VALUES('StreamQuality', '25');
-INSERT INTO Configuration (Name, Value) VALUES('NetworkCache', '1000');
+INSERT INTO Configuration (Name, Value) VALUES('NetworkCache', '200');
 INSERT INTO Configuration (Name, Value) VALUES('StreamPort', '9250');
 INSERT INTO Configuration (Name, Value) VALUES('LogLevel', '-1');
 INSERT INTO Configuration (Name, Value) VALUES('UseDropFrameNotation', 'false');
+INSERT INTO Configuration (Name, Value) VALUES('ShareLibrary', 'false');
 INSERT INTO Configuration (Name, Value) VALUES('DatabaseVersion', '208');
+INSERT INTO LibrarySync (Owner, Lease) VALUES('', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('MEDIA', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('TEMPLATE', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('DATA', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('PRESET', 0);
+INSERT INTO LibraryVersion (Type, Version) VALUES('CONFIGURATION', 0);
 
 INSERT INTO Chroma (Value) VALUES('None');
 INSERT INTO Chroma (Value) VALUES('Green');
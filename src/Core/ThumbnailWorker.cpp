@@ -1,4 +1,5 @@
 #include "ThumbnailWorker.h"
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
@@ -66,5 +67,10 @@ void ThumbnailWorker::process()
 void ThumbnailWorker::thumbnailRetrieveChanged(const QString& data, CasparDevice& device)
 {
     QObject::disconnect(&device, SIGNAL(thumbnailRetrieveChanged(const QString&, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, CasparDevice&)));
-    DatabaseManager::getInstance().updateThumbnail(ThumbnailModel(0, data, this->currentTimestamp, this->currentSize, this->currentName, this->currentAddress));
+    // Thumbnails arrive one after another, the writes are batched into a single transaction on the database thread.
+    ThumbnailModel model(0, data, this->currentTimestamp, this->currentSize, this->currentName, this->currentAddress);
+    AsyncDatabaseManager::getInstance().write([model]()
+    {
+        DatabaseManager::getInstance().updateThumbnail(model);
+    });
 }
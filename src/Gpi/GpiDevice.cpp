@@ -3,8 +3,11 @@
 #include <boost/bind.hpp>
 
 GpiDevice::GpiDevice(const QString& serialPort, int baudRate)
-    : device(gpio::serial_port_device::create(serialPort.toStdString(), baudRate, boost::bind(&GpiDevice::onConnected, this, _1)))
+    : connected(false), debounceTime(0), debouncedCount(0)
 {
+    // Started before the device, the first pulse may arrive as soon as the port is open.
+    clock.start();
+    device = gpio::serial_port_device::create(serialPort.toStdString(), baudRate, boost::bind(&GpiDevice::onConnected, this, _1));
 }
 
 void GpiDevice::reset(const QString& serialPort, int baudRate)
@@ -13,6 +16,7 @@ void GpiDevice::reset(const QString& serialPort, int baudRate)
     connected = false;
     gpo_triggers.clear();
     device.reset();
+    lastTriggers.clear();
     device = gpio::serial_port_device::create(serialPort.toStdString(), baudRate, boost::bind(&GpiDevice::onConnected, this, _1));
 }
 
@@ -27,9 +31,36 @@ void GpiDevice::setupGpoPort(int gpo, int pulseLengthMillis, bool risingEdge)
     gpo_triggers.insert(std::make_pair(gpo, device->setup_gpo_pulse(gpo, risingEdge ? gpio::LOW : gpio::HIGH, pulseLengthMillis)));
 }
 
+void GpiDevice::setDebounceTime(int millis)
+{
+    debounceTime.store(qMax(0, millis));
+}
+
+int GpiDevice::getDebouncedCount() const
+{
+    return debouncedCount.load();
+}
+
+qint64 GpiDevice::getTime() const
+{
+    return clock.nsecsElapsed() / 1000;
+}
+
 void GpiDevice::onTrigger(int gpi)
 {
-    emit gpiTriggered(gpi, this);
+    qint64 timestamp = getTime();
+
+    // Only the gpio-client thread gets here, the last triggers need no lock.
+    std::map<int, qint64>::iterator iter = lastTriggers.find(gpi);
+    if (iter != lastTriggers.end() && timestamp - iter->second < debounceTime.load() * 1000LL)
+    {
+        debouncedCount.ref();
+        return;
+    }
+
+    lastTriggers[gpi] = timestamp;
+
+    emit gpiTriggered(gpi, timestamp, this);
 }
 
 void GpiDevice::onConnected(bool state)
@@ -6,6 +6,8 @@
 
 #include <gpio/serial_port_device.h>
 
+#include <QAtomicInt>
+#include <QElapsedTimer>
 #include <QSharedPointer>
 
 class GPI_EXPORT GpiDevice : public QObject
@@ -27,8 +29,16 @@ public:
     void setupGpoPort(int gpo, int pulseLengthMillis, bool risingEdge);
     void setupGpiPort(int gpi, bool risingEdge);
 
+    // Pulses on a port closer together than this are contact bounce, only the first one is emitted.
+    void setDebounceTime(int millis);
+    int getDebouncedCount() const;
+
+    // Microseconds on a monotonic clock, the timestamps of gpiTriggered are on the same clock.
+    qint64 getTime() const;
+
+    // Emitted on the gpio-client thread, as soon as the pulse is read from the serial port.
+    Q_SIGNAL void gpiTriggered(int, qint64, GpiDevice*);
     Q_SIGNAL void connectionStateChanged(bool, GpiDevice*);
-    Q_SIGNAL void gpiTriggered(int, GpiDevice*);
 private:
     void onTrigger(int gpi);
     void onConnected(bool state);
@@ -36,4 +46,9 @@ private:
     bool connected;
     std::map<int, gpio::gpo_trigger::ptr> gpo_triggers;
     gpio::gpio_device::ptr device;
+
+    QElapsedTimer clock;
+    QAtomicInt debounceTime;
+    QAtomicInt debouncedCount;
+    std::map<int, qint64> lastTriggers;
 };
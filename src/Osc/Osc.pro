@@ -11,6 +11,7 @@ HEADERS += \
     Shared.h \
     OscThread.h \
     OscListener.h \
+    OscMessageHandler.h \
     OscSender.h \
     OscWebSocketListener.h
 
@@ -39,3 +40,10 @@ CONFIG(system-oscpack) {
     else:macx:LIBS += -L$$PWD/../../lib/oscpack/lib/macx/ -loscpack
     else:unix:LIBS += -L$$PWD/../../lib/oscpack/lib/linux/ -loscpack
 }
+
+DEPENDPATH += $$OUT_PWD/../Common $$PWD/../Common
+INCLUDEPATH += $$OUT_PWD/../Common $$PWD/../Common
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../Common/release/ -lcommon
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../Common/debug/ -lcommon
+else:macx:LIBS += -L$$OUT_PWD/../Common/ -lcommon
+else:unix:LIBS += -L$$OUT_PWD/../Common/ -lcommon
@@ -1,4 +1,5 @@
 #include "OscListener.h"
+#include "Trace.h"
 
 #include <QtCore/QString>
 #include <QtCore/QThread>
@@ -50,8 +51,17 @@ void OscListener::start()
         this->thread->start();
 }
 
+void OscListener::setMessageHandler(OscMessageHandler* handler)
+{
+    this->handler.storeRelease(handler);
+}
+
 void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint)
 {
+    OscMessageHandler* handler = this->handler.loadAcquire();
+    if (handler != nullptr && handler->handleMessage(static_cast<quint32>(endpoint.address), message))
+        return;
+
     char addressBuffer[256];
 
     endpoint.AddressAsString(addressBuffer);
@@ -95,6 +105,8 @@ void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEn
 
 void OscListener::sendEventBatch()
 {
+    TRACE_SPAN("osc", "Dispatch");
+
     QMap<QString, QList<QVariant>> other;
     {
         QMutexLocker locker(&eventsMutex);
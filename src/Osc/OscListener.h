@@ -2,11 +2,13 @@
 
 #include "Shared.h"
 #include "OscThread.h"
+#include "OscMessageHandler.h"
 
 #include <osc/OscReceivedElements.h>
 #include <osc/OscPacketListener.h>
 #include <ip/UdpSocket.h>
 
+#include <QtCore/QAtomicPointer>
 #include <QtCore/QObject>
 #include <QtCore/QMap>
 #include <QtCore/QVariant>
@@ -21,6 +23,7 @@ class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
         ~OscListener();
 
         void start();
+        void setMessageHandler(OscMessageHandler* handler);
 
         Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
 
@@ -31,6 +34,7 @@ class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
         int port;
         QMutex eventsMutex;
         QMap<QString, QList<QVariant>> events;
+        QAtomicPointer<OscMessageHandler> handler;
         OscThread* thread = nullptr;
         UdpSocket* socket = nullptr;
         SocketReceiveMultiplexer* multiplexer = nullptr;
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <osc/OscReceivedElements.h>
+
+#include <QtCore/QtGlobal>
+
+// Sees every message on the listener's socket thread before it is batched for the GUI thread.
+// Meant for high rate streams that are cheaper to fold into shared state right where they arrive.
+class OscMessageHandler
+{
+    public:
+        virtual ~OscMessageHandler() {}
+
+        // Returns true if the message was consumed and should not be batched. The address is the
+        // sender's IPv4 address in host byte order. Must be thread safe and must not block.
+        virtual bool handleMessage(quint32 address, const osc::ReceivedMessage& message) = 0;
+};
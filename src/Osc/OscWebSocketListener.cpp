@@ -1,5 +1,7 @@
 #include "OscWebSocketListener.h"
 
+#include <osc/OscOutboundPacketStream.h>
+
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -11,6 +13,8 @@
 #include <QtWebSockets/QWebSocket>
 #include <QtWebSockets/QWebSocketServer>
 
+#include <QtNetwork/QHostAddress>
+
 OscWebSocketListener::OscWebSocketListener(QObject* parent)
     : QObject(parent)
 {
@@ -37,6 +41,11 @@ void OscWebSocketListener::start(int port)
     }
 }
 
+void OscWebSocketListener::setMessageHandler(OscMessageHandler* handler)
+{
+    this->handler = handler;
+}
+
 void OscWebSocketListener::newConnection()
 {
     QWebSocket* socket = this->server->nextPendingConnection();
@@ -79,8 +88,61 @@ void OscWebSocketListener::textMessageReceived(const QString& message)
             arguments.append(array[i].toString());
     }
 
-    if (!path.isEmpty() && arguments.count() > 0)
-        emit messageReceived(path, arguments);
+    if (path.isEmpty() || arguments.count() == 0)
+        return;
+
+    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
+    if (this->handler != nullptr && handleMessage(path, arguments, (socket != nullptr) ? socket->peerAddress().toIPv4Address() : 0))
+        return;
+
+    emit messageReceived(path, arguments);
+}
+
+bool OscWebSocketListener::handleMessage(const QString& path, const QList<QVariant>& arguments, quint32 peerAddress)
+{
+    // Paths may start with the address of the server that sent the message, like the ones the UDP listener
+    // produces. Without it the message is taken to come from the peer.
+    QString pattern = path;
+    quint32 address = peerAddress;
+    if (!path.startsWith('/'))
+    {
+        int index = path.indexOf('/');
+        if (index == -1)
+            return false;
+
+        address = QHostAddress(path.left(index)).toIPv4Address();
+        pattern = path.mid(index);
+    }
+
+    if (address == 0)
+        return false;
+
+    // The handler reads OSC, so the message is encoded the way it would have come in over UDP.
+    char buffer[1024];
+    try
+    {
+        osc::OutboundPacketStream stream(buffer, sizeof(buffer));
+        stream << osc::BeginMessage(pattern.toUtf8().constData());
+
+        foreach (const QVariant& argument, arguments)
+        {
+            if (argument.type() == QVariant::Bool)
+                stream << argument.toBool();
+            else if (argument.type() == QVariant::Double)
+                stream << argument.toDouble();
+            else
+                stream << argument.toString().toUtf8().constData();
+        }
+
+        stream << osc::EndMessage;
+
+        osc::ReceivedPacket packet(stream.Data(), stream.Size());
+        return this->handler->handleMessage(address, osc::ReceivedMessage(packet));
+    }
+    catch (const osc::Exception&)
+    {
+        return false;
+    }
 }
 
 void OscWebSocketListener::disconnected()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Shared.h"
+#include "OscMessageHandler.h"
 
 #include <QtCore/QList>
 #include <QtCore/QObject>
@@ -18,12 +19,16 @@ class OSC_EXPORT OscWebSocketListener : public QObject
         ~OscWebSocketListener();
 
         void start(int port);
+        void setMessageHandler(OscMessageHandler* handler);
 
         Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
 
     private:
         QList<QWebSocket*> sockets;
         QWebSocketServer* server = nullptr;
+        OscMessageHandler* handler = nullptr;
+
+        bool handleMessage(const QString& path, const QList<QVariant>& arguments, quint32 peerAddress);
 
         Q_SLOT void disconnected();
         Q_SLOT void newConnection();
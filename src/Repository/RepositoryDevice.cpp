@@ -67,8 +67,9 @@ void RepositoryDevice::sendNotification()
         }
         case RrupDevice::ADD:
         {
-            QString storyId = RrupDevice::response.split("\r\n").at(1).trimmed();
-            QString data = RrupDevice::response.split("\r\n").at(2).trimmed();
+            QStringList tokens = RrupDevice::response.split("\r\n");
+            QString storyId = tokens.at(1).trimmed();
+            QString data = tokens.at(2).trimmed();
 
             emit repositoryChanged(RepositoryChangeModel("ADD", storyId, data), *this);
 
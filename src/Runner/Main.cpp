@@ -0,0 +1,164 @@
+#include "Version.h"
+#include "Global.h"
+
+#include "RundownRunner.h"
+
+#include "DatabaseManager.h"
+#include "DeviceManager.h"
+#include "EventManager.h"
+#include "GpiManager.h"
+#include "OscDeviceManager.h"
+#include "OscWebSocketManager.h"
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QTime>
+
+#include <QtSql/QSqlDatabase>
+
+#include <stdio.h>
+
+void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& message)
+{
+    Q_UNUSED(context);
+
+    const char* level = "D";
+    switch (type)
+    {
+        case QtDebugMsg:
+            level = "D";
+            break;
+        case QtWarningMsg:
+            level = "W";
+            break;
+        case QtCriticalMsg:
+            level = "C";
+            break;
+        case QtFatalMsg:
+            level = "F";
+    }
+
+    fprintf(stderr, "[%s] [%s] [%s] %s\n", qPrintable(QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz")),
+            qPrintable(QString::number((long long)QThread::currentThreadId(), 16)), level, qPrintable(message));
+
+    if (type == QtFatalMsg)
+       abort();
+}
+
+bool loadDatabase(const QCommandLineParser& parser)
+{
+    QSqlDatabase database;
+    if (parser.isSet("dbmemory"))
+    {
+        qDebug("Using SQLite in memory database");
+
+        database = QSqlDatabase::addDatabase("QSQLITE");
+        database.setDatabaseName(":memory:");
+    }
+    else if (parser.isSet("mysqlhost") && parser.isSet("mysqluser") && parser.isSet("mysqlpass") && parser.isSet("mysqldb"))
+    {
+        qDebug("Using MySQL database");
+
+        database = QSqlDatabase::addDatabase("QMYSQL");
+        database.setHostName(parser.value("mysqlhost"));
+        database.setDatabaseName(parser.value("mysqldb"));
+        database.setUserName(parser.value("mysqluser"));
+        database.setPassword(parser.value("mysqlpass"));
+    }
+    else
+    {
+        qDebug("Using SQLite database");
+
+        // The servers and GPI bindings are the ones the client was set up with.
+        database = QSqlDatabase::addDatabase("QSQLITE");
+        if (parser.isSet("sqlitepath"))
+            database.setDatabaseName(parser.value("sqlitepath"));
+        else
+            database.setDatabaseName(QString("%1/.CasparCG/Client/Database.s3db").arg(QDir::homePath()));
+    }
+
+    if (!database.open())
+    {
+        qCritical("Unable to open database");
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    qInstallMessageHandler(messageHandler);
+
+    QCoreApplication application(argc, argv);
+    application.setApplicationName("CasparCG Client Runner");
+    application.setApplicationVersion(QString("%1.%2.%3.%4").arg(MAJOR_VERSION).arg(MINOR_VERSION).arg(REVISION_VERSION).arg(BUILD_VERSION));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays the movie and template items of a rundown without the GUI, triggered by OSC, GPI or a schedule. "
+                                     "Other item types are skipped.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("rundown", "The rundown path.");
+
+    parser.addOption({{"m", "dbmemory"}, "Use SQLite in memory database."});
+    parser.addOption({{"t", "sqlitepath"}, "The SQLite database path.", "sqlitepath"});
+    parser.addOption({{"a", "mysqlhost"}, "MySQL database host.", "mysqlhost"});
+    parser.addOption({{"u", "mysqluser"}, "MySQL database user.", "mysqluser"});
+    parser.addOption({{"p", "mysqlpass"}, "MySQL database password.", "mysqlpass"});
+    parser.addOption({{"n", "mysqldb"}, "MySQL database name.", "mysqldb"});
+    parser.addOption({"at", "Play the first item at this time of day.", "hh:mm:ss"});
+    parser.addOption({"interval", "After the scheduled start, play the next item every this many milliseconds.", "msec"});
+
+    parser.process(application);
+
+    if (parser.positionalArguments().count() != 1)
+        parser.showHelp(1);
+
+    QTime time;
+    if (parser.isSet("at"))
+    {
+        time = QTime::fromString(parser.value("at"), "hh:mm:ss");
+        if (!time.isValid())
+        {
+            qCritical("Invalid start time %s", qPrintable(parser.value("at")));
+            return 1;
+        }
+    }
+
+    if (!loadDatabase(parser))
+        return 1;
+
+    DatabaseManager::getInstance().initialize();
+    EventManager::getInstance().initialize();
+    GpiManager::getInstance().initialize();
+    DeviceManager::getInstance().initialize();
+    OscDeviceManager::getInstance().initialize();
+    OscWebSocketManager::getInstance().initialize();
+
+    int returnValue = 1;
+    {
+        RundownRunner runner;
+        if (runner.load(parser.positionalArguments().first()))
+        {
+            if (time.isValid())
+                runner.schedule(time, parser.value("interval").toInt());
+
+            returnValue = application.exec();
+        }
+    }
+
+    OscWebSocketManager::getInstance().uninitialize();
+    OscDeviceManager::getInstance().uninitialize();
+    DeviceManager::getInstance().uninitialize();
+    GpiManager::getInstance().uninitialize();
+    EventManager::getInstance().uninitialize();
+    DatabaseManager::getInstance().uninitialize();
+
+    return returnValue;
+}
@@ -0,0 +1,297 @@
+#include "RundownRunner.h"
+
+#include "DatabaseManager.h"
+#include "GpiManager.h"
+#include "Commands/MovieCommand.h"
+#include "Commands/TemplateCommand.h"
+#include "Executors/MovieCommandExecutor.h"
+#include "Executors/TemplateCommandExecutor.h"
+
+#include <sstream>
+
+#include <boost/foreach.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+RundownRunner::RundownRunner(QObject* parent)
+    : QObject(parent),
+      current(0), interval(0), allowRemoteTriggering(false)
+{
+    this->scheduleTimer.setSingleShot(true);
+    QObject::connect(&this->scheduleTimer, SIGNAL(timeout()), this, SLOT(scheduleTimeout()));
+
+    foreach (const GpiPortModel& port, DatabaseManager::getInstance().getGpiPorts())
+        this->gpiBindings[port.getPort()] = port.getAction();
+
+    QObject::connect(&GpiManager::getInstance(), SIGNAL(gpiTriggered(int, qint64)), this, SLOT(gpiPortTriggered(int, qint64)));
+}
+
+RundownRunner::~RundownRunner()
+{
+    foreach (Item* item, this->items)
+        deleteItem(item);
+}
+
+int RundownRunner::getItemCount() const
+{
+    return this->items.count();
+}
+
+void RundownRunner::deleteItem(Item* item)
+{
+    foreach (Item* child, item->children)
+        deleteItem(child);
+
+    delete item->executor;
+    delete item->command;
+    delete item;
+}
+
+bool RundownRunner::load(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly | QIODevice::Text))
+    {
+        qCritical("Unable to open the rundown %s", qPrintable(path));
+        return false;
+    }
+
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+
+    std::wstringstream wstringstream;
+    wstringstream << stream.readAll().toStdWString();
+
+    file.close();
+
+    boost::property_tree::wptree pt;
+    try
+    {
+        boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+    }
+    catch (const boost::property_tree::xml_parser_error& error)
+    {
+        qCritical("Unable to parse the rundown %s: %s", qPrintable(path), error.what());
+        return false;
+    }
+
+    // The rundown controls obey the same switch as in the GUI, the item controls have one of their own.
+    this->allowRemoteTriggering = pt.get_child(L"items").get(L"allowremotetriggering", false);
+    if (this->allowRemoteTriggering)
+        subscribeRundown();
+
+    BOOST_FOREACH(boost::property_tree::wptree::value_type& value, pt.get_child(L"items"))
+    {
+        if (value.first != L"item")
+            continue;
+
+        Item* item = createItem(value.second);
+        if (item != NULL)
+            this->items.append(item);
+    }
+
+    qDebug("Loaded %d items from %s", this->items.count(), qPrintable(path));
+
+    return true;
+}
+
+RundownRunner::Item* RundownRunner::createItem(boost::property_tree::wptree& pt)
+{
+    QString type = QString::fromStdWString(pt.get(L"type", L""));
+    QString deviceName = QString::fromStdWString(pt.get(L"devicename", L""));
+    QString label = QString::fromStdWString(pt.get(L"label", L""));
+    QString name = QString::fromStdWString(pt.get(L"name", L""));
+
+    Item* item = new Item();
+    item->model = LibraryModel(0, label, name, deviceName, type, 0, "");
+    item->command = NULL;
+    item->executor = NULL;
+
+    if (type == "GROUP")
+    {
+        BOOST_FOREACH(boost::property_tree::wptree::value_type& value, pt.get_child(L"items"))
+        {
+            Item* child = createItem(value.second);
+            if (child != NULL)
+                item->children.append(child);
+        }
+
+        return item;
+    }
+    else if (type == Rundown::MOVIE)
+    {
+        MovieCommand* command = new MovieCommand();
+        command->setVideoName(name);
+        command->setFreezeOnLoad(DatabaseManager::getInstance().getConfigurationByName("UseFreezeOnLoad").getValue() == "true");
+        command->readProperties(pt);
+
+        item->command = command;
+        item->executor = new MovieCommandExecutor(command, &item->model);
+    }
+    else if (type == Rundown::TEMPLATE)
+    {
+        TemplateCommand* command = new TemplateCommand();
+        command->setTemplateName(name);
+        command->readProperties(pt);
+
+        item->command = command;
+        item->executor = new TemplateCommandExecutor(command, &item->model);
+    }
+    else
+    {
+        qWarning("Skipping %s, %s items are not supported without the GUI", qPrintable(label), qPrintable(type));
+
+        delete item;
+        return NULL;
+    }
+
+    subscribeItem(item);
+
+    return item;
+}
+
+void RundownRunner::subscribe(const QString& path, Item* item, Playout::PlayoutType type, int step)
+{
+    Trigger trigger = { item, type, step };
+    this->triggers[path] = trigger;
+
+    OscSubscription* subscription = new OscSubscription(path, this);
+    QObject::connect(subscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
+                     this, SLOT(subscriptionReceived(const QString&, const QList<QVariant>&)));
+}
+
+void RundownRunner::subscribeItem(Item* item)
+{
+    if (!item->command->getAllowRemoteTriggering() || item->command->getRemoteTriggerId().isEmpty())
+        return;
+
+    QMap<QString, Playout::PlayoutType> filters;
+    filters[Osc::DEFAULT_STOP_CONTROL_FILTER] = Playout::PlayoutType::Stop;
+    filters[Osc::DEFAULT_PLAY_CONTROL_FILTER] = Playout::PlayoutType::Play;
+    filters[Osc::DEFAULT_PLAYNOW_CONTROL_FILTER] = Playout::PlayoutType::PlayNow;
+    filters[Osc::DEFAULT_LOAD_CONTROL_FILTER] = Playout::PlayoutType::Load;
+    filters[Osc::DEFAULT_PAUSE_CONTROL_FILTER] = Playout::PlayoutType::PauseResume;
+    filters[Osc::DEFAULT_NEXT_CONTROL_FILTER] = Playout::PlayoutType::Next;
+    filters[Osc::DEFAULT_UPDATE_CONTROL_FILTER] = Playout::PlayoutType::Update;
+    filters[Osc::DEFAULT_INVOKE_CONTROL_FILTER] = Playout::PlayoutType::Invoke;
+    filters[Osc::DEFAULT_PREVIEW_CONTROL_FILTER] = Playout::PlayoutType::Preview;
+    filters[Osc::DEFAULT_CLEAR_CONTROL_FILTER] = Playout::PlayoutType::Clear;
+    filters[Osc::DEFAULT_CLEAR_VIDEOLAYER_CONTROL_FILTER] = Playout::PlayoutType::ClearVideoLayer;
+    filters[Osc::DEFAULT_CLEAR_CHANNEL_CONTROL_FILTER] = Playout::PlayoutType::ClearChannel;
+
+    foreach (QString filter, filters.keys())
+    {
+        Playout::PlayoutType type = filters[filter];
+        subscribe(filter.replace("#UID#", item->command->getRemoteTriggerId()), item, type);
+    }
+}
+
+void RundownRunner::subscribeRundown()
+{
+    subscribe(Osc::DEFAULT_STOP_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Stop);
+    subscribe(Osc::DEFAULT_PLAY_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Play);
+    subscribe(Osc::DEFAULT_PLAYNOW_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::PlayNow);
+    subscribe(Osc::DEFAULT_LOAD_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Load);
+    subscribe(Osc::DEFAULT_PAUSE_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::PauseResume);
+    subscribe(Osc::DEFAULT_NEXT_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Next);
+    subscribe(Osc::DEFAULT_UPDATE_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Update);
+    subscribe(Osc::DEFAULT_INVOKE_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Invoke);
+    subscribe(Osc::DEFAULT_PREVIEW_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Preview);
+    subscribe(Osc::DEFAULT_CLEAR_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Clear);
+    subscribe(Osc::DEFAULT_CLEAR_VIDEOLAYER_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::ClearVideoLayer);
+    subscribe(Osc::DEFAULT_CLEAR_CHANNEL_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::ClearChannel);
+    subscribe(Osc::DEFAULT_PLAYANDAUTOSTEP_CONTROL_FILTER, NULL, Playout::PlayoutType::Play, 1);
+    subscribe(Osc::DEFAULT_PLAYNOWANDAUTOSTEP_CONTROL_FILTER, NULL, Playout::PlayoutType::PlayNow, 1);
+
+    // Only moves the cursor, the type is never executed.
+    subscribe(Osc::DEFAULT_DOWN_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Stop, 1);
+    subscribe(Osc::DEFAULT_UP_RUNDOWN_CONTROL_FILTER, NULL, Playout::PlayoutType::Stop, -1);
+}
+
+void RundownRunner::execute(Item* item, Playout::PlayoutType type)
+{
+    if (item->executor == NULL)
+    {
+        // A group fires all of its items at once.
+        foreach (Item* child, item->children)
+            execute(child, type);
+
+        return;
+    }
+
+    qDebug("%s %s", qPrintable(Playout::toString(type)), qPrintable(item->model.getLabel()));
+
+    item->executor->execute(type);
+}
+
+void RundownRunner::step(int offset)
+{
+    if (this->items.isEmpty())
+        return;
+
+    this->current = qBound(0, this->current + offset, this->items.count() - 1);
+}
+
+void RundownRunner::schedule(const QTime& time, int interval)
+{
+    this->interval = interval;
+
+    int delay = QTime::currentTime().msecsTo(time);
+    if (delay < 0)
+        delay += 24 * 60 * 60 * 1000; // Tomorrow.
+
+    qDebug("Starting the rundown in %d ms", delay);
+
+    this->scheduleTimer.start(delay);
+}
+
+void RundownRunner::scheduleTimeout()
+{
+    if (this->items.isEmpty())
+        return;
+
+    execute(this->items.at(this->current), Playout::PlayoutType::Play);
+
+    if (this->interval > 0 && this->current < this->items.count() - 1)
+    {
+        step(1);
+        this->scheduleTimer.start(this->interval);
+    }
+}
+
+void RundownRunner::gpiPortTriggered(int gpiPort, qint64 timestamp)
+{
+    Q_UNUSED(timestamp);
+
+    if (!this->gpiBindings.contains(gpiPort) || this->items.isEmpty())
+        return;
+
+    Item* item = this->items.at(this->current);
+    if (item->command != NULL && !item->command->getAllowGpi())
+        return;
+
+    execute(item, this->gpiBindings[gpiPort]);
+}
+
+void RundownRunner::subscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+{
+    if (arguments.count() == 0 || arguments[0].toInt() <= 0 || !this->triggers.contains(predicate))
+        return;
+
+    const Trigger& trigger = this->triggers[predicate];
+    if (trigger.item != NULL)
+    {
+        execute(trigger.item, trigger.type);
+        return;
+    }
+
+    if (this->items.isEmpty())
+        return;
+
+    if (predicate != Osc::DEFAULT_DOWN_RUNDOWN_CONTROL_FILTER && predicate != Osc::DEFAULT_UP_RUNDOWN_CONTROL_FILTER)
+        execute(this->items.at(this->current), trigger.type);
+
+    step(trigger.step);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Global.h"
+#include "Playout.h"
+
+#include "GpiDevice.h"
+
+#include "OscSubscription.h"
+#include "Commands/AbstractCommand.h"
+#include "Executors/AbstractCommandExecutor.h"
+#include "Models/LibraryModel.h"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTime>
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+
+// Plays a saved rundown without the GUI. Items run through the same command executors as the rundown
+// widgets, the cursor is moved and fired by the rundown OSC controls, the GPI bindings or a schedule. The
+// rundown OSC controls are only listened to when the rundown allows remote triggering. Only movie and template items have executors, everything else is left out when the rundown is loaded.
+class RundownRunner : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownRunner(QObject* parent = 0);
+        ~RundownRunner();
+
+        bool load(const QString& path);
+        void schedule(const QTime& time, int interval);
+
+        int getItemCount() const;
+
+    private:
+        struct Item
+        {
+            LibraryModel model;
+            AbstractCommand* command;
+            AbstractCommandExecutor* executor;
+            QList<Item*> children;
+        };
+
+        struct Trigger
+        {
+            Item* item; // NULL is the item under the cursor.
+            Playout::PlayoutType type;
+            int step;
+        };
+
+        QList<Item*> items;
+        int current;
+
+        int interval;
+        QTimer scheduleTimer;
+
+        bool allowRemoteTriggering;
+
+        QMap<int, Playout::PlayoutType> gpiBindings;
+        QMap<QString, Trigger> triggers;
+
+        Item* createItem(boost::property_tree::wptree& pt);
+        void deleteItem(Item* item);
+        void subscribe(const QString& path, Item* item, Playout::PlayoutType type, int step = 0);
+        void subscribeItem(Item* item);
+        void subscribeRundown();
+        void execute(Item* item, Playout::PlayoutType type);
+        void step(int offset);
+
+        Q_SLOT void scheduleTimeout();
+        Q_SLOT void gpiPortTriggered(int, qint64);
+        Q_SLOT void subscriptionReceived(const QString&, const QList<QVariant>&);
+};
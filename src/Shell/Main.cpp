@@ -1,15 +1,21 @@
 #include "Version.h"
 #include "Global.h"
+#include "StallWatchdog.h"
+#include "Trace.h"
 
 #include "Application.h"
 
+#include "../Core/AsyncDatabaseManager.h"
 #include "../Core/DatabaseManager.h"
 #include "../Core/EventManager.h"
 #include "../Core/GpiManager.h"
 #include "../Core/LibraryManager.h"
 #include "../Core/DeviceManager.h"
+#include "../Core/AudioMeterManager.h"
 #include "../Core/OscDeviceManager.h"
+#include "../Core/OscStateManager.h"
 #include "../Core/OscWebSocketManager.h"
+#include "../Core/PresetManager.h"
 #include "../Core/AtemDeviceManager.h"
 #include "../Core/TriCasterDeviceManager.h"
 #include "../Core/Events/Rundown/OpenRundownEvent.h"
@@ -17,6 +23,7 @@
 #include "../Widgets/MainWindow.h"
 
 #include <QtCore/QRegExp>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QString>
@@ -43,6 +50,9 @@ struct CommandLineArgs
     QString mysqldb;
     QString sqlitepath;
 
+    QString trace;
+    int watchdog = 0;
+
     bool dbmemory = false;
     bool fullscreen = false;
 };
@@ -240,6 +250,8 @@ CommandLineParseResult parseCommandLine(QCommandLineParser& parser, CommandLineA
     parser.addOption({{"u", "mysqluser"}, "MySQL database user.", "mysqluser"});
     parser.addOption({{"p", "mysqlpass"}, "MySQL database password.", "mysqlpass"});
     parser.addOption({{"n", "mysqldb"}, "MySQL database name.", "mysqldb"});
+    parser.addOption({"trace", "Record trace spans and write them to the file on exit, in Chrome trace event format.", "file"});
+    parser.addOption({"watchdog", "Log the trace spans the GUI thread is in when it stalls for longer than this.", "msec"});
 
     if (!parser.parse(QApplication::arguments()))
         return CommandLineError;
@@ -274,6 +286,12 @@ CommandLineParseResult parseCommandLine(QCommandLineParser& parser, CommandLineA
     if (parser.isSet("sqlitepath"))
         args->sqlitepath = parser.value("sqlitepath");
 
+    if (parser.isSet("trace"))
+        args->trace = parser.value("trace");
+
+    if (parser.isSet("watchdog"))
+        args->watchdog = parser.value("watchdog").toInt();
+
     return CommandLineOk;
 }
 
@@ -307,11 +325,20 @@ int main(int argc, char* argv[])
             return 0;
     }
 
+    // Spans are only tracked when asked for, the watchdog needs them to tell where the GUI thread is stuck.
+    if (!args.trace.isEmpty() || args.watchdog > 0)
+        Trace::enable(!args.trace.isEmpty());
+
+    QSharedPointer<StallWatchdog> watchdog;
+    if (args.watchdog > 0)
+        watchdog = QSharedPointer<StallWatchdog>(new StallWatchdog(args.watchdog));
+
     QSplashScreen splashScreen(QPixmap(":/Graphics/Images/SplashScreen.png"));
     splashScreen.show();
 
     loadDatabase(&args);
     DatabaseManager::getInstance().initialize();
+    AsyncDatabaseManager::getInstance().initialize();
 
     loadStyleSheets(application);
     loadFonts(application);
@@ -327,22 +354,35 @@ int main(int argc, char* argv[])
     window.show();
 
     LibraryManager::getInstance().initialize();
+    PresetManager::getInstance().initialize();
     DeviceManager::getInstance().initialize();
     AtemDeviceManager::getInstance().initialize();
     TriCasterDeviceManager::getInstance().initialize();
     OscDeviceManager::getInstance().initialize();
     OscWebSocketManager::getInstance().initialize();
+    OscStateManager::getInstance().initialize();
+    AudioMeterManager::getInstance().initialize();
 
     int returnValue = application.exec();
 
+    if (!watchdog.isNull())
+        watchdog->stop();
+
+    if (!args.trace.isEmpty())
+        Trace::write(args.trace);
+
     EventManager::getInstance().uninitialize();
+    AsyncDatabaseManager::getInstance().uninitialize();
     DatabaseManager::getInstance().uninitialize();
     GpiManager::getInstance().uninitialize();
+    AudioMeterManager::getInstance().uninitialize();
+    OscStateManager::getInstance().uninitialize();
     OscWebSocketManager::getInstance().uninitialize();
     OscDeviceManager::getInstance().uninitialize();
     TriCasterDeviceManager::getInstance().uninitialize();
     AtemDeviceManager::getInstance().uninitialize();
     DeviceManager::getInstance().uninitialize();
+    PresetManager::getInstance().uninitialize();
     LibraryManager::getInstance().uninitialize();
 
     return returnValue;
@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT += core gui sql network widgets
+QT += core gui sql network widgets concurrent
 
 CONFIG += c++11
 
@@ -14,8 +14,17 @@ SUBDIRS += \
     Repository \
     Core \
     Widgets \
-    Shell
+    Shell \
+    Runner
 
+Osc.depends = Common
 Core.depends = Atem Caspar TriCaster Osc Gpi Common
 Widgets.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core
 Shell.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core Widgets
+Runner.depends = Atem Caspar TriCaster Osc Gpi Common Core
+
+# Build with qmake "CONFIG+=benchmarks" to include the performance benchmarks.
+CONFIG(benchmarks) {
+    SUBDIRS += Benchmarks
+    Benchmarks.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core Widgets
+}
@@ -10,7 +10,9 @@ DEFINES += SONY_LIBRARY
 
 HEADERS += \
     Shared.h \
-    ViscaDevice.h
+    ViscaDevice.h \
+    ViscaSession.h
 	
 SOURCES += \
-    ViscaDevice.cpp
+    ViscaDevice.cpp \
+    ViscaSession.cpp
@@ -2,67 +2,89 @@
 
 #include <QtCore/QByteArray>
 #include <QtCore/QDebug>
-#include <QtCore/QTimer>
+#include <QtCore/QMetaObject>
+#include <QtCore/QThread>
 
-#include <QtNetwork/QUdpSocket>
+Q_GLOBAL_STATIC(ViscaDevice, viscaDevice)
 
 ViscaDevice::ViscaDevice(QObject* parent)
-    : QObject(parent), address("")
+    : QObject(parent)
 {
+    this->thread = new QThread(this);
+    this->thread->setObjectName("VISCA");
+    this->thread->start();
+}
+
+ViscaDevice::~ViscaDevice()
+{
+    this->thread->quit();
+    this->thread->wait();
+}
+
+ViscaDevice& ViscaDevice::getInstance()
+{
+    return *viscaDevice();
+}
+
+ViscaSession* ViscaDevice::getSession(const QString& address)
+{
+    if (this->sessions.contains(address))
+        return this->sessions.value(address);
+
+    ViscaSession* session = new ViscaSession(address);
+    session->moveToThread(this->thread);
+
+    QObject::connect(this->thread, SIGNAL(finished()), session, SLOT(deleteLater()));
+    QObject::connect(session, SIGNAL(commandCompleted(const QString&, int, int)), this, SLOT(commandCompleted(const QString&, int, int)));
+    QObject::connect(session, SIGNAL(commandFailed(const QString&, const QString&)), this, SLOT(commandFailed(const QString&, const QString&)));
+
+    this->sessions.insert(address, session);
+
+    return session;
 }
 
 void ViscaDevice::selectPreset(const QString& address, int preset)
 {
     preset = (preset > 0) ? preset - 1 : 0;
 
-    this->preset = preset;
-    this->address = address;
+    // Command packet: 81 01 04 3F 02 0P FF, where P = Preset
+    QByteArray command;
+    command.append(static_cast<char>(0x81));
+    command.append(static_cast<char>(0x01));
+    command.append(static_cast<char>(0x04));
+    command.append(static_cast<char>(0x3F));
+    command.append(static_cast<char>(0x02));
+    command.append(static_cast<char>(preset));
+    command.append(static_cast<char>(VISCA_TERMINATOR));
 
-    QTimer::singleShot(0, this, SLOT(sendClearSequence()));
-    QTimer::singleShot(80, this, SLOT(sendRecallPreset())); // 1 V-cycle: PAL/50i = 20msec, NTSC/5994i = 16.7. Max 4 V-cycle for ACK/Compleation.
+    QMetaObject::invokeMethod(getSession(address), "sendCommand", Qt::QueuedConnection, Q_ARG(QByteArray, command));
 }
 
-void ViscaDevice::sendClearSequence()
+int ViscaDevice::getLatency(const QString& address) const
 {
-    QByteArray data;
-    data.resize(9);
-    data[0] = VISCA_COMMAND_CONTROL;    // Command type
-    data[1] = 0x00;                     // Command type
-    data[2] = 0x00;                     // Payload length
-    data[3] = 0x01;                     // Payload length
-    data[4] = 0x00;                     // Sequence number is ignored
-    data[5] = 0x00;                     // Sequence number is ignored
-    data[6] = 0x00;                     // Sequence number is ignored
-    data[7] = 0x00;                     // Sequence number is ignored
-    data[8] = VISCA_RESET_SEQNR;        // Command packet
-
-    QUdpSocket socket;
-    socket.writeDatagram(data, data.size(), QHostAddress(this->address), 52381);
-    socket.flush();
+    return this->latencies.value(address, -1);
 }
 
-void ViscaDevice::sendRecallPreset()
+bool ViscaDevice::hasFailed(const QString& address) const
 {
-    // Command packet: 81 01 04 3F 02 0P FF, where P = Preset
-    QByteArray data;
-    data.resize(15);
-    data[0] = VISCA_COMMAND;            // Command type
-    data[1] = 0x00;                     // Command type
-    data[2] = 0x00;                     // Payload length
-    data[3] = 0x07;                     // Payload length
-    data[4] = 0x00;                     // Sequence number
-    data[5] = 0x00;                     // Sequence number
-    data[6] = 0x00;                     // Sequence number
-    data[7] = 0x01;                     // Sequence number
-    data[8] = 0x81;                     // Command packet
-    data[9] = 0x01;                     // Command packet
-    data[10] = 0x04;                    // Command packet
-    data[11] = 0x3F;                    // Command packet
-    data[12] = 0x02;                    // Command packet
-    data[13] = this->preset;            // Command packet (Our preset)
-    data[14] = VISCA_TERMINATOR;
-
-    QUdpSocket socket;
-    socket.writeDatagram(data, data.size(), QHostAddress(this->address), 52381);
-    socket.flush();
+    return this->failures.value(address, false);
+}
+
+void ViscaDevice::commandCompleted(const QString& address, int acknowledged, int completed)
+{
+    qDebug("VISCA command to %s acknowledged in %d ms, completed in %d ms", qPrintable(address), acknowledged, completed);
+
+    this->latencies.insert(address, completed);
+    this->failures.insert(address, false);
+
+    emit latencyChanged(address);
+}
+
+void ViscaDevice::commandFailed(const QString& address, const QString& reason)
+{
+    qWarning("VISCA command to %s failed: %s", qPrintable(address), qPrintable(reason));
+
+    this->failures.insert(address, true);
+
+    emit latencyChanged(address);
 }
@@ -2,29 +2,44 @@
 
 #include "Shared.h"
 
+#include "ViscaSession.h"
+
+#include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 
-#define VISCA_COMMAND           0x01
-#define VISCA_COMMAND_CONTROL   0x02
-#define VISCA_INQUIRY           0x09
 #define VISCA_TERMINATOR        0xFF
 
-#define VISCA_RESET_SEQNR       0x01
+class QThread;
 
+// Shared by every Sony item, one session per camera address. The sessions run on their own network
+// thread so a busy GUI thread does not hold back retransmissions or skew the measured round trips.
 class SONY_EXPORT ViscaDevice : public QObject
 {
     Q_OBJECT
 
     public:
         explicit ViscaDevice(QObject* parent = 0);
+        ~ViscaDevice();
+
+        static ViscaDevice& getInstance();
 
         void selectPreset(const QString& address, int preset);
 
+        // Milliseconds until the last command to the camera completed, -1 until one has.
+        int getLatency(const QString& address) const;
+        bool hasFailed(const QString& address) const;
+
+        Q_SIGNAL void latencyChanged(const QString&);
+
     private:
-        int preset;
-        QString address;
+        QThread* thread;
+        QMap<QString, ViscaSession*> sessions;
+        QMap<QString, int> latencies;
+        QMap<QString, bool> failures;
+
+        ViscaSession* getSession(const QString& address);
 
-        Q_SLOT void sendClearSequence();
-        Q_SLOT void sendRecallPreset();
+        Q_SLOT void commandCompleted(const QString&, int, int);
+        Q_SLOT void commandFailed(const QString&, const QString&);
 };
@@ -0,0 +1,238 @@
+#include "ViscaSession.h"
+
+#include <QtCore/QDebug>
+
+#include <QtNetwork/QUdpSocket>
+
+namespace
+{
+    const quint16 VISCA_COMMAND_TYPE = 0x0100;
+    const quint16 VISCA_REPLY_TYPE = 0x0111;
+    const quint16 CONTROL_COMMAND_TYPE = 0x0200;
+    const quint16 CONTROL_REPLY_TYPE = 0x0201;
+
+    const char RESET_SEQUENCE = 0x01;
+    const char CONTROL_ERROR = 0x0F;
+    const char ABNORMAL_SEQUENCE = 0x01;
+}
+
+ViscaSession::ViscaSession(const QString& address, QObject* parent)
+    : QObject(parent),
+      address(address), host(address), socket(NULL), retransmitTimer(this), sequence(0), synchronized(false), waiting(false)
+{
+    this->clock.start();
+
+    this->retransmitTimer.setSingleShot(true);
+    QObject::connect(&this->retransmitTimer, SIGNAL(timeout()), this, SLOT(replyTimeout()));
+}
+
+void ViscaSession::sendCommand(const QByteArray& command)
+{
+    if (this->socket == NULL)
+    {
+        // Created here, on the thread the session was moved to.
+        this->socket = new QUdpSocket(this);
+        if (!this->socket->bind(QHostAddress::AnyIPv4, 0))
+            qWarning("Unable to bind a VISCA socket for %s: %s", qPrintable(this->address), qPrintable(this->socket->errorString()));
+
+        QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readReplies()));
+    }
+
+    this->queue.enqueue(command);
+
+    if (!this->waiting)
+        sendNext();
+}
+
+void ViscaSession::sendNext()
+{
+    if (this->queue.isEmpty())
+        return;
+
+    if (!this->synchronized)
+    {
+        this->current.type = CONTROL_COMMAND_TYPE;
+        this->current.sequence = 0;
+        this->current.payload = QByteArray(1, RESET_SEQUENCE);
+    }
+    else
+    {
+        this->current.type = VISCA_COMMAND_TYPE;
+        this->current.sequence = ++this->sequence;
+        this->current.payload = this->queue.head();
+    }
+
+    this->current.retries = 0;
+    this->current.sent = this->clock.elapsed();
+
+    transmit();
+}
+
+void ViscaSession::transmit()
+{
+    QByteArray data;
+    data.reserve(8 + this->current.payload.size());
+    data.append(static_cast<char>(this->current.type >> 8));
+    data.append(static_cast<char>(this->current.type & 0xFF));
+    data.append(static_cast<char>(this->current.payload.size() >> 8));
+    data.append(static_cast<char>(this->current.payload.size() & 0xFF));
+    for (int shift = 24; shift >= 0; shift -= 8)
+        data.append(static_cast<char>((this->current.sequence >> shift) & 0xFF));
+    data.append(this->current.payload);
+
+    // A retransmission keeps its sequence number, the camera drops it if the first one did arrive.
+    this->socket->writeDatagram(data, this->host, VISCA_PORT);
+
+    this->waiting = true;
+    this->retransmitTimer.start(VISCA_ACK_TIMEOUT);
+}
+
+void ViscaSession::acknowledged(qint64 now)
+{
+    this->retransmitTimer.stop();
+    this->waiting = false;
+
+    if (this->current.type == VISCA_COMMAND_TYPE)
+    {
+        Execution execution = { this->current.sent, static_cast<int>(now - this->current.sent) };
+        this->executing.insert(this->current.sequence, execution);
+
+        this->queue.dequeue();
+    }
+
+    sendNext();
+}
+
+void ViscaSession::expireExecuting(qint64 now)
+{
+    QMap<quint32, Execution>::iterator iter = this->executing.begin();
+    while (iter != this->executing.end())
+    {
+        if (now - iter.value().sent < VISCA_COMPLETE_TIMEOUT)
+        {
+            ++iter;
+            continue;
+        }
+
+        emit commandFailed(this->address, "Command never completed");
+        iter = this->executing.erase(iter);
+    }
+}
+
+void ViscaSession::readReplies()
+{
+    while (this->socket->hasPendingDatagrams())
+    {
+        QByteArray data(static_cast<int>(this->socket->pendingDatagramSize()), 0);
+        this->socket->readDatagram(data.data(), data.size());
+
+        if (data.size() < 9)
+            continue;
+
+        const uchar* bytes = reinterpret_cast<const uchar*>(data.constData());
+        quint16 type = (bytes[0] << 8) | bytes[1];
+        quint32 sequence = (bytes[4] << 24) | (bytes[5] << 16) | (bytes[6] << 8) | bytes[7];
+        const uchar* payload = bytes + 8;
+
+        qint64 now = this->clock.elapsed();
+
+        if (type == CONTROL_REPLY_TYPE)
+        {
+            if (payload[0] == RESET_SEQUENCE && this->waiting && this->current.type == CONTROL_COMMAND_TYPE)
+            {
+                this->synchronized = true;
+                this->sequence = 0;
+                this->executing.clear();
+
+                acknowledged(now);
+            }
+            else if (payload[0] == CONTROL_ERROR && data.size() > 9 && payload[1] == ABNORMAL_SEQUENCE)
+            {
+                // The command at the head of the queue is sent again after the reset.
+                qWarning("VISCA sequence out of step with %s, resetting", qPrintable(this->address));
+
+                this->retransmitTimer.stop();
+                this->synchronized = false;
+                this->waiting = false;
+
+                sendNext();
+            }
+
+            continue;
+        }
+
+        if (type != VISCA_REPLY_TYPE || data.size() < 11)
+            continue;
+
+        switch (payload[1] & 0xF0)
+        {
+            case 0x40: // ACK
+            {
+                if (this->waiting && this->current.type == VISCA_COMMAND_TYPE && sequence == this->current.sequence)
+                    acknowledged(now);
+
+                break;
+            }
+            case 0x50: // Completion, inquiries complete without an ACK.
+            {
+                if (this->waiting && this->current.type == VISCA_COMMAND_TYPE && sequence == this->current.sequence)
+                    acknowledged(now);
+
+                if (this->executing.contains(sequence))
+                {
+                    Execution execution = this->executing.take(sequence);
+                    emit commandCompleted(this->address, execution.acknowledged, static_cast<int>(now - execution.sent));
+                }
+
+                break;
+            }
+            case 0x60: // Error
+            {
+                QString reason = QString("Error %1").arg(payload[2], 2, 16, QChar('0'));
+                if (this->waiting && this->current.type == VISCA_COMMAND_TYPE && sequence == this->current.sequence)
+                {
+                    this->retransmitTimer.stop();
+                    this->waiting = false;
+                    this->queue.dequeue();
+
+                    emit commandFailed(this->address, reason);
+
+                    sendNext();
+                }
+                else if (this->executing.remove(sequence) > 0)
+                {
+                    emit commandFailed(this->address, reason);
+                }
+
+                break;
+            }
+        }
+    }
+
+    expireExecuting(this->clock.elapsed());
+}
+
+void ViscaSession::replyTimeout()
+{
+    if (!this->waiting)
+        return;
+
+    if (this->current.retries < VISCA_MAX_RETRIES)
+    {
+        this->current.retries++;
+        transmit();
+
+        return;
+    }
+
+    this->waiting = false;
+    this->synchronized = false;
+
+    // The camera is gone or the address is wrong, drop the command rather than stall the queue.
+    this->queue.dequeue();
+
+    emit commandFailed(this->address, "No reply");
+
+    expireExecuting(this->clock.elapsed());
+    sendNext();
+}
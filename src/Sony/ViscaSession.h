@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include <QtNetwork/QHostAddress>
+
+#define VISCA_PORT              52381
+#define VISCA_ACK_TIMEOUT       100     // Milliseconds, a little more than 4 V-cycles.
+#define VISCA_COMPLETE_TIMEOUT  10000   // Milliseconds, a preset recall completes when the move is done.
+#define VISCA_MAX_RETRIES       3
+
+class QUdpSocket;
+
+// One VISCA over IP camera. Commands are queued and sent one at a time on a bound socket, each with the
+// next sequence number. A command is retransmitted until the camera acknowledges it, after which the
+// next one is sent while the camera executes. The sequence is reset with the camera first and whenever
+// it reports an abnormal sequence number.
+class SONY_EXPORT ViscaSession : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ViscaSession(const QString& address, QObject* parent = 0);
+
+        Q_SLOT void sendCommand(const QByteArray& command);
+
+        // Milliseconds from the first transmission until the camera acknowledged and completed the command.
+        Q_SIGNAL void commandCompleted(const QString&, int, int);
+        Q_SIGNAL void commandFailed(const QString&, const QString&);
+
+    private:
+        struct Message
+        {
+            quint16 type;
+            quint32 sequence;
+            QByteArray payload;
+            int retries;
+            qint64 sent;
+        };
+
+        struct Execution
+        {
+            qint64 sent;
+            int acknowledged;
+        };
+
+        QString address;
+        QHostAddress host;
+
+        QUdpSocket* socket;
+        QTimer retransmitTimer;
+        QElapsedTimer clock;
+
+        quint32 sequence;
+        bool synchronized;
+        bool waiting;
+
+        Message current;
+        QQueue<QByteArray> queue;
+        QMap<quint32, Execution> executing;
+
+        void sendNext();
+        void transmit();
+        void acknowledged(qint64 now);
+        void expireExecuting(qint64 now);
+
+        Q_SLOT void readReplies();
+        Q_SLOT void replyTimeout();
+};
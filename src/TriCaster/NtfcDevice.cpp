@@ -1,8 +1,16 @@
 #include "NtfcDevice.h"
 
-#include <QtCore/QStringList>
+#include <QtCore/QDebug>
 #include <QtCore/QTimer>
 
+#include <string.h>
+
+namespace
+{
+    // Anything bigger is a broken stream, not a message.
+    const uint32_t MAX_MESSAGE_SIZE = 16 * 1024 * 1024;
+}
+
 NtfcDevice::NtfcDevice(const QString& address, int port, QObject* parent)
     : QObject(parent),
       command(NtfcDevice::NONE), port(port), connected(false), address(address)
@@ -11,6 +19,7 @@ NtfcDevice::NtfcDevice(const QString& address, int port, QObject* parent)
 
     QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
     QObject::connect(this->socket, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
 }
 
 NtfcDevice::~NtfcDevice()
@@ -34,6 +43,7 @@ void NtfcDevice::disconnectDevice()
     this->socket->blockSignals(false);
 
     this->connected = false;
+    this->readBuffer.clear();
     this->command = NtfcDevice::CONNECTIONSTATE;
 
     sendNotification();
@@ -41,7 +51,11 @@ void NtfcDevice::disconnectDevice()
 
 void NtfcDevice::setConnected()
 {
+    // Shortcuts are small and latency matters more than throughput.
+    this->socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
     this->connected = true;
+    this->readBuffer.clear();
     this->command = NtfcDevice::CONNECTIONSTATE;
 
     sendNotification();
@@ -50,6 +64,7 @@ void NtfcDevice::setConnected()
 void NtfcDevice::setDisconnected()
 {
     this->connected = false;
+    this->readBuffer.clear();
     this->command = NtfcDevice::CONNECTIONSTATE;
 
     sendNotification();
@@ -74,31 +89,87 @@ const QString& NtfcDevice::getAddress() const
 
 void NtfcDevice::writeMessage(const QString& message)
 {
-    if (this->connected)
+    if (!this->connected)
+        return;
+
+    QString destination = "UI|shortcuts:response";
+
+    const unsigned int destinationDataSize = (destination.length() + 1) * sizeof(ushort);
+    const unsigned int messageDataSize = (message.length() + 1) * sizeof(ushort);
+
+    // Setup the transission header.
+    const TcpMessageHeader tcpMessageHeader = { 1, 0, destinationDataSize, static_cast<uint32_t>(sizeof(MessageHeader) + messageDataSize) };
+
+    // Setup the message header.
+    const MessageHeader messageHeader = { 2, messageDataSize };
+
+    // The whole message goes out in one write, a header on its own would leave in a segment of its own.
+    QByteArray data;
+    data.reserve(sizeof(tcpMessageHeader) + destinationDataSize + sizeof(messageHeader) + messageDataSize);
+    data.append(reinterpret_cast<const char*>(&tcpMessageHeader), sizeof(tcpMessageHeader));
+    data.append(reinterpret_cast<const char*>(destination.utf16()), destinationDataSize);
+    data.append(reinterpret_cast<const char*>(&messageHeader), sizeof(messageHeader));
+    data.append(reinterpret_cast<const char*>(message.utf16()), messageDataSize);
+
+    this->socket->write(data);
+    this->socket->flush();
+}
+
+void NtfcDevice::writeShortcuts(const QStringList& shortcuts)
+{
+    if (shortcuts.isEmpty())
+        return;
+
+    // One document for the whole cue, the TriCaster runs the shortcuts in order.
+    writeMessage(QString("<shortcuts>%1</shortcuts>").arg(shortcuts.join("")));
+}
+
+void NtfcDevice::readMessage()
+{
+    this->readBuffer.append(this->socket->readAll());
+
+    while (this->readBuffer.size() >= static_cast<int>(sizeof(TcpMessageHeader)))
     {
-        QString destination = "UI|shortcuts:response";
+        TcpMessageHeader tcpMessageHeader;
+        memcpy(&tcpMessageHeader, this->readBuffer.constData(), sizeof(tcpMessageHeader));
+
+        if (tcpMessageHeader.versionNo != 1 || tcpMessageHeader.destinationSize > MAX_MESSAGE_SIZE ||
+            tcpMessageHeader.messageSize < sizeof(MessageHeader) || tcpMessageHeader.messageSize > MAX_MESSAGE_SIZE)
+        {
+            qWarning("Unexpected NTFC data from %s, dropping %d bytes", qPrintable(this->address), this->readBuffer.size());
+
+            this->readBuffer.clear();
+            return;
+        }
+
+        const int size = sizeof(tcpMessageHeader) + tcpMessageHeader.destinationSize + tcpMessageHeader.messageSize;
+        if (this->readBuffer.size() < size)
+            return; // Wait for the rest.
+
+        const char* data = this->readBuffer.constData() + sizeof(tcpMessageHeader) + tcpMessageHeader.destinationSize;
 
-        const ushort* destinationData = destination.utf16();
-        const ushort* messageData = message.utf16();
+        MessageHeader messageHeader;
+        memcpy(&messageHeader, data, sizeof(messageHeader));
 
-        const unsigned int destinationDataSize = (destination.length() + 1) * sizeof(ushort);
-        const unsigned int messageDataSize = (message.length() + 1) * sizeof(ushort);
+        // Only XML is of any use to us, the size includes the terminating null.
+        if (messageHeader.type == 2 && messageHeader.size <= tcpMessageHeader.messageSize - sizeof(MessageHeader))
+        {
+            QString message = QString::fromUtf16(reinterpret_cast<const ushort*>(data + sizeof(messageHeader)), messageHeader.size / sizeof(ushort));
+            if (message.endsWith(QChar::Null))
+                message.chop(1);
 
-        // Setup the transission header.
-        const TcpMessageHeader tcpMessageHeader = { 1, 0, destinationDataSize, static_cast<uint32_t>(sizeof(MessageHeader) + messageDataSize) };
+            this->response = message;
+            this->command = NtfcDevice::RESPONSE;
 
-        // Setup the message header.
-        const MessageHeader messageHeader = { 2, messageDataSize };
+            sendNotification();
+        }
 
-        this->socket->write((char*)&tcpMessageHeader, sizeof(tcpMessageHeader));    // Send tcp header.
-        this->socket->write((char*)destinationData, destinationDataSize);           // Send destination.
-        this->socket->write((char*)&messageHeader, sizeof(messageHeader));          // Send message header.
-        this->socket->write((char*)messageData, messageDataSize);                   // Send message.
-        this->socket->flush();
+        this->readBuffer.remove(0, size);
     }
 }
 
 void NtfcDevice::resetDevice()
 {
     this->command = NtfcDevice::NONE;
+    this->response.clear();
 }
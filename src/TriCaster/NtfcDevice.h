@@ -4,7 +4,9 @@
 
 #include <stdint.h>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QObject>
+#include <QtCore/QStringList>
 
 #include <QtNetwork/QTcpSocket>
 #include <QtNetwork/QAbstractSocket>
@@ -29,16 +31,19 @@ class TRICASTER_EXPORT NtfcDevice : public QObject
         enum NtfcDeviceCommand
         {
             NONE,
-            CONNECTIONSTATE
+            CONNECTIONSTATE,
+            RESPONSE
         };
 
         QTcpSocket* socket;
         NtfcDeviceCommand command;
+        QString response;
 
         virtual void sendNotification() = 0;
 
         void resetDevice();
         void writeMessage(const QString& message);
+        void writeShortcuts(const QStringList& shortcuts);
 
     private:
         struct TcpMessageHeader
@@ -59,8 +64,9 @@ class TRICASTER_EXPORT NtfcDevice : public QObject
         int port;
         bool connected;
         QString address;
+        QByteArray readBuffer;
 
-        //Q_SLOT void readMessage();
+        Q_SLOT void readMessage();
         Q_SLOT void setConnected();
         Q_SLOT void setDisconnected();
 };
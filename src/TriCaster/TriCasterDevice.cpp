@@ -1,9 +1,23 @@
 #include "TriCasterDevice.h"
 
 #include <QtCore/QStringList>
+#include <QtCore/QXmlStreamReader>
 
 #include <QtNetwork/QHostInfo>
 
+namespace
+{
+    QString shortcut(const QString& name)
+    {
+        return QString("<shortcut name=\"%1\" />").arg(name.toHtmlEscaped());
+    }
+
+    QString shortcut(const QString& name, const QString& value)
+    {
+        return QString("<shortcut name=\"%1\" value=\"%2\" />").arg(name.toHtmlEscaped()).arg(value.toHtmlEscaped());
+    }
+}
+
 TriCasterDevice::TriCasterDevice(const QString& address, int port, QObject* parent)
     : NtfcDevice(address, port, parent)
 {
@@ -11,46 +25,115 @@ TriCasterDevice::TriCasterDevice(const QString& address, int port, QObject* pare
 
 void TriCasterDevice::triggerAuto(const QString& target, const QString& speed, const QString& transition)
 {
+    QStringList shortcuts;
+
     if (!speed.isEmpty())
-        writeMessage(QString("<shortcuts><shortcut name=\"%1_%2\" value=\"true\" /></shortcuts>").arg(target).arg(speed));
+        shortcuts.append(shortcut(QString("%1_%2").arg(target).arg(speed), "true"));
 
     if (!transition.isEmpty())
-        writeMessage(QString("<shortcuts><shortcut name=\"%1_select_index\" value=\"%2\" /></shortcuts>").arg(target).arg(transition));
+        shortcuts.append(shortcut(QString("%1_select_index").arg(target), transition));
+
+    shortcuts.append(shortcut(QString("%1_auto").arg(target)));
 
-    writeMessage(QString("<shortcuts><shortcut name=\"%1_auto\" /></shortcuts>").arg(target));
+    writeShortcuts(shortcuts);
 }
 
 void TriCasterDevice::triggerTake(const QString& target)
 {
-    writeMessage(QString("<shortcuts><shortcut name=\"%1_take\" /></shortcuts>").arg(target));
+    writeShortcuts(QStringList() << shortcut(QString("%1_take").arg(target)));
 }
 
 void TriCasterDevice::selectInput(const QString& switcher, const QString& input, const QString& product)
 {
     if (product == "TriCaster 850")
-        writeMessage(QString("<shortcuts><shortcut name=\"switcher_%1_named_input\" value=\"%2\" /></shortcuts>").arg(switcher).arg(input));
+        writeShortcuts(QStringList() << shortcut(QString("switcher_%1_named_input").arg(switcher), input));
     else
     {
         if (switcher == "pgm")
-            writeMessage(QString("<shortcuts><shortcut name=\"main_a_row_named_input\" value=\"%1\" /></shortcuts>").arg(input));
+            writeShortcuts(QStringList() << shortcut("main_a_row_named_input", input));
         else if (switcher == "prev")
-            writeMessage(QString("<shortcuts><shortcut name=\"main_b_row_named_input\" value=\"%1\" /></shortcuts>").arg(input));
+            writeShortcuts(QStringList() << shortcut("main_b_row_named_input", input));
     }
 }
 
 void TriCasterDevice::selectNetworkSource(const QString& target, const QString& source)
 {
-    writeMessage(QString("<shortcuts><shortcut name=\"%1_source\" value=\"%2\" /></shortcuts>").arg(target).arg(source));
+    writeShortcuts(QStringList() << shortcut(QString("%1_source").arg(target), source));
 }
 
 void TriCasterDevice::playMacro(const QString& name)
 {
-    writeMessage(QString("<shortcuts><shortcut name=\"play_macro_byname\" value=\"%1\" /></shortcuts>").arg(name));
+    writeShortcuts(QStringList() << shortcut("play_macro_byname", name));
 }
 
 void TriCasterDevice::selectPreset(const QString& source, const QString& preset)
 {
-    writeMessage(QString("<shortcuts><shortcut name=\"%1_select_preset\" value=\"%2\" /></shortcuts>").arg(source).arg(preset));
+    writeShortcuts(QStringList() << shortcut(QString("%1_select_preset").arg(source), preset));
+}
+
+int TriCasterDevice::getTally(const QString& input) const
+{
+    int tally = TriCasterDevice::TallyNone;
+    if (input.isEmpty())
+        return tally;
+
+    if (QString::compare(input, this->programInput, Qt::CaseInsensitive) == 0)
+        tally |= TriCasterDevice::TallyProgram;
+
+    if (QString::compare(input, this->previewInput, Qt::CaseInsensitive) == 0)
+        tally |= TriCasterDevice::TallyPreview;
+
+    return tally;
+}
+
+void TriCasterDevice::parseResponse(const QString& response)
+{
+    // The state notifications we registered for carry name and value pairs, as
+    // <shortcut_state name="" value="" />. Replies to our shortcuts use <shortcut name="" value="" />.
+    bool changed = false;
+
+    QXmlStreamReader reader(response);
+    while (!reader.atEnd())
+    {
+        if (reader.readNext() != QXmlStreamReader::StartElement)
+            continue;
+
+        if (reader.name() != "shortcut_state" && reader.name() != "shortcut")
+            continue;
+
+        const QXmlStreamAttributes attributes = reader.attributes();
+        if (!attributes.hasAttribute("name") || !attributes.hasAttribute("value"))
+            continue;
+
+        QString name = attributes.value("name").toString().toLower();
+        QString value = attributes.value("value").toString();
+        if (this->states.contains(name) && this->states.value(name) == value)
+            continue;
+
+        this->states.insert(name, value);
+        changed = true;
+    }
+
+    if (reader.hasError())
+        qDebug("Unable to parse the TriCaster response: %s", qPrintable(reader.errorString()));
+
+    if (changed)
+        updateTally();
+}
+
+void TriCasterDevice::updateTally()
+{
+    // The 850 names the rows after the switcher, later models after the A and B rows.
+    QString programInput = this->states.value("main_a_row_named_input", this->states.value("switcher_pgm_named_input"));
+    QString previewInput = this->states.value("main_b_row_named_input", this->states.value("switcher_prev_named_input"));
+
+    if (programInput == this->programInput && previewInput == this->previewInput)
+        return;
+
+    this->programInput = programInput;
+    this->previewInput = previewInput;
+
+    emit tallyChanged(*this);
 }
 
 void TriCasterDevice::sendNotification()
@@ -59,10 +142,27 @@ void TriCasterDevice::sendNotification()
     {
         case NtfcDevice::CONNECTIONSTATE:
         {
+            // The TriCaster only reports its shortcut states to clients that ask for them.
+            if (isConnected())
+                writeMessage("<register name=\"NTK_states\" />");
+
+            // Whatever we knew about the switcher is stale once the connection is gone.
+            if (!isConnected() && !this->states.isEmpty())
+            {
+                this->states.clear();
+                updateTally();
+            }
+
             emit connectionStateChanged(*this);
 
             break;
         }
+        case NtfcDevice::RESPONSE:
+        {
+            parseResponse(NtfcDevice::response);
+
+            break;
+        }
         default:
         {
             break;
@@ -4,11 +4,21 @@
 
 #include "NtfcDevice.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
 class TRICASTER_EXPORT TriCasterDevice : public NtfcDevice
 {
     Q_OBJECT
 
     public:
+        enum Tally
+        {
+            TallyNone = 0,
+            TallyProgram = 1,
+            TallyPreview = 2
+        };
+
         explicit TriCasterDevice(const QString& address, int port = 5950, QObject* parent = 0);
 
         void triggerAuto(const QString& target, const QString& speed, const QString& transition);
@@ -21,8 +31,20 @@ class TRICASTER_EXPORT TriCasterDevice : public NtfcDevice
 
         void playMacro(const QString& name);
 
+        int getTally(const QString& input) const;
+
         Q_SIGNAL void connectionStateChanged(TriCasterDevice&);
+        Q_SIGNAL void tallyChanged(TriCasterDevice&);
 
     protected:
         void sendNotification();
+
+    private:
+        // Shortcut states as the TriCaster last reported them, by lower case name.
+        QHash<QString, QString> states;
+        QString programInput;
+        QString previewInput;
+
+        void parseResponse(const QString& response);
+        void updateTally();
 };
@@ -2,15 +2,48 @@
 
 #include "Global.h"
 
-#include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
 
+#include <QtGui/QLinearGradient>
+#include <QtGui/QPainter>
+
+namespace
+{
+    const int SCALE_WIDTH = 20;
+    const int GROUP_SPACING = 6;
+    const int MAXIMUM_BAR_WIDTH = 12;
+    const float REPAINT_THRESHOLD = 0.1f;
+
+    const int SCALE_LEVELS[] = { 0, -9, -20, -60 };
+
+    int levelToY(float level, const QRect& area)
+    {
+        float position = (level - AudioMeter::MINIMUM_LEVEL) / -AudioMeter::MINIMUM_LEVEL;
+        return area.bottom() - qRound(qBound(0.0f, position, 1.0f) * area.height());
+    }
+
+    bool hasMoved(const QVector<AudioMeterManager::Meter>& current, const QVector<AudioMeterManager::Meter>& next)
+    {
+        if (current.count() != next.count())
+            return true;
+
+        for (int i = 0; i < current.count(); i++)
+        {
+            if (qAbs(current[i].level - next[i].level) > REPAINT_THRESHOLD || qAbs(current[i].peak - next[i].peak) > REPAINT_THRESHOLD)
+                return true;
+        }
+
+        return false;
+    }
+}
+
 AudioMeterWidget::AudioMeterWidget(QWidget* parent)
     : QWidget(parent),
-      channel(-1), model(NULL), command(NULL), audioSubscription(NULL)
+      channel(-1), model(NULL), command(NULL), refreshTimer(this), meters(AudioMeter::MAX_CHANNELS)
 {
-    setupUi(this);
+    this->refreshTimer.setInterval(AudioMeter::REFRESH_INTERVAL);
+    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refreshMeters()));
 
     QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(channelChanged(const ChannelChangedEvent&)), this, SLOT(channelChanged(const ChannelChangedEvent&)));
@@ -18,35 +51,46 @@ AudioMeterWidget::AudioMeterWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
-void AudioMeterWidget::configureAudioMeter(int channel)
+void AudioMeterWidget::showEvent(QShowEvent* event)
 {
-    this->channel = channel;
-    this->labelAudioMeterChannel->setText(QString("Ch %1").arg(channel));
+    QWidget::showEvent(event);
+
+    updateRefreshTimer();
+}
+
+void AudioMeterWidget::hideEvent(QHideEvent* event)
+{
+    QWidget::hideEvent(event);
+
+    updateRefreshTimer();
+}
+
+void AudioMeterWidget::updateRefreshTimer()
+{
+    // Nothing is read while the meters can't be seen.
+    bool active = isVisible() && !this->address.isEmpty();
+    if (active && !this->refreshTimer.isActive())
+        this->refreshTimer.start();
+    else if (!active && this->refreshTimer.isActive())
+        this->refreshTimer.stop();
 }
 
 void AudioMeterWidget::deviceChanged(const DeviceChangedEvent& event)
 {
-    if (this->model == NULL)
+    if (this->model == NULL || this->command == NULL)
         return;
 
     if (!event.getDeviceName().isEmpty() && event.getDeviceName() != this->model->getDeviceName())
     {
-        if (this->audioSubscription != NULL)
-            this->audioSubscription->disconnect(); // Disconnect all events.
-
-        if (DeviceManager::getInstance().getDeviceByName(event.getDeviceName()) == NULL)
+        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(event.getDeviceName());
+        if (device == NULL)
             return;
 
-        this->progressBarAudioMeter->setValue(-61);
-        this->progressBarAudioMeter->update();
+        this->address = device->resolveIpAddress();
+        this->channel = this->command->getChannel();
 
-        QString audioFilter = Osc::DEFAULT_AUDIO_FILTER;
-        audioFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(event.getDeviceName())->resolveIpAddress()))
-                   .replace("#CHANNEL#", QString("%1").arg(this->command->getChannel()))
-                   .replace("#AUDIOCHANNEL#", QString("%1").arg(this->channel));
-        this->audioSubscription = new OscSubscription(audioFilter, this);
-        QObject::connect(this->audioSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                         this, SLOT(audioSubscriptionReceived(const QString&, const QList<QVariant>&)));
+        refreshMeters();
+        updateRefreshTimer();
     }
 }
 
@@ -54,20 +98,17 @@ void AudioMeterWidget::channelChanged(const ChannelChangedEvent& event)
 {
     Q_UNUSED(event);
 
-    configureOscSubscriptions();
+    configureMeters();
 }
 
 void AudioMeterWidget::emptyRundown(const EmptyRundownEvent& event)
 {
     Q_UNUSED(event);
 
-    if (this->audioSubscription != NULL)
-        this->audioSubscription->disconnect(); // Disconnect all events.
-
     this->model = NULL;
+    this->command = NULL;
 
-    this->progressBarAudioMeter->setValue(-61);
-    this->progressBarAudioMeter->update();
+    configureMeters();
 }
 
 void AudioMeterWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -75,41 +116,119 @@ void AudioMeterWidget::rundownItemSelected(const RundownItemSelectedEvent& event
     this->model = event.getLibraryModel();
     this->command = dynamic_cast<AbstractCommand*>(event.getCommand());
 
-    configureOscSubscriptions();
+    configureMeters();
 }
 
-void AudioMeterWidget::configureOscSubscriptions()
+void AudioMeterWidget::configureMeters()
 {
-    if (this->audioSubscription != NULL)
-        this->audioSubscription->disconnect(); // Disconnect all events.
+    this->address.clear();
+    this->channel = -1;
 
-    if (this->model == NULL)
-        return;
+    if (this->model != NULL && this->command != NULL)
+    {
+        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
+        if (device != NULL)
+        {
+            this->address = device->resolveIpAddress();
+            this->channel = this->command->getChannel();
+        }
+    }
 
-    if (DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName()) == NULL)
-        return;
+    refreshMeters();
+    updateRefreshTimer();
+}
 
-    QString audioFilter = Osc::DEFAULT_AUDIO_FILTER;
-    audioFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command->getChannel()))
-               .replace("#AUDIOCHANNEL#", QString("%1").arg(this->channel));
-    this->audioSubscription = new OscSubscription(audioFilter, this);
-    QObject::connect(this->audioSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(audioSubscriptionReceived(const QString&, const QList<QVariant>&)));
+void AudioMeterWidget::refreshMeters()
+{
+    bool moved = false;
+    for (int i = 0; i < AudioMeter::MAX_CHANNELS; i++)
+    {
+        if (this->address.isEmpty())
+            this->buffer.clear();
+        else
+            AudioMeterManager::getInstance().readMeters(this->address, i + 1, this->buffer);
+
+        if (hasMoved(this->meters[i], this->buffer))
+        {
+            this->meters[i] = this->buffer;
+            moved = true;
+        }
+    }
+
+    if (moved)
+        update();
 }
 
-void AudioMeterWidget::audioSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void AudioMeterWidget::paintEvent(QPaintEvent* event)
 {
-    Q_UNUSED(predicate);
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+
+    QFont font = painter.font();
+    font.setPixelSize(8);
+    painter.setFont(font);
+
+    int labelHeight = painter.fontMetrics().height();
+    QRect area = rect().adjusted(4, labelHeight + 4, -4, -4 - labelHeight / 2);
+    if (area.height() <= 0 || area.width() <= SCALE_WIDTH)
+        return;
+
+    // The scale, labelled like a desk meter.
+    painter.setPen(QColor(128, 128, 128));
+    for (unsigned int i = 0; i < sizeof(SCALE_LEVELS) / sizeof(SCALE_LEVELS[0]); i++)
+    {
+        int y = levelToY(SCALE_LEVELS[i], area);
+        painter.drawText(QRect(area.left(), y - labelHeight / 2, SCALE_WIDTH - 4, labelHeight), Qt::AlignRight | Qt::AlignVCenter, QString::number(SCALE_LEVELS[i]));
+    }
 
-    //qDebug("%s%s", qPrintable(predicate), qPrintable(arguments));
+    int groups = 0;
+    int bars = 0;
+    for (int i = 0; i < AudioMeter::MAX_CHANNELS; i++)
+    {
+        if (!this->meters[i].isEmpty())
+        {
+            groups++;
+            bars += this->meters[i].count();
+        }
+    }
+
+    if (bars == 0)
+        return;
 
-    int value = arguments.at(0).toInt();
-    if (value < -60)
-        this->progressBarAudioMeter->setValue(-61);
-    else
+    int available = area.width() - SCALE_WIDTH - (groups - 1) * GROUP_SPACING;
+    int barWidth = qBound(2, available / bars, MAXIMUM_BAR_WIDTH);
+
+    QLinearGradient gradient(0, area.bottom(), 0, area.top());
+    gradient.setColorAt(0, QColor(Qt::darkGreen));
+    gradient.setColorAt(1, QColor(0, 255, 0));
+
+    int x = area.left() + SCALE_WIDTH;
+    for (int i = 0; i < AudioMeter::MAX_CHANNELS; i++)
     {
-        this->progressBarAudioMeter->setValue(arguments.at(0).toInt());
-        this->progressBarAudioMeter->update();
+        const QVector<AudioMeterManager::Meter>& meters = this->meters[i];
+        if (meters.isEmpty())
+            continue;
+
+        int groupWidth = meters.count() * barWidth;
+
+        painter.setPen((i + 1 == this->channel) ? QColor(255, 255, 255) : QColor(128, 128, 128));
+        painter.drawText(QRect(x, 2, qMax(groupWidth, 24), labelHeight), Qt::AlignLeft | Qt::AlignVCenter, QString("Ch %1").arg(i + 1));
+
+        foreach (const AudioMeterManager::Meter& meter, meters)
+        {
+            QRect bar(x, area.top(), barWidth - 1, area.height());
+            painter.fillRect(bar, QColor(42, 42, 42));
+
+            int top = levelToY(meter.level, area);
+            painter.fillRect(QRect(bar.left(), top, bar.width(), area.bottom() - top), gradient);
+
+            int peak = levelToY(meter.peak, area);
+            painter.fillRect(QRect(bar.left(), peak, bar.width(), 2), (meter.peak >= 0.0f) ? QColor(Qt::red) : QColor(0, 255, 0));
+
+            x += barWidth;
+        }
+
+        x += GROUP_SPACING;
     }
 }
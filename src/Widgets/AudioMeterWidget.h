@@ -1,40 +1,55 @@
 #pragma once
 
 #include "Shared.h"
-#include "ui_AudioMeterWidget.h"
 
-#include "OscSubscription.h"
+#include "AudioMeterManager.h"
+#include "Commands/AbstractCommand.h"
 #include "Events/Inspector/ChannelChangedEvent.h"
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Rundown/EmptyRundownEvent.h"
 #include "Events/Rundown/RundownItemSelectedEvent.h"
 #include "Models/LibraryModel.h"
 
-#include <QtGui/QImage>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+#include <QtGui/QHideEvent>
+#include <QtGui/QPaintEvent>
+#include <QtGui/QShowEvent>
 
 #include <QtWidgets/QWidget>
 
-class WIDGETS_EXPORT AudioMeterWidget : public QWidget, Ui::AudioMeterWidget
+// Every audio channel of every CasparCG channel on the selected item's server in one widget. The levels
+// are read from AudioMeterManager at a fixed display rate and only repainted when they have moved.
+class WIDGETS_EXPORT AudioMeterWidget : public QWidget
 {
     Q_OBJECT
 
     public:
         explicit AudioMeterWidget(QWidget* parent = 0);
 
-        void configureAudioMeter(int channel);
+    protected:
+        void paintEvent(QPaintEvent* event);
+        void showEvent(QShowEvent* event);
+        void hideEvent(QHideEvent* event);
 
     private:
+        QString address;
         int channel;
         LibraryModel* model;
         AbstractCommand* command;
 
-        OscSubscription* audioSubscription;
+        QTimer refreshTimer;
+        QVector<AudioMeterManager::Meter> buffer;
+        QVector<QVector<AudioMeterManager::Meter>> meters;
 
-        void configureOscSubscriptions();
+        void configureMeters();
+        void updateRefreshTimer();
 
+        Q_SLOT void refreshMeters();
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
         Q_SLOT void channelChanged(const ChannelChangedEvent&);
         Q_SLOT void emptyRundown(const EmptyRundownEvent&);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
-        Q_SLOT void audioSubscriptionReceived(const QString&, const QList<QVariant>&);
 };
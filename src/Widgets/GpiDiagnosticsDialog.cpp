@@ -0,0 +1,61 @@
+#include "GpiDiagnosticsDialog.h"
+
+#include "GpiManager.h"
+
+#include <QtCore/QString>
+
+#include <QtWidgets/QTreeWidgetItem>
+
+namespace
+{
+    QString formatLatency(qint64 micros)
+    {
+        return (micros < 1000) ? QString("%1 ms").arg(micros / 1000.0, 0, 'f', 1) : QString("%1 ms").arg(micros / 1000);
+    }
+}
+
+GpiDiagnosticsDialog::GpiDiagnosticsDialog(QWidget* parent)
+    : QDialog(parent),
+      refreshTimer(this)
+{
+    setupUi(this);
+
+    foreach (const GpiManager::LatencyBucket& bucket, GpiManager::getInstance().getLatencyHistogram())
+    {
+        QTreeWidgetItem* item = new QTreeWidgetItem(this->treeWidgetLatency);
+        item->setText(0, (bucket.upperBound == -1) ? "Slower" : QString("Below %1").arg(formatLatency(bucket.upperBound)));
+        item->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+        item->setTextAlignment(2, Qt::AlignRight | Qt::AlignVCenter);
+    }
+
+    this->refreshTimer.setInterval(500);
+    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    this->refreshTimer.start();
+
+    refresh();
+}
+
+void GpiDiagnosticsDialog::refresh()
+{
+    const GpiManager& manager = GpiManager::getInstance();
+
+    int triggers = manager.getTriggerCount();
+    QList<GpiManager::LatencyBucket> histogram = manager.getLatencyHistogram();
+    for (int i = 0; i < histogram.count() && i < this->treeWidgetLatency->topLevelItemCount(); i++)
+    {
+        QTreeWidgetItem* item = this->treeWidgetLatency->topLevelItem(i);
+        item->setText(1, QString("%1").arg(histogram.at(i).count));
+        item->setText(2, (triggers > 0) ? QString("%1%").arg(histogram.at(i).count * 100 / triggers) : "");
+    }
+
+    this->labelTriggers->setText(QString("%1 triggers, %2 ignored as contact bounce").arg(triggers).arg(manager.getDebouncedCount()));
+    this->labelLatency->setText((triggers > 0) ? QString("Average %1, worst %2").arg(formatLatency(manager.getAverageLatency())).arg(formatLatency(manager.getMaxLatency()))
+                                               : QString("No triggers yet"));
+}
+
+void GpiDiagnosticsDialog::resetStatistics()
+{
+    GpiManager::getInstance().resetLatency();
+
+    refresh();
+}
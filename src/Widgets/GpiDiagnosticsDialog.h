@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Shared.h"
+#include "ui_GpiDiagnosticsDialog.h"
+
+#include <QtCore/QTimer>
+
+#include <QtWidgets/QDialog>
+#include <QtWidgets/QWidget>
+
+// Shows how long GPI pulses take from the serial port until their command is on the way to the server.
+class WIDGETS_EXPORT GpiDiagnosticsDialog : public QDialog, Ui::GpiDiagnosticsDialog
+{
+    Q_OBJECT
+
+    public:
+        explicit GpiDiagnosticsDialog(QWidget* parent = 0);
+
+    private:
+        QTimer refreshTimer;
+
+        Q_SLOT void refresh();
+        Q_SLOT void resetStatistics();
+};
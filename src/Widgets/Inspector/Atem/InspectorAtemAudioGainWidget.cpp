@@ -24,6 +24,8 @@ void InspectorAtemAudioGainWidget::rundownItemSelected(const RundownItemSelected
     this->command = nullptr;
     this->model = event.getLibraryModel();
 
+    setDevice(NULL);
+
     blockAllSignals(true);
 
     if (dynamic_cast<AtemAudioGainCommand*>(event.getCommand()))
@@ -34,7 +36,7 @@ void InspectorAtemAudioGainWidget::rundownItemSelected(const RundownItemSelected
         const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
         if (device != NULL)
         {
-            this->inputs = device->inputInfos();
+            setDevice(device.data());
 
             loadAtemAudioInput();
         }
@@ -60,7 +62,7 @@ void InspectorAtemAudioGainWidget::atemDeviceChanged(const AtemDeviceChangedEven
             const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(event.getDeviceName());
             if (device != NULL)
             {
-                this->inputs = device->inputInfos();
+                setDevice(device.data());
 
                 loadAtemAudioInput();
                 checkEmptyInput();
@@ -69,18 +71,56 @@ void InspectorAtemAudioGainWidget::atemDeviceChanged(const AtemDeviceChangedEven
     }
 }
 
+void InspectorAtemAudioGainWidget::setDevice(AtemDevice* device)
+{
+    if (this->device == device)
+        return;
+
+    if (this->device != NULL)
+        QObject::disconnect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+
+    this->device = device;
+
+    if (this->device != NULL)
+        QObject::connect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+}
+
+void InspectorAtemAudioGainWidget::inputsChanged(AtemDevice& device)
+{
+    Q_UNUSED(device);
+
+    if (this->command == NULL)
+        return;
+
+    // The switcher's input table changed while the item is selected, refill the list and keep the selection.
+    blockAllSignals(true);
+
+    loadAtemAudioInput();
+
+    this->comboBoxInput->setCurrentIndex(this->comboBoxInput->findData(this->command->getInput()));
+
+    checkEmptyInput();
+
+    blockAllSignals(false);
+}
+
 void InspectorAtemAudioGainWidget::loadAtemAudioInput()
 {
     // We do not have a command object, block the signals.
     // Events will not be triggered while we update the values.
     this->comboBoxInput->blockSignals(true);
 
+    this->comboBoxInput->clear();
     this->comboBoxInput->addItem("Master", "0");
 
-    foreach (quint16 key, this->inputs.keys())
+    QMap<quint16, QAtem::InputInfo> inputs;
+    if (this->device != NULL)
+        inputs = this->device->inputInfos();
+
+    foreach (quint16 key, inputs.keys())
     {
-        if (this->inputs.value(key).internalType == 0 || this->inputs.value(key).internalType == 4)
-            this->comboBoxInput->addItem(this->inputs.value(key).longText, this->inputs.value(key).index);
+        if (inputs.value(key).internalType == 0 || inputs.value(key).internalType == 4)
+            this->comboBoxInput->addItem(inputs.value(key).longText, inputs.value(key).index);
     }
 
     this->comboBoxInput->blockSignals(false);
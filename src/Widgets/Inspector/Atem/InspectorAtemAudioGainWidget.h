@@ -14,6 +14,7 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 
 #include <QtWidgets/QWidget>
 
@@ -27,10 +28,11 @@ class WIDGETS_EXPORT InspectorAtemAudioGainWidget : public QWidget, Ui::Inspecto
     private:
         LibraryModel* model;
         AtemAudioGainCommand* command;
-        QMap<quint16, QAtem::InputInfo> inputs;
+        QPointer<AtemDevice> device;
 
         void checkEmptyInput();
         void blockAllSignals(bool block);
+        void setDevice(AtemDevice* device);
         void loadAtemAudioInput();
 
         Q_SLOT void inputChanged(int);
@@ -39,4 +41,5 @@ class WIDGETS_EXPORT InspectorAtemAudioGainWidget : public QWidget, Ui::Inspecto
         Q_SLOT void triggerOnNextChanged(int);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
         Q_SLOT void atemDeviceChanged(const AtemDeviceChangedEvent&);
+        Q_SLOT void inputsChanged(AtemDevice&);
 };
@@ -24,6 +24,8 @@ void InspectorAtemAudioInputStateWidget::rundownItemSelected(const RundownItemSe
     this->command = nullptr;
     this->model = event.getLibraryModel();
 
+    setDevice(NULL);
+
     blockAllSignals(true);
 
     if (dynamic_cast<AtemAudioInputStateCommand*>(event.getCommand()))
@@ -34,7 +36,7 @@ void InspectorAtemAudioInputStateWidget::rundownItemSelected(const RundownItemSe
         const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
         if (device != NULL)
         {
-            this->inputs = device->inputInfos();
+            setDevice(device.data());
 
             loadAtemInputState();
             loadAtemAudioInput();
@@ -61,7 +63,7 @@ void InspectorAtemAudioInputStateWidget::atemDeviceChanged(const AtemDeviceChang
             const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(event.getDeviceName());
             if (device != NULL)
             {
-                this->inputs = device->inputInfos();
+                setDevice(device.data());
 
                 loadAtemInputState();
                 loadAtemAudioInput();
@@ -72,6 +74,39 @@ void InspectorAtemAudioInputStateWidget::atemDeviceChanged(const AtemDeviceChang
     }
 }
 
+void InspectorAtemAudioInputStateWidget::setDevice(AtemDevice* device)
+{
+    if (this->device == device)
+        return;
+
+    if (this->device != NULL)
+        QObject::disconnect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+
+    this->device = device;
+
+    if (this->device != NULL)
+        QObject::connect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+}
+
+void InspectorAtemAudioInputStateWidget::inputsChanged(AtemDevice& device)
+{
+    Q_UNUSED(device);
+
+    if (this->command == NULL)
+        return;
+
+    // The switcher's input table changed while the item is selected, refill the list and keep the selection.
+    blockAllSignals(true);
+
+    loadAtemAudioInput();
+
+    this->comboBoxInput->setCurrentIndex(this->comboBoxInput->findData(this->command->getInput()));
+
+    checkEmptyInput();
+
+    blockAllSignals(false);
+}
+
 void InspectorAtemAudioInputStateWidget::loadAtemAudioInput()
 {
     // We do not have a command object, block the signals.
@@ -80,10 +115,15 @@ void InspectorAtemAudioInputStateWidget::loadAtemAudioInput()
 
     this->comboBoxInput->clear();
     this->comboBoxInput->addItem("Master", "0");
-    foreach (quint16 key, this->inputs.keys())
+
+    QMap<quint16, QAtem::InputInfo> inputs;
+    if (this->device != NULL)
+        inputs = this->device->inputInfos();
+
+    foreach (quint16 key, inputs.keys())
     {
-        if (this->inputs.value(key).internalType == 0 || this->inputs.value(key).internalType == 4)
-            this->comboBoxInput->addItem(this->inputs.value(key).longText, this->inputs.value(key).index);
+        if (inputs.value(key).internalType == 0 || inputs.value(key).internalType == 4)
+            this->comboBoxInput->addItem(inputs.value(key).longText, inputs.value(key).index);
     }
 
     this->comboBoxInput->blockSignals(false);
@@ -14,6 +14,7 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 
 #include <QtWidgets/QWidget>
 
@@ -27,12 +28,13 @@ class WIDGETS_EXPORT InspectorAtemAudioInputStateWidget : public QWidget, Ui::In
     private:
         LibraryModel* model;
         AtemAudioInputStateCommand* command;
-        QMap<quint16, QAtem::InputInfo> inputs;
+        QPointer<AtemDevice> device;
 
         void checkEmptyInput();
         void checkEmptyState();
         void loadAtemInputState();
         void blockAllSignals(bool block);
+        void setDevice(AtemDevice* device);
         void loadAtemAudioInput();
 
         Q_SLOT void inputChanged(int);
@@ -40,4 +42,5 @@ class WIDGETS_EXPORT InspectorAtemAudioInputStateWidget : public QWidget, Ui::In
         Q_SLOT void triggerOnNextChanged(int);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
         Q_SLOT void atemDeviceChanged(const AtemDeviceChangedEvent&);
+        Q_SLOT void inputsChanged(AtemDevice&);
 };
@@ -25,6 +25,8 @@ void InspectorAtemInputWidget::rundownItemSelected(const RundownItemSelectedEven
     this->command = nullptr;
     this->model = event.getLibraryModel();
 
+    setDevice(NULL);
+
     blockAllSignals(true);
 
     if (dynamic_cast<AtemInputCommand*>(event.getCommand()))
@@ -35,7 +37,7 @@ void InspectorAtemInputWidget::rundownItemSelected(const RundownItemSelectedEven
         const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
         if (device != NULL)
         {
-            this->inputs = device->inputInfos();
+            setDevice(device.data());
             this->mixerEffects = device->mixerEffects();
 
             loadAtemMixerStep();
@@ -66,7 +68,7 @@ void InspectorAtemInputWidget::atemDeviceChanged(const AtemDeviceChangedEvent& e
             const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(event.getDeviceName());
             if (device != NULL)
             {
-                this->inputs = device->inputInfos();
+                setDevice(device.data());
                 this->mixerEffects = device->mixerEffects();
 
                 loadAtemSwitcher();
@@ -80,6 +82,42 @@ void InspectorAtemInputWidget::atemDeviceChanged(const AtemDeviceChangedEvent& e
     }
 }
 
+void InspectorAtemInputWidget::setDevice(AtemDevice* device)
+{
+    if (this->device == device)
+        return;
+
+    if (this->device != NULL)
+        QObject::disconnect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+
+    this->device = device;
+
+    if (this->device != NULL)
+        QObject::connect(this->device, SIGNAL(inputsChanged(AtemDevice&)), this, SLOT(inputsChanged(AtemDevice&)));
+}
+
+void InspectorAtemInputWidget::inputsChanged(AtemDevice& device)
+{
+    Q_UNUSED(device);
+
+    if (this->command == NULL)
+        return;
+
+    // The switcher's input table changed while the item is selected, refill the list and keep the selection.
+    blockAllSignals(true);
+
+    loadAtemSwitcher();
+    loadAtemInput();
+
+    this->comboBoxInput->setCurrentIndex(this->comboBoxInput->findData(this->command->getInput()));
+    this->comboBoxSwitcher->setCurrentIndex(this->comboBoxSwitcher->findData(this->command->getSwitcher()));
+
+    checkEmptyInput();
+    checkEmptySwitcher();
+
+    blockAllSignals(false);
+}
+
 void InspectorAtemInputWidget::loadAtemMixerStep()
 {
     // We do not have a command object, block the signals.
@@ -100,12 +138,17 @@ void InspectorAtemInputWidget::loadAtemInput()
     this->comboBoxInput->blockSignals(true);
 
     this->comboBoxInput->clear();
-    foreach (quint16 key, this->inputs.keys())
+
+    QMap<quint16, QAtem::InputInfo> inputs;
+    if (this->device != NULL)
+        inputs = this->device->inputInfos();
+
+    foreach (quint16 key, inputs.keys())
     {
         if (inputs.value(key).internalType == 129) // Aux.
             continue;
 
-        this->comboBoxInput->addItem(this->inputs.value(key).longText, this->inputs.value(key).index);
+        this->comboBoxInput->addItem(inputs.value(key).longText, inputs.value(key).index);
     }
 
     this->comboBoxInput->blockSignals(false);
@@ -131,10 +174,14 @@ void InspectorAtemInputWidget::loadAtemSwitcher()
     foreach (AtemSwitcherModel model, models)
         this->comboBoxSwitcher->addItem(model.getName(), model.getValue());
 
-    foreach (quint16 key, this->inputs.keys())
+    QMap<quint16, QAtem::InputInfo> inputs;
+    if (this->device != NULL)
+        inputs = this->device->inputInfos();
+
+    foreach (quint16 key, inputs.keys())
     {
         if (inputs.value(key).internalType == 129) // Aux.
-            this->comboBoxSwitcher->addItem(this->inputs.value(key).longText, this->inputs.value(key).index);
+            this->comboBoxSwitcher->addItem(inputs.value(key).longText, inputs.value(key).index);
     }
 
     this->comboBoxSwitcher->blockSignals(false);
@@ -14,6 +14,7 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 
 #include <QtWidgets/QWidget>
 
@@ -29,13 +30,14 @@ class WIDGETS_EXPORT InspectorAtemInputWidget : public QWidget, Ui::InspectorAte
 
         LibraryModel* model;
         AtemInputCommand* command;
-        QMap<quint16, QAtem::InputInfo> inputs;
+        QPointer<AtemDevice> device;
 
         void checkEmptySwitcher();
         void checkEmptyInput();
         void checkEmptyMixerStep();
         void loadAtemSwitcher();
         void blockAllSignals(bool block);
+        void setDevice(AtemDevice* device);
         void loadAtemInput();
         void loadAtemMixerStep();
 
@@ -44,5 +46,6 @@ class WIDGETS_EXPORT InspectorAtemInputWidget : public QWidget, Ui::InspectorAte
         Q_SLOT void triggerOnNextChanged(int);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
         Q_SLOT void atemDeviceChanged(const AtemDeviceChangedEvent&);
+        Q_SLOT void inputsChanged(AtemDevice&);
         Q_SLOT void mixerStepChanged(int);
 };
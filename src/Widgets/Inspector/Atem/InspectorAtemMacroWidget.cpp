@@ -24,6 +24,8 @@ void InspectorAtemMacroWidget::rundownItemSelected(const RundownItemSelectedEven
     this->command = nullptr;
     this->model = event.getLibraryModel();
 
+    setDevice(NULL);
+
     blockAllSignals(true);
 
     if (dynamic_cast<AtemMacroCommand*>(event.getCommand()))
@@ -34,7 +36,7 @@ void InspectorAtemMacroWidget::rundownItemSelected(const RundownItemSelectedEven
         const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model->getDeviceName());
         if (device != NULL)
         {
-            this->macros = device->macroInfos();
+            setDevice(device.data());
 
             loadAtemMacro();
         }
@@ -58,7 +60,7 @@ void InspectorAtemMacroWidget::atemDeviceChanged(const AtemDeviceChangedEvent& e
             const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(event.getDeviceName());
             if (device != NULL)
             {
-                this->macros = device->macroInfos();
+                setDevice(device.data());
 
                 loadAtemMacro();
                 checkEmptyMacro();
@@ -67,6 +69,39 @@ void InspectorAtemMacroWidget::atemDeviceChanged(const AtemDeviceChangedEvent& e
     }
 }
 
+void InspectorAtemMacroWidget::setDevice(AtemDevice* device)
+{
+    if (this->device == device)
+        return;
+
+    if (this->device != NULL)
+        QObject::disconnect(this->device, SIGNAL(macrosChanged(AtemDevice&)), this, SLOT(macrosChanged(AtemDevice&)));
+
+    this->device = device;
+
+    if (this->device != NULL)
+        QObject::connect(this->device, SIGNAL(macrosChanged(AtemDevice&)), this, SLOT(macrosChanged(AtemDevice&)));
+}
+
+void InspectorAtemMacroWidget::macrosChanged(AtemDevice& device)
+{
+    Q_UNUSED(device);
+
+    if (this->command == NULL)
+        return;
+
+    // The switcher's macro table changed while the item is selected, refill the list and keep the selection.
+    blockAllSignals(true);
+
+    loadAtemMacro();
+
+    this->comboBoxMacro->setCurrentIndex(this->comboBoxMacro->findData(this->command->getMacro()));
+
+    checkEmptyMacro();
+
+    blockAllSignals(false);
+}
+
 void InspectorAtemMacroWidget::loadAtemMacro()
 {
     // We do not have a command object, block the signals.
@@ -74,7 +109,11 @@ void InspectorAtemMacroWidget::loadAtemMacro()
     this->comboBoxMacro->blockSignals(true);
 
     this->comboBoxMacro->clear();
-    foreach (QAtem::MacroInfo macroInfo, this->macros)
+    QVector<QAtem::MacroInfo> macros;
+    if (this->device != NULL)
+        macros = this->device->macroInfos();
+
+    foreach (const QAtem::MacroInfo& macroInfo, macros)
     {
         if (!macroInfo.used)
             continue;
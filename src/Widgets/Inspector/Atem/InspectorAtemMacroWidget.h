@@ -14,6 +14,7 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 
 #include <QtWidgets/QWidget>
 
@@ -27,14 +28,16 @@ class WIDGETS_EXPORT InspectorAtemMacroWidget : public QWidget, Ui::InspectorAte
     private:
         LibraryModel* model;
         AtemMacroCommand* command;
-        QVector<QAtem::MacroInfo> macros;
+        QPointer<AtemDevice> device;
 
         void checkEmptyMacro();
         void loadAtemMacro();
         void blockAllSignals(bool block);
+        void setDevice(AtemDevice* device);
 
         Q_SLOT void macroChanged(int);
         Q_SLOT void triggerOnNextChanged(int);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
         Q_SLOT void atemDeviceChanged(const AtemDeviceChangedEvent&);
+        Q_SLOT void macrosChanged(AtemDevice&);
 };
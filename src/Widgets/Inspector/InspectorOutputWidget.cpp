@@ -2,6 +2,7 @@
 
 #include "Global.h"
 
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
@@ -71,7 +72,7 @@
 
 InspectorOutputWidget::InspectorOutputWidget(QWidget* parent)
     : QWidget(parent),
-      command(NULL), model(NULL), delayType(""), libraryFilter("")
+      command(NULL), model(NULL), delayType(""), libraryFilter(""), targetRequest(0)
 {
     setupUi(this);
 
@@ -554,6 +555,9 @@ void InspectorOutputWidget::blockAllSignals(bool block)
 
 void InspectorOutputWidget::fillTargetCombo(const QString& type, QString deviceName)
 {
+    // Library results of earlier requests that are still in flight are ignored.
+    int request = ++this->targetRequest;
+
     this->comboBoxTarget->clear();
 
     if (this->model == NULL)
@@ -573,15 +577,44 @@ void InspectorOutputWidget::fillTargetCombo(const QString& type, QString deviceN
     if (deviceModel == NULL)
         return;
 
-    QList<LibraryModel> models;
-    if (this->libraryFilter.isEmpty())
-        models = DatabaseManager::getInstance().getLibraryByDeviceId(deviceModel->getId());
-    else
-        models = DatabaseManager::getInstance().getLibraryByDeviceIdAndFilter(deviceModel->getId(), this->libraryFilter);
+    // Show the current target until the library arrives, callers may still clear the selection.
+    fillTargetCombo(type, QList<LibraryModel>());
+
+    int deviceId = deviceModel->getId();
+    QString filter = this->libraryFilter;
+
+    AsyncDatabaseManager::getInstance().read<QList<LibraryModel>>([deviceId, filter]()
+    {
+        if (filter.isEmpty())
+            return DatabaseManager::getInstance().getLibraryByDeviceId(deviceId);
+        else
+            return DatabaseManager::getInstance().getLibraryByDeviceIdAndFilter(deviceId, filter);
+    }, this, [this, request, type](const QList<LibraryModel>& models)
+    {
+        if (request != this->targetRequest || this->model == NULL)
+            return;
+
+        bool cleared = this->comboBoxTarget->count() > 0 && this->comboBoxTarget->currentIndex() == -1;
 
+        this->comboBoxTarget->blockSignals(true);
+
+        this->comboBoxTarget->clear();
+        fillTargetCombo(type, models);
+
+        if (cleared)
+            this->comboBoxTarget->setCurrentIndex(-1);
+
+        checkEmptyTarget();
+
+        this->comboBoxTarget->blockSignals(false);
+    });
+}
+
+void InspectorOutputWidget::fillTargetCombo(const QString& type, const QList<LibraryModel>& models)
+{
     if (models.count() > 0)
     {
-        foreach (LibraryModel model, models)
+        foreach (const LibraryModel& model, models)
         {
             if (type == Rundown::MOVIE && model.getType() == Rundown::MOVIE)
                 this->comboBoxTarget->addItem(model.getName());
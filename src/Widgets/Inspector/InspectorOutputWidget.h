@@ -35,6 +35,7 @@ class WIDGETS_EXPORT InspectorOutputWidget : public QWidget, Ui::InspectorOutput
         LibraryModel* model;
         QString delayType;
         QString libraryFilter;
+        int targetRequest;
 
         void checkEmptyDevice();
         void checkEmptyAtemDevice();
@@ -43,6 +44,7 @@ class WIDGETS_EXPORT InspectorOutputWidget : public QWidget, Ui::InspectorOutput
         void blockAllSignals(bool block);
 
         void fillTargetCombo(const QString& type, QString deviceName = "");
+        void fillTargetCombo(const QString& type, const QList<LibraryModel>& models);
 
         Q_SLOT void targetChanged(QString);
         Q_SLOT void deviceAdded(CasparDevice&);
@@ -122,6 +122,7 @@ void InspectorTemplateWidget::rundownItemSelected(const RundownItemSelectedEvent
         this->checkBoxUseUppercaseData->setChecked(this->command->getUseUppercaseData());
         this->checkBoxTriggerOnNext->setChecked(this->command->getTriggerOnNext());
         this->checkBoxSendAsJson->setChecked(this->command->getSendAsJson());
+        this->checkBoxUpdateChangedOnly->setChecked(this->command->getUpdateChangedOnly());
 
         for (int i = this->treeWidgetTemplateData->invisibleRootItem()->childCount() - 1; i >= 0; i--)
             delete this->treeWidgetTemplateData->invisibleRootItem()->child(i);
@@ -150,6 +151,7 @@ void InspectorTemplateWidget::blockAllSignals(bool block)
     this->checkBoxUseUppercaseData->blockSignals(block);
     this->checkBoxTriggerOnNext->blockSignals(block);
     this->checkBoxSendAsJson->blockSignals(block);
+    this->checkBoxUpdateChangedOnly->blockSignals(block);
     this->treeWidgetTemplateData->blockSignals(block);
 }
 
@@ -290,6 +292,11 @@ void InspectorTemplateWidget::sendAsJsonChanged(int state)
     this->command->setSendAsJson((state == Qt::Checked) ? true : false);
 }
 
+void InspectorTemplateWidget::updateChangedOnlyChanged(int state)
+{
+    this->command->setUpdateChangedOnly((state == Qt::Checked) ? true : false);
+}
+
 void InspectorTemplateWidget::useUppercaseDataChanged(int state)
 {
     this->command->setUseUppercaseData((state == Qt::Checked) ? true : false);
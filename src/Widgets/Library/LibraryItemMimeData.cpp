@@ -0,0 +1,43 @@
+#include "LibraryItemMimeData.h"
+
+LibraryItemMimeData::LibraryItemMimeData(const QString& source, const QList<LibraryModel>& models)
+    : QMimeData(),
+      source(source), models(models)
+{
+}
+
+const QList<LibraryModel>& LibraryItemMimeData::getModels() const
+{
+    return this->models;
+}
+
+QStringList LibraryItemMimeData::formats() const
+{
+    return QStringList() << "application/library-item";
+}
+
+bool LibraryItemMimeData::hasFormat(const QString& mimeType) const
+{
+    return mimeType == "application/library-item";
+}
+
+QVariant LibraryItemMimeData::retrieveData(const QString& mimeType, QVariant::Type type) const
+{
+    if (!hasFormat(mimeType))
+        return QMimeData::retrieveData(mimeType, type);
+
+    QStringList items;
+    foreach (const LibraryModel& model, this->models)
+    {
+        items.append(QString("<%1>,,%2,,%3,,%4,,%5,,%6,,%7,,%8").arg(this->source)
+                                                                .arg(model.getName())
+                                                                .arg(model.getId())
+                                                                .arg(model.getLabel())
+                                                                .arg(model.getDeviceName())
+                                                                .arg(model.getType())
+                                                                .arg(model.getThumbnailId())
+                                                                .arg(model.getTimecode()));
+    }
+
+    return items.join(";").toUtf8();
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include "Models/LibraryModel.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMimeData>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+// Library items dragged to a rundown. The rundown reads the models as they are, the delimited
+// text format is only put together for a drop target that asks for application/library-item.
+class WIDGETS_EXPORT LibraryItemMimeData : public QMimeData
+{
+    Q_OBJECT
+
+    public:
+        explicit LibraryItemMimeData(const QString& source, const QList<LibraryModel>& models);
+
+        const QList<LibraryModel>& getModels() const;
+
+        QStringList formats() const;
+        bool hasFormat(const QString& mimeType) const;
+
+    protected:
+        QVariant retrieveData(const QString& mimeType, QVariant::Type type) const;
+
+    private:
+        QString source;
+        QList<LibraryModel> models;
+};
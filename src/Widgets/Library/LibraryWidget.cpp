@@ -3,8 +3,10 @@
 #include "Global.h"
 
 #include "DeviceManager.h"
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "EventManager.h"
+#include "PresetManager.h"
 #include "DeviceFilterWidget.h"
 #include "Events/AddPresetItemEvent.h"
 #include "Events/ExportPresetEvent.h"
@@ -677,6 +679,27 @@ void LibraryWidget::mediaChanged(const MediaChangedEvent& event)
 {
     Q_UNUSED(event);
 
+    // Only the most recent request rebuilds the trees.
+    int request = ++this->mediaRequest;
+
+    QString filter = this->lineEditFilter->text();
+    QList<QString> devices = dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter();
+
+    AsyncDatabaseManager::getInstance().read<QList<LibraryModel>>([filter, devices]()
+    {
+        if (filter.isEmpty() && devices.count() == 0)
+            return DatabaseManager::getInstance().getLibraryMedia();
+        else
+            return DatabaseManager::getInstance().getLibraryMediaByFilter(filter, devices);
+    }, this, [this, request](const QList<LibraryModel>& models)
+    {
+        if (request == this->mediaRequest)
+            fillMedia(models);
+    });
+}
+
+void LibraryWidget::fillMedia(const QList<LibraryModel>& models)
+{
     // TODO: Only add / remove necessary items.
     this->treeWidgetAudio->clear();
     this->treeWidgetImage->clear();
@@ -685,15 +708,9 @@ void LibraryWidget::mediaChanged(const MediaChangedEvent& event)
     this->treeWidgetImage->clearSelection();
     this->treeWidgetVideo->clearSelection();
 
-    QList<LibraryModel> models;
-    if (this->lineEditFilter->text().isEmpty() &&  dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter().count() == 0)
-        models = DatabaseManager::getInstance().getLibraryMedia();
-    else
-        models = DatabaseManager::getInstance().getLibraryMediaByFilter(this->lineEditFilter->text(), dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter());
-
     if (models.count() > 0)
     {
-        foreach (LibraryModel model, models)
+        foreach (const LibraryModel& model, models)
         {
             if (model.getType() == "AUDIO")
             {
@@ -828,35 +845,65 @@ void LibraryWidget::dataChanged(const DataChangedEvent& event)
 
 void LibraryWidget::presetChanged(const PresetChangedEvent& event)
 {
-    Q_UNUSED(event);
-
-    // TODO: Only add / remove necessary items.
-    this->treeWidgetPreset->clear();
-    this->treeWidgetPreset->clearSelection();
-
-    EventManager::getInstance().fireExportPresetMenuEvent(ExportPresetMenuEvent(false));
-
-    QList<PresetModel> models;
-    if (this->lineEditFilter->text().isEmpty())
-        models = DatabaseManager::getInstance().getPreset();
+    if (event.getPresetId() > 0)
+    {
+        // A single preset was added or deleted, the rest of the tree stays as it is.
+        removePresetItem(event.getPresetId());
+        if (PresetManager::getInstance().matchesFilter(event.getPresetId(), this->lineEditFilter->text()))
+            insertPresetItem(PresetManager::getInstance().getPreset(event.getPresetId()));
+        else if (this->treeWidgetPreset->selectedItems().isEmpty())
+            EventManager::getInstance().fireExportPresetMenuEvent(ExportPresetMenuEvent(false));
+    }
     else
-        models = DatabaseManager::getInstance().getPresetByFilter(this->lineEditFilter->text());
-
-    if (models.count() > 0)
     {
-        foreach (PresetModel model, models)
+        this->treeWidgetPreset->clear();
+        this->treeWidgetPreset->clearSelection();
+
+        EventManager::getInstance().fireExportPresetMenuEvent(ExportPresetMenuEvent(false));
+
+        foreach (const PresetModel& model, PresetManager::getInstance().getPresets(this->lineEditFilter->text()))
         {
             QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetPreset);
             widget->setIcon(0, QIcon(":/Graphics/Images/PresetSmall.png"));
             widget->setText(0, model.getName());
             widget->setText(1, QString("%1").arg(model.getId()));
-            widget->setText(2, model.getValue());
         }
     }
 
     this->toolBoxLibrary->setItemText(Library::PRESET_PAGE_INDEX, QString("Presets (%1)").arg(this->treeWidgetPreset->topLevelItemCount()));
 }
 
+void LibraryWidget::insertPresetItem(const PresetModel& model)
+{
+    // Same order as the full list, by name and then by id.
+    int index = 0;
+    for (; index < this->treeWidgetPreset->topLevelItemCount(); index++)
+    {
+        QTreeWidgetItem* item = this->treeWidgetPreset->topLevelItem(index);
+        if (item->text(0) > model.getName() || (item->text(0) == model.getName() && item->text(1).toInt() > model.getId()))
+            break;
+    }
+
+    QTreeWidgetItem* widget = new QTreeWidgetItem();
+    widget->setIcon(0, QIcon(":/Graphics/Images/PresetSmall.png"));
+    widget->setText(0, model.getName());
+    widget->setText(1, QString("%1").arg(model.getId()));
+
+    this->treeWidgetPreset->insertTopLevelItem(index, widget);
+}
+
+void LibraryWidget::removePresetItem(int id)
+{
+    for (int i = 0; i < this->treeWidgetPreset->topLevelItemCount(); i++)
+    {
+        if (this->treeWidgetPreset->topLevelItem(i)->text(1).toInt() == id)
+        {
+            delete this->treeWidgetPreset->takeTopLevelItem(i);
+            break;
+        }
+    }
+}
+
 void LibraryWidget::importPreset(const ImportPresetEvent& event)
 {
     Q_UNUSED(event);
@@ -871,9 +918,9 @@ void LibraryWidget::importPreset(const ImportPresetEvent& event)
             if (!data.isEmpty())
             {
                 QFileInfo info(path);
-                DatabaseManager::getInstance().insertPreset(PresetModel(0, info.baseName(), data));
+                int id = PresetManager::getInstance().insertPreset(PresetModel(0, info.baseName(), data));
 
-                EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent());
+                EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent(id));
             }
 
             file.close();
@@ -897,7 +944,7 @@ void LibraryWidget::exportPreset(const ExportPresetEvent& event)
 
         if (file.open(QFile::WriteOnly))
         {
-            const QString& data = this->treeWidgetPreset->currentItem()->text(2);
+            const QString data = PresetManager::getInstance().getPreset(this->treeWidgetPreset->currentItem()->text(1).toInt()).getValue();
             if (!data.isEmpty())
             {
                 QTextStream stream(&file);
@@ -1052,7 +1099,7 @@ void LibraryWidget::contextMenuPresetTriggered(QAction* action)
     if (action->text() == "Add item")
     {
         foreach (QTreeWidgetItem* item, this->treeWidgetPreset->selectedItems())
-            EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(item->text(2)));
+            EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(item->text(1).toInt()));
     }
     else if (action->text() == "Delete")
         this->treeWidgetPreset->removeSelectedPresets();
@@ -1111,7 +1158,7 @@ void LibraryWidget::itemDoubleClicked(QTreeWidgetItem* current, int index)
     else if (this->toolBoxLibrary->currentIndex() == Library::DATA_PAGE_INDEX)
         EventManager::getInstance().fireAddTemplateDataEvent(AddTemplateDataEvent(current->text(0), true));
     else if (this->toolBoxLibrary->currentIndex() == Library::PRESET_PAGE_INDEX)
-        EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(current->text(2)));
+        EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(current->text(1).toInt()));
 }
 
 void LibraryWidget::currentItemChanged(QTreeWidgetItem* current, QTreeWidgetItem* previous)
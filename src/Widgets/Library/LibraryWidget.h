@@ -32,6 +32,7 @@ class WIDGETS_EXPORT LibraryWidget : public QWidget, Ui::LibraryWidget
     private:
         bool lock = false;
         bool useDropFrameNotation = false;
+        int mediaRequest = 0;
 
         QMenu* contextMenu;
         QMenu* contextMenuImage;
@@ -42,6 +43,9 @@ class WIDGETS_EXPORT LibraryWidget : public QWidget, Ui::LibraryWidget
         void setupTools();
         void setupUiMenu();
         void checkEmptyFilter();
+        void fillMedia(const QList<LibraryModel>& models);
+        void insertPresetItem(const PresetModel& model);
+        void removePresetItem(int id);
 
         Q_SLOT void loadLibrary();
         Q_SLOT void toggleExpandItem(QTreeWidgetItem*, int);
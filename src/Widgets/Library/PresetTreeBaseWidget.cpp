@@ -1,7 +1,7 @@
 #include "PresetTreeBaseWidget.h"
 
-#include "DatabaseManager.h"
 #include "EventManager.h"
+#include "PresetManager.h"
 #include "Events/PresetChangedEvent.h"
 
 #include <QtCore/QMimeData>
@@ -43,10 +43,9 @@ void PresetTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
          return;
 
     QMimeData* mimeData = new QMimeData();
-    mimeData->setData("application/library-item", QString("<%1>,,%2,,%3,,%4").arg(this->objectName())
-                                                                             .arg(QTreeWidget::selectedItems().at(0)->text(0))
-                                                                             .arg(QTreeWidget::selectedItems().at(0)->text(1))
-                                                                             .arg(QTreeWidget::selectedItems().at(0)->text(2)).toUtf8());
+    mimeData->setData("application/library-item", QString("<%1>,,%2,,%3").arg(this->objectName())
+                                                                         .arg(QTreeWidget::selectedItems().at(0)->text(0))
+                                                                         .arg(QTreeWidget::selectedItems().at(0)->text(1)).toUtf8());
 
     QDrag* drag = new QDrag(this);
     drag->setMimeData(mimeData);
@@ -57,9 +56,12 @@ void PresetTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
 void PresetTreeBaseWidget::removeSelectedPresets()
 {
     foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
-        DatabaseManager::getInstance().deletePreset(item->text(1).toInt());
+    {
+        int id = item->text(1).toInt();
+        PresetManager::getInstance().deletePreset(id);
 
-    EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent());
+        EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent(id));
+    }
 }
 
 void PresetTreeBaseWidget::keyPressEvent(QKeyEvent* event)
@@ -1,8 +1,7 @@
 #include "ToolTreeBaseWidget.h"
 
 #include "EventManager.h"
-
-#include <QtCore/QMimeData>
+#include "LibraryItemMimeData.h"
 
 #include <QtGui/QDrag>
 
@@ -40,25 +39,12 @@ void ToolTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
     if ((event->pos() - dragStartPosition).manhattanLength() < qApp->startDragDistance())
          return;
 
-    QString data;
+    QList<LibraryModel> models;
     foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
-    {
-        data.append(QString("<%1>,,%2,,%3,,%4,,%5,,%6,,%7,,%8;").arg(this->objectName())
-                                                                .arg(item->text(0))
-                                                                .arg(item->text(1))
-                                                                .arg(item->text(2))
-                                                                .arg(item->text(3))
-                                                                .arg(item->text(4))
-                                                                .arg(item->text(5))
-                                                                .arg(item->text(6)));
-    }
-    data.remove(data.length() - 1, 1); // Remove last index of ;
-
-    QMimeData* mimeData = new QMimeData();
-    mimeData->setData("application/library-item", data.toUtf8());
+        models.append(LibraryModel(item->text(1).toInt(), item->text(2), item->text(0), item->text(3), item->text(4), item->text(5).toInt(), item->text(6)));
 
     QDrag* drag = new QDrag(this);
-    drag->setMimeData(mimeData);
+    drag->setMimeData(new LibraryItemMimeData(this->objectName(), models));
 
     drag->exec(Qt::CopyAction);
 }
@@ -27,7 +27,7 @@ void LiveDialog::visible()
     show();
 }
 
-QWidget* LiveDialog::getRenderTarget()
+QLabel* LiveDialog::getRenderTarget()
 {
     return this->labelLive;
 }
@@ -6,6 +6,7 @@
 #include "Events/ToggleFullscreenEvent.h"
 
 #include <QtWidgets/QDialog>
+#include <QtWidgets/QLabel>
 #include <QtWidgets/QWidget>
 
 class WIDGETS_EXPORT LiveDialog : public QDialog, Ui::LiveDialog
@@ -17,7 +18,7 @@ class WIDGETS_EXPORT LiveDialog : public QDialog, Ui::LiveDialog
 
         void visible();
 
-        QWidget* getRenderTarget();
+        QLabel* getRenderTarget();
 
         Q_SLOT void toggleFullscreen(const ToggleFullscreenEvent&);
 
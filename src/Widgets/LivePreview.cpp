@@ -0,0 +1,351 @@
+#include "LivePreview.h"
+
+#include "DatabaseManager.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include <string.h>
+
+namespace
+{
+    // Every preview shares one libvlc instance, loading the plugins is most of what an instance costs.
+    QMutex instanceMutex;
+    libvlc_instance_t* sharedInstance = nullptr;
+    int instanceReferences = 0;
+
+    libvlc_instance_t* createInstance()
+    {
+        QStringList arguments;
+        arguments.append("--ignore-config");
+        arguments.append("--deinterlace=-1");
+        arguments.append("--deinterlace-mode=yadif");
+        arguments.append("--video-filter=deinterlace");
+        arguments.append("--drop-late-frames");
+        arguments.append("--skip-frames");
+        arguments.append(QString("--verbose=%1").arg(DatabaseManager::getInstance().getConfigurationByName("LogLevel").getValue()));
+
+        qDebug("Using live arguments: %s", qPrintable(arguments.join(" ")));
+
+        QList<QByteArray> values;
+        foreach (const QString& argument, arguments)
+            values.append(argument.toUtf8());
+
+        QVector<const char*> vlcArguments;
+        foreach (const QByteArray& value, values)
+            vlcArguments.append(value.constData());
+
+        sharedInstance = libvlc_new(vlcArguments.count(), vlcArguments.data());
+        return sharedInstance;
+    }
+}
+
+LivePreview::LivePreview(QObject* parent)
+    : QObject(parent),
+      port(0), started(false), vlcInstance(nullptr), vlcMediaPlayer(nullptr), width(0), height(0), pitch(0), ready(-1),
+      counterStart(0), lastCounter(-1), lastFrame(0), averageLatency(-1)
+{
+    for (int i = 0; i < Stream::BUFFER_COUNT; i++)
+        this->buffers[i] = nullptr;
+
+    this->pending.store(0);
+    this->latency.store(-1);
+    this->droppedFrames.store(0);
+    this->displayedFrames.store(0);
+    this->frameDuration.store(0);
+
+    this->clock.start();
+}
+
+LivePreview::~LivePreview()
+{
+    stop();
+
+    if (this->vlcMediaPlayer != nullptr)
+        libvlc_media_player_release(this->vlcMediaPlayer);
+
+    if (this->vlcInstance != nullptr)
+    {
+        QMutexLocker locker(&instanceMutex);
+        if (--instanceReferences == 0)
+        {
+            libvlc_release(sharedInstance);
+            sharedInstance = nullptr;
+        }
+    }
+
+    freeBuffers();
+}
+
+bool LivePreview::createPlayer()
+{
+    if (this->vlcMediaPlayer != nullptr)
+        return true;
+
+    if (this->vlcInstance == nullptr)
+    {
+        QMutexLocker locker(&instanceMutex);
+        if (sharedInstance == nullptr && createInstance() == nullptr)
+            return false;
+
+        instanceReferences++;
+        this->vlcInstance = sharedInstance;
+    }
+
+    this->vlcMediaPlayer = libvlc_media_player_new(this->vlcInstance);
+    if (this->vlcMediaPlayer == nullptr)
+        return false;
+
+    libvlc_video_set_callbacks(this->vlcMediaPlayer, LivePreview::lockPicture, nullptr, LivePreview::displayPicture, this);
+    libvlc_video_set_format_callbacks(this->vlcMediaPlayer, LivePreview::setupFormat, LivePreview::cleanupFormat);
+
+    return true;
+}
+
+bool LivePreview::start(int port)
+{
+    // Already receiving on this port, whatever the server sends there next is picked up as it is.
+    if (this->started && this->port == port)
+        return true;
+
+    stop();
+
+    if (!createPlayer())
+        return false;
+
+    QString networkCache = DatabaseManager::getInstance().getConfigurationByName("NetworkCache").getValue();
+
+    libvlc_media_t* media = libvlc_media_new_location(this->vlcInstance, QString("udp://@0.0.0.0:%1").arg(port).toUtf8().constData());
+    if (media == nullptr)
+        return false;
+
+    // A LAN barely jitters, a small buffer is enough and the clock should not wait for late packets.
+    libvlc_media_add_option(media, QString(":network-caching=%1").arg((networkCache.isEmpty()) ? Stream::DEFAULT_NETWORK_CACHE : networkCache.toInt()).toUtf8().constData());
+    libvlc_media_add_option(media, ":clock-jitter=0");
+    libvlc_media_add_option(media, ":clock-synchro=0");
+
+    if (DatabaseManager::getInstance().getConfigurationByName("DisableAudioInStream").getValue() == "true")
+        libvlc_media_add_option(media, ":no-audio");
+
+    libvlc_media_player_set_media(this->vlcMediaPlayer, media);
+    libvlc_media_release(media);
+
+    if (libvlc_media_player_play(this->vlcMediaPlayer) != 0)
+        return false;
+
+    this->port = port;
+    this->started = true;
+
+    return true;
+}
+
+void LivePreview::stop()
+{
+    if (!this->started)
+        return;
+
+    // Blocks until the video output is gone, the format cleanup runs before this returns.
+    libvlc_media_player_stop(this->vlcMediaPlayer);
+
+    this->started = false;
+    this->latency.store(-1);
+}
+
+bool LivePreview::isStarted() const
+{
+    return this->started;
+}
+
+void LivePreview::resetCounter()
+{
+    QMutexLocker locker(&this->mutex);
+
+    // The server starts counting from zero on every ADD STREAM.
+    this->counterStart = this->clock.elapsed();
+    this->lastCounter = -1;
+    this->lastFrame = 0;
+    this->averageLatency = -1;
+
+    this->latency.store(-1);
+    this->frameDuration.store(0);
+}
+
+QImage LivePreview::getFrame()
+{
+    if (this->frameDuration.load() == 0 && this->vlcMediaPlayer != nullptr)
+    {
+        float fps = libvlc_media_player_get_fps(this->vlcMediaPlayer);
+        if (fps > 0)
+            this->frameDuration.store(qRound(1000000 / fps));
+    }
+
+    QMutexLocker locker(&this->mutex);
+
+    this->pending.store(0);
+    if (this->ready == -1)
+        return QImage();
+
+    return QImage(this->buffers[this->ready], this->width, this->height, this->pitch, QImage::Format_RGB32).copy();
+}
+
+int LivePreview::getLatency() const
+{
+    return this->latency.load();
+}
+
+int LivePreview::getDroppedFrames() const
+{
+    return this->droppedFrames.load();
+}
+
+int LivePreview::getDisplayedFrames() const
+{
+    return this->displayedFrames.load();
+}
+
+int LivePreview::getLostFrames() const
+{
+    if (this->vlcMediaPlayer == nullptr)
+        return 0;
+
+    libvlc_media_t* media = libvlc_media_player_get_media(this->vlcMediaPlayer);
+    if (media == nullptr)
+        return 0;
+
+    // Pictures the decoder or the video output had to throw away, before they ever reached us.
+    libvlc_media_stats_t statistics;
+    int lost = (libvlc_media_get_stats(media, &statistics)) ? statistics.i_lost_pictures : 0;
+
+    libvlc_media_release(media);
+
+    return lost;
+}
+
+libvlc_media_player_t* LivePreview::getMediaPlayer() const
+{
+    return this->vlcMediaPlayer;
+}
+
+void LivePreview::freeBuffers()
+{
+    for (int i = 0; i < Stream::BUFFER_COUNT; i++)
+    {
+        qFreeAligned(this->buffers[i]);
+        this->buffers[i] = nullptr;
+    }
+
+    this->ready = -1;
+}
+
+void LivePreview::readCounter(const uchar* data, qint64 now)
+{
+    if (this->width < Stream::COUNTER_BITS || this->height < Stream::COUNTER_HEIGHT)
+        return;
+
+    // One block per bit along the top edge, sampled in the middle where compression leaves them alone.
+    const uchar* line = data + (Stream::COUNTER_HEIGHT / 2) * this->pitch;
+
+    int counter = 0;
+    for (int i = 0; i < Stream::COUNTER_BITS; i++)
+    {
+        const uchar* pixel = line + ((2 * i + 1) * this->width / (2 * Stream::COUNTER_BITS)) * 4;
+        int luma = (pixel[2] * 77 + pixel[1] * 150 + pixel[0] * 29) >> 8;
+        if (luma > 64 && luma < 192)
+            return; // Not a counter, a stream from an older setup or a different source.
+
+        if (luma >= 128)
+            counter |= (1 << i);
+    }
+
+    if (this->lastCounter == -1)
+        this->lastFrame = counter;
+    else
+        this->lastFrame += (counter - this->lastCounter) & ((1 << Stream::COUNTER_BITS) - 1);
+
+    this->lastCounter = counter;
+
+    int frameDuration = this->frameDuration.load();
+    if (frameDuration == 0)
+        return;
+
+    // Frame N left the server N frame durations after the stream was added.
+    float latency = (now - this->counterStart) - this->lastFrame * frameDuration / 1000.0f;
+    if (latency < 0)
+        return;
+
+    this->averageLatency = (this->averageLatency < 0) ? latency : this->averageLatency * 0.9f + latency * 0.1f;
+    this->latency.store(qRound(this->averageLatency));
+}
+
+unsigned LivePreview::setupFormat(void** opaque, char* chroma, unsigned* width, unsigned* height, unsigned* pitches, unsigned* lines)
+{
+    LivePreview* preview = static_cast<LivePreview*>(*opaque);
+
+    QMutexLocker locker(&preview->mutex);
+
+    preview->freeBuffers();
+
+    // Decoded size as is, the label scales it and the stream is already sized for it.
+    memcpy(chroma, "RV32", 4);
+    preview->width = *width;
+    preview->height = *height;
+    preview->pitch = ((*width * 4) + 31) & ~31;
+
+    pitches[0] = preview->pitch;
+    lines[0] = ((*height) + 31) & ~31;
+
+    for (int i = 0; i < Stream::BUFFER_COUNT; i++)
+        preview->buffers[i] = static_cast<uchar*>(qMallocAligned(pitches[0] * lines[0], 32));
+
+    // A single picture, it is always displayed before the next one is locked.
+    return 1;
+}
+
+void LivePreview::cleanupFormat(void* opaque)
+{
+    LivePreview* preview = static_cast<LivePreview*>(opaque);
+
+    QMutexLocker locker(&preview->mutex);
+
+    preview->freeBuffers();
+}
+
+void* LivePreview::lockPicture(void* opaque, void** planes)
+{
+    LivePreview* preview = static_cast<LivePreview*>(opaque);
+
+    QMutexLocker locker(&preview->mutex);
+
+    // Never the buffer the GUI thread is about to copy.
+    int index = (preview->ready + 1) % Stream::BUFFER_COUNT;
+    planes[0] = preview->buffers[index];
+
+    return reinterpret_cast<void*>(static_cast<quintptr>(index));
+}
+
+void LivePreview::displayPicture(void* opaque, void* picture)
+{
+    LivePreview* preview = static_cast<LivePreview*>(opaque);
+    int index = static_cast<int>(reinterpret_cast<quintptr>(picture));
+
+    {
+        QMutexLocker locker(&preview->mutex);
+
+        if (preview->buffers[index] == nullptr)
+            return;
+
+        preview->readCounter(preview->buffers[index], preview->clock.elapsed());
+
+        // The GUI thread has not picked up the previous frame, it will never be shown.
+        if (preview->pending.load() == 1)
+            preview->droppedFrames.ref();
+
+        preview->ready = index;
+        preview->displayedFrames.ref();
+    }
+
+    if (preview->pending.testAndSetOrdered(0, 1))
+        emit preview->frameReady();
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Global.h"
+
+#include <vlc/vlc.h>
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+
+#include <QtGui/QImage>
+
+// Keeps one media player, on a libvlc instance shared by all previews, for the lifetime of the client. The
+// player listens on the stream port and keeps decoding while the server switches what it sends there, so
+// changing the previewed channel costs an AMCP round trip instead of a decoder restart. Frames are decoded into memory and only
+// the newest one is handed to the GUI thread, anything it could not show in time is dropped.
+class WIDGETS_EXPORT LivePreview : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit LivePreview(QObject* parent = 0);
+        ~LivePreview();
+
+        bool start(int port);
+        void stop();
+        bool isStarted() const;
+
+        void resetCounter();
+
+        QImage getFrame();
+        int getLatency() const;
+        int getDroppedFrames() const;
+        int getDisplayedFrames() const;
+        int getLostFrames() const;
+
+        libvlc_media_player_t* getMediaPlayer() const;
+
+        Q_SIGNAL void frameReady();
+
+    private:
+        int port;
+        bool started;
+
+        libvlc_instance_t* vlcInstance;
+        libvlc_media_player_t* vlcMediaPlayer;
+
+        QElapsedTimer clock;
+        QAtomicInt pending;
+        QAtomicInt latency;
+        QAtomicInt droppedFrames;
+        QAtomicInt displayedFrames;
+        QAtomicInt frameDuration;
+
+        QMutex mutex;
+        unsigned int width;
+        unsigned int height;
+        unsigned int pitch;
+        uchar* buffers[Stream::BUFFER_COUNT];
+        int ready;
+
+        qint64 counterStart;
+        int lastCounter;
+        qint64 lastFrame;
+        float averageLatency;
+
+        bool createPlayer();
+        void freeBuffers();
+        void readCounter(const uchar* data, qint64 now);
+
+        static unsigned setupFormat(void** opaque, char* chroma, unsigned* width, unsigned* height, unsigned* pitches, unsigned* lines);
+        static void cleanupFormat(void* opaque);
+        static void* lockPicture(void* opaque, void** planes);
+        static void displayPicture(void* opaque, void* picture);
+};
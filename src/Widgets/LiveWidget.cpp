@@ -7,11 +7,14 @@
 #include "EventManager.h"
 #include "Models/DeviceModel.h"
 
+#include <QtGui/QPainter>
+#include <QtGui/QPixmap>
+
 #include <QtWidgets/QToolButton>
 
 LiveWidget::LiveWidget(QWidget* parent)
     : QWidget(parent),
-      collapsed(false), windowMode(false), deviceName(""), deviceChannel(""), useKey(false), vlcMedia(NULL), vlcInstance(NULL), vlcMediaPlayer(NULL)
+      collapsed(false), windowMode(false), deviceName(""), deviceChannel(""), useKey(false), showLatency(false)
 {
     setupUi(this);
     setupMenus();
@@ -19,9 +22,17 @@ LiveWidget::LiveWidget(QWidget* parent)
     this->liveDialog = new LiveDialog(this);
     QObject::connect(this->liveDialog, SIGNAL(rejected()), this, SLOT(toggleWindowMode()));
 
+    this->livePreview = new LivePreview(this);
+    QObject::connect(this->livePreview, SIGNAL(frameReady()), this, SLOT(frameReady()));
+
     QString streamPort = DatabaseManager::getInstance().getConfigurationByName("StreamPort").getValue();
     this->streamPort = (streamPort.isEmpty() == true) ? Stream::DEFAULT_PORT : streamPort.toInt();
 
+    // The tiles stream on the ports right after the live preview.
+    this->multiviewDialog = new MultiviewDialog(this);
+    this->multiviewDialog->getMultiview()->setFirstPort(this->streamPort + 1);
+    QObject::connect(this->multiviewDialog, SIGNAL(rejected()), this, SLOT(closeMultiview()));
+
     QObject::connect(&EventManager::getInstance(), SIGNAL(closeApplication(const CloseApplicationEvent&)), this, SLOT(closeApplication(const CloseApplicationEvent&)));
 }
 
@@ -31,17 +42,8 @@ void LiveWidget::closeApplication(const CloseApplicationEvent& event)
 
     stopStream();
 
-    if (this->vlcMediaPlayer != nullptr)
-    {
-        libvlc_media_player_release(this->vlcMediaPlayer);
-        this->vlcMediaPlayer = nullptr;
-    }
-
-    if (this->vlcInstance != nullptr)
-    {
-        libvlc_release(this->vlcInstance);
-        this->vlcInstance = nullptr;
-    }
+    this->livePreview->stop();
+    this->multiviewDialog->getMultiview()->removeTiles();
 }
 
 void LiveWidget::setupMenus()
@@ -62,19 +64,28 @@ void LiveWidget::setupMenus()
     this->streamMenu = new QMenu(this);
     this->streamMenu->setTitle("Connect to");
     this->streamMenuAction = this->contextMenuLiveDropdown->addMenu(this->streamMenu);
+
+    this->multiviewMenu = new QMenu(this);
+    this->multiviewMenu->setTitle("Multiview");
+    this->multiviewMenuAction = this->contextMenuLiveDropdown->addMenu(this->multiviewMenu);
     this->contextMenuLiveDropdown->addSeparator();
     this->contextMenuLiveDropdown->addMenu(this->audioMenu);
     this->contextMenuLiveDropdown->addSeparator();
     this->windowModeAction = this->contextMenuLiveDropdown->addAction(/*QIcon(":/Graphics/Images/WindowMode.png"),*/ "Window Mode", this, SLOT(toggleWindowMode()));
     this->windowModeAction->setCheckable(true);
+    this->latencyAction = this->contextMenuLiveDropdown->addAction(/*QIcon(":/Graphics/Images/Latency.png"),*/ "Show Latency");
+    this->latencyAction->setCheckable(true);
     this->contextMenuLiveDropdown->addSeparator();
     this->expandCollapseAction = this->contextMenuLiveDropdown->addAction(/*QIcon(":/Graphics/Images/Collapse.png"),*/ "Collapse", this, SLOT(toggleExpandCollapse()));
 
     QObject::connect(this->streamMenuAction, SIGNAL(hovered()), this, SLOT(streamMenuHovered()));
     QObject::connect(this->audioTrackMenuAction, SIGNAL(hovered()), this, SLOT(audioTrackMenuHovered()));
     QObject::connect(this->streamMenu, SIGNAL(triggered(QAction*)), this, SLOT(streamMenuActionTriggered(QAction*)));
+    QObject::connect(this->multiviewMenuAction, SIGNAL(hovered()), this, SLOT(multiviewMenuHovered()));
+    QObject::connect(this->multiviewMenu, SIGNAL(triggered(QAction*)), this, SLOT(multiviewMenuActionTriggered(QAction*)));
     QObject::connect(this->audioTrackMenu, SIGNAL(triggered(QAction*)), this, SLOT(audioMenuActionTriggered(QAction*)));
     QObject::connect(this->muteAction, SIGNAL(toggled(bool)), this, SLOT(muteAudio(bool)));
+    QObject::connect(this->latencyAction, SIGNAL(toggled(bool)), this, SLOT(toggleLatency(bool)));
 
     QToolButton* toolButtonLiveDropdown = new QToolButton(this);
     toolButtonLiveDropdown->setObjectName("toolButtonLiveDropdown");
@@ -92,17 +103,18 @@ void LiveWidget::audioTrackMenuHovered()
 
 void LiveWidget::setupAudioTrackMenu()
 {
-    if (!this->vlcMediaPlayer)
+    libvlc_media_player_t* vlcMediaPlayer = this->livePreview->getMediaPlayer();
+    if (!vlcMediaPlayer)
         return;
 
-    if (!libvlc_media_player_is_playing(this->vlcMediaPlayer))
+    if (!libvlc_media_player_is_playing(vlcMediaPlayer))
         return;
 
     foreach (QAction* action, this->audioTrackMenu->actions())
         this->audioTrackMenu->removeAction(action);
 
-    int currentTrack = libvlc_audio_get_track(this->vlcMediaPlayer);
-    libvlc_track_description_t* trackDescription = libvlc_audio_get_track_description(this->vlcMediaPlayer);
+    int currentTrack = libvlc_audio_get_track(vlcMediaPlayer);
+    libvlc_track_description_t* trackDescription = libvlc_audio_get_track_description(vlcMediaPlayer);
     while (trackDescription != NULL)
     {
         this->audioTrackAction = this->audioTrackMenu->addAction(/*QIcon(":/Graphics/Images/RenameRundown.png"),*/ trackDescription->psz_name);
@@ -118,10 +130,10 @@ void LiveWidget::setupAudioTrackMenu()
 
 void LiveWidget::audioMenuActionTriggered(QAction* action)
 {
-    if (!this->vlcMediaPlayer)
+    if (!this->livePreview->getMediaPlayer())
         return;
 
-    libvlc_audio_set_track(this->vlcMediaPlayer, action->data().toInt());
+    libvlc_audio_set_track(this->livePreview->getMediaPlayer(), action->data().toInt());
 }
 
 void LiveWidget::streamMenuHovered()
@@ -162,106 +174,159 @@ void LiveWidget::streamMenuActionTriggered(QAction* action)
     startStream();
 }
 
+void LiveWidget::multiviewMenuHovered()
+{
+    setupMultiviewMenu();
+}
+
+void LiveWidget::setupMultiviewMenu()
+{
+    foreach (QAction* action, this->multiviewMenu->actions())
+        this->multiviewMenu->removeAction(action);
+
+    const MultiviewWidget* multiview = this->multiviewDialog->getMultiview();
+
+    QList<DeviceModel> models = DatabaseManager::getInstance().getDevice();
+    foreach (DeviceModel model, models)
+    {
+        for (int i = 0; i < model.getChannels(); i++)
+        {
+            QAction* fillAction = this->multiviewMenu->addAction(/*QIcon(":/Graphics/Images/RenameRundown.png"),*/ QString("Device: %1, Channel: %2 (Fill)").arg(model.getName()).arg(i + 1));
+            fillAction->setCheckable(true);
+            fillAction->setChecked(multiview->hasTile(model.getName(), i + 1, false));
+
+            QAction* keyAction = this->multiviewMenu->addAction(/*QIcon(":/Graphics/Images/RenameRundown.png"),*/ QString("Device: %1, Channel: %2 (Key)").arg(model.getName()).arg(i + 1));
+            keyAction->setCheckable(true);
+            keyAction->setChecked(multiview->hasTile(model.getName(), i + 1, true));
+        }
+    }
+
+    this->multiviewMenu->addSeparator();
+    this->multiviewMenu->addAction(/*QIcon(":/Graphics/Images/RenameRundown.png"),*/ "Show Multiview", this, SLOT(showMultiview()));
+}
+
+void LiveWidget::multiviewMenuActionTriggered(QAction* action)
+{
+    if (!action->text().contains(',') && !action->text().contains(':'))
+        return;
+
+    bool key = action->text().contains("(Key)");
+    QString deviceName = action->text().split(',').at(0).split(':').at(1).trimmed();
+    int channel = action->text().split(',').at(1).split(':').at(1).trimmed().split(' ').at(0).trimmed().toInt();
+
+    MultiviewWidget* multiview = this->multiviewDialog->getMultiview();
+    if (action->isChecked())
+    {
+        if (multiview->addTile(deviceName, channel, key))
+            showMultiview();
+    }
+    else
+    {
+        multiview->removeTile(deviceName, channel, key);
+    }
+}
+
+void LiveWidget::showMultiview()
+{
+    this->multiviewDialog->visible();
+}
+
+void LiveWidget::closeMultiview()
+{
+    // Nobody is watching, stop the streams instead of decoding them in the background.
+    this->multiviewDialog->getMultiview()->removeTiles();
+}
+
 void LiveWidget::disconnectStream()
 {
     stopStream();
 
+    this->livePreview->stop();
+    getRenderTarget()->clear();
+
     this->deviceName.clear();
     this->deviceChannel.clear();
 }
 
 void LiveWidget::startStream()
 {
-    if (!this->deviceName.isEmpty() && !this->deviceChannel.isEmpty())
+    if (this->deviceName.isEmpty() || this->deviceChannel.isEmpty())
+        return;
+
+    // The player keeps running between streams, only the server side is swapped.
+    if (!this->livePreview->start(this->streamPort))
     {
-        QStringList arguments;
-        arguments.append("--ignore-config");
-        arguments.append("--deinterlace=-1");
-        arguments.append("--deinterlace-mode=yadif");
-        arguments.append("--video-filter=deinterlace");
-        arguments.append(QString("--verbose=%1").arg(DatabaseManager::getInstance().getConfigurationByName("LogLevel").getValue()));
-        arguments.append(QString("--network-caching=%1").arg(DatabaseManager::getInstance().getConfigurationByName("NetworkCache").getValue()));
-
-        bool disableAudioInStream = (DatabaseManager::getInstance().getConfigurationByName("DisableAudioInStream").getValue() == "true") ? true : false;
-        if (disableAudioInStream)
-            arguments.append("--no-audio");
-
-        QString args;
-        foreach (QString value, arguments)
-            args += value + " ";
-
-        qDebug("Using live arguments: %s", qPrintable(args.trimmed()));
-
-        char* vlcArguments[arguments.count()];
-        for (int i = 0; i < arguments.count(); i++)
-            vlcArguments[i] = (char*)qstrdup(arguments.at(i).toUtf8().data());
-
-        this->vlcInstance = libvlc_new(sizeof(vlcArguments) / sizeof(vlcArguments[0]), vlcArguments);
-        if (this->vlcInstance)
-        {
-            this->vlcMediaPlayer = libvlc_media_player_new(this->vlcInstance);
-            if (this->vlcMediaPlayer)
-            {
-                this->vlcMedia = libvlc_media_new_location(this->vlcInstance, QString("udp://@0.0.0.0:%1").arg(this->streamPort).toStdString().c_str());
-                if (this->vlcMedia)
-                {
-                    libvlc_media_player_set_media(this->vlcMediaPlayer, this->vlcMedia);
-
-                    setupRenderTarget(this->windowMode);
-
-                    libvlc_media_player_play(this->vlcMediaPlayer);
-
-                    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->deviceName);
-                    if (device != NULL && device->isConnected())
-                    {
-                        int quality = DatabaseManager::getInstance().getConfigurationByName("StreamQuality").getValue().toInt();
-
-                        if (this->windowMode)
-                            device->startStream(this->deviceChannel.toInt(), this->streamPort, quality, this->useKey);
-                        else
-                            device->startStream(this->deviceChannel.toInt(), this->streamPort, quality, this->useKey, Stream::COMPACT_WIDTH, Stream::COMPACT_HEIGHT);
-                    }
-                }
-            }
-        }
+        qWarning("Unable to start the live preview on port %d", this->streamPort);
+        return;
+    }
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->deviceName);
+    if (device != NULL && device->isConnected())
+    {
+        int quality = DatabaseManager::getInstance().getConfigurationByName("StreamQuality").getValue().toInt();
+
+        this->livePreview->resetCounter();
+
+        // The counter strip is burned into the picture, it is only asked for while the latency is shown.
+        bool counter = this->latencyAction->isChecked();
+        if (this->windowMode)
+            device->startStream(this->deviceChannel.toInt(), this->streamPort, quality, this->useKey, 0, 0, counter);
+        else
+            device->startStream(this->deviceChannel.toInt(), this->streamPort, quality, this->useKey, Stream::COMPACT_WIDTH, Stream::COMPACT_HEIGHT, counter);
     }
 }
 
-void LiveWidget::setupRenderTarget(bool windowMode)
+QLabel* LiveWidget::getRenderTarget() const
 {
-    if (!this->vlcMediaPlayer)
-        return;
-
-#if defined(Q_OS_WIN)
-    libvlc_media_player_set_hwnd(this->vlcMediaPlayer, (windowMode == true) ? (void*)this->liveDialog->getRenderTarget()->winId() : (void*)this->labelLive->winId());
-#elif defined(Q_OS_MAC)
-    libvlc_media_player_set_nsobject(this->vlcMediaPlayer, (windowMode == true) ? (void*)this->liveDialog->getRenderTarget()->winId() : (void*)this->labelLive->winId());
-#elif defined(Q_OS_LINUX)
-    libvlc_media_player_set_xwindow(this->vlcMediaPlayer, (windowMode == true) ? this->liveDialog->getRenderTarget()->winId() : this->labelLive->winId());
-#endif
+    return (this->windowMode == true) ? this->liveDialog->getRenderTarget() : this->labelLive;
 }
 
 void LiveWidget::stopStream()
 {
-    if (!this->vlcMediaPlayer)
-        return;
-
     if (this->deviceName.isEmpty() || this->deviceChannel.isEmpty())
         return;
 
-    libvlc_media_player_stop(this->vlcMediaPlayer);
-
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->deviceName);
     if (device != NULL && device->isConnected())
         device->stopStream(this->deviceChannel.toInt(), this->streamPort);
 }
 
+void LiveWidget::frameReady()
+{
+    QImage frame = this->livePreview->getFrame();
+    if (frame.isNull())
+        return;
+
+    if (this->showLatency)
+    {
+        int latency = this->livePreview->getLatency();
+
+        QPainter painter(&frame);
+        QFont font = painter.font();
+        font.setPixelSize(qMax(10, frame.height() / 16));
+        painter.setFont(font);
+        painter.setPen(Qt::yellow);
+        painter.drawText(frame.rect().adjusted(4, 4, -4, -4), Qt::AlignRight | Qt::AlignBottom,
+                         (latency < 0) ? QString("-- ms") : QString("%1 ms").arg(latency));
+    }
+
+    getRenderTarget()->setPixmap(QPixmap::fromImage(frame));
+}
+
+void LiveWidget::toggleLatency(bool show)
+{
+    this->showLatency = show;
+
+    stopStream();
+    startStream();
+}
+
 void LiveWidget::muteAudio(bool mute)
 {
-    if (!this->vlcMediaPlayer)
+    if (!this->livePreview->getMediaPlayer())
         return;
 
-    libvlc_audio_set_mute(this->vlcMediaPlayer, mute);
+    libvlc_audio_set_mute(this->livePreview->getMediaPlayer(), mute);
 }
 
 void LiveWidget::toggleExpandCollapse()
@@ -276,6 +341,8 @@ void LiveWidget::toggleWindowMode()
 {
     stopStream();
 
+    getRenderTarget()->clear();
+
     if (this->windowMode)
     {
         this->windowModeAction->blockSignals(true);
@@ -290,6 +357,5 @@ void LiveWidget::toggleWindowMode()
     }
 
     this->windowMode = !this->windowMode;
-    setupRenderTarget(this->windowMode);
     startStream();
 }
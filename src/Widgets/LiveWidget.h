@@ -3,12 +3,13 @@
 #include "Shared.h"
 #include "ui_LiveWidget.h"
 #include "LiveDialog.h"
+#include "LivePreview.h"
+#include "MultiviewDialog.h"
 
 #include "Events/CloseApplicationEvent.h"
 
-#include <vlc/vlc.h>
-
 #include <QtWidgets/QAction>
+#include <QtWidgets/QLabel>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QWidget>
 
@@ -26,16 +27,16 @@ class WIDGETS_EXPORT LiveWidget : public QWidget, Ui::LiveWidget
         QString deviceChannel;
         bool useKey;
         int streamPort;
+        bool showLatency;
 
         LiveDialog* liveDialog = nullptr;
-
-        libvlc_media_t* vlcMedia = nullptr;
-        libvlc_instance_t* vlcInstance = nullptr;
-        libvlc_media_player_t* vlcMediaPlayer = nullptr;
+        LivePreview* livePreview = nullptr;
+        MultiviewDialog* multiviewDialog = nullptr;
 
         QMenu* streamMenu;
         QMenu* audioMenu;
         QMenu* audioTrackMenu;
+        QMenu* multiviewMenu;
         QMenu* contextMenuLiveDropdown;
 
         QAction* muteAction;
@@ -43,22 +44,31 @@ class WIDGETS_EXPORT LiveWidget : public QWidget, Ui::LiveWidget
         QAction* streamMenuAction;
         QAction* audioTrackAction;
         QAction* audioTrackMenuAction;
+        QAction* latencyAction;
+        QAction* multiviewMenuAction;
         QAction* expandCollapseAction;
 
         void setupMenus();
         void setupAudioTrackMenu();
         void setupStreamMenu();
-        void setupRenderTarget(bool windowMode);
+        void setupMultiviewMenu();
+        QLabel* getRenderTarget() const;
         void startStream();
         void stopStream();
 
         Q_SLOT void toggleWindowMode();
         Q_SLOT void disconnectStream();
+        Q_SLOT void frameReady();
+        Q_SLOT void toggleLatency(bool);
         Q_SLOT void muteAudio(bool);
         Q_SLOT void toggleExpandCollapse();
         Q_SLOT void audioTrackMenuHovered();
         Q_SLOT void streamMenuHovered();
         Q_SLOT void streamMenuActionTriggered(QAction*);
+        Q_SLOT void multiviewMenuHovered();
+        Q_SLOT void multiviewMenuActionTriggered(QAction*);
+        Q_SLOT void showMultiview();
+        Q_SLOT void closeMultiview();
         Q_SLOT void audioMenuActionTriggered(QAction*);
         Q_SLOT void closeApplication(const CloseApplicationEvent&);
 };
@@ -1,5 +1,6 @@
 #include "MainWindow.h"
 #include "AboutDialog.h"
+#include "GpiDiagnosticsDialog.h"
 #include "HelpDialog.h"
 #include "SettingsDialog.h"
 
@@ -19,6 +20,7 @@
 #include "Events/Rundown/SaveRundownEvent.h"
 #include "Events/Rundown/CopyItemPropertiesEvent.h"
 #include "Events/Rundown/PasteItemPropertiesEvent.h"
+#include "Events/Rundown/FindInRundownEvent.h"
 #include "Events/Library/RefreshLibraryEvent.h"
 #include "Events/Rundown/AllowRemoteTriggeringMenuEvent.h"
 #include "Events/Rundown/CompactViewEvent.h"
@@ -104,6 +106,8 @@ void MainWindow::setupMenu()
     this->viewMenu = new QMenu(this);
     //this->viewMenu->addSeparator();
     this->viewMenu->addAction("Toggle Fullscreen", this, SLOT(toggleFullscreen()), QKeySequence::fromString("Ctrl+F"));
+    this->viewMenu->addSeparator();
+    this->viewMenu->addAction("GPI Diagnostics...", this, SLOT(showGpiDiagnosticsDialog()));
 
     this->libraryMenu = new QMenu(this);
     this->libraryMenu->addAction("Refresh Library", this, SLOT(refreshLibrary()), QKeySequence::fromString("Ctrl+R"));
@@ -121,6 +125,8 @@ void MainWindow::setupMenu()
     this->rundownMenu->addAction("Copy Item Properties", this, SLOT(copyItemProperties()), QKeySequence::fromString("Shift+C"));
     this->rundownMenu->addAction("Paste Item Properties", this, SLOT(pasteItemProperties()), QKeySequence::fromString("Shift+V"));
     this->rundownMenu->addSeparator();
+    this->rundownMenu->addAction("Find in Rundown...", this, SLOT(findInRundown()), QKeySequence::fromString("Ctrl+Shift+F"));
+    this->rundownMenu->addSeparator();
     this->rundownMenu->addAction("Toggle Compact View", this, SLOT(toggleCompactView()));
     this->allowRemoteTriggeringAction = this->rundownMenu->addAction(/*QIcon(":/Graphics/Images/RenameRundown.png"),*/ "Allow Remote Triggering");
     this->rundownMenu->addSeparator();
@@ -329,6 +335,11 @@ void MainWindow::pasteItemProperties()
     EventManager::getInstance().firePasteItemPropertiesEvent(PasteItemPropertiesEvent());
 }
 
+void MainWindow::findInRundown()
+{
+    EventManager::getInstance().fireFindInRundownEvent(FindInRundownEvent());
+}
+
 void MainWindow::executeStop()
 {
     EventManager::getInstance().fireExecutePlayoutCommandEvent(ExecutePlayoutCommandEvent(QEvent::KeyPress, Qt::Key_F1, Qt::NoModifier));
@@ -446,6 +457,14 @@ void MainWindow::showHelpDialog()
     dialog->exec();
 }
 
+void MainWindow::showGpiDiagnosticsDialog()
+{
+    // Not modal, it is meant to be watched while the rundown is taken by GPI.
+    GpiDiagnosticsDialog* dialog = new GpiDiagnosticsDialog(this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
+}
+
 void MainWindow::showSettingsDialog()
 {
     // Reset inspector panel.
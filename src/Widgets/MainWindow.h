@@ -87,6 +87,7 @@ class WIDGETS_EXPORT MainWindow : public QMainWindow, Ui::MainWindow
         Q_SLOT void executeClearChannel();
         Q_SLOT void showAboutDialog();
         Q_SLOT void showHelpDialog();
+        Q_SLOT void showGpiDiagnosticsDialog();
         Q_SLOT void showSettingsDialog();
         Q_SLOT void toggleFullscreen();
         Q_SLOT void toggleCompactView();
@@ -102,6 +103,7 @@ class WIDGETS_EXPORT MainWindow : public QMainWindow, Ui::MainWindow
         Q_SLOT void markAllItemsAsUnused();
         Q_SLOT void copyItemProperties();
         Q_SLOT void pasteItemProperties();
+        Q_SLOT void findInRundown();
         Q_SLOT void insertRepositoryChanges();
         Q_SLOT void allowRemoteTriggering(bool);
         Q_SLOT void emptyRundown(const EmptyRundownEvent&);
@@ -0,0 +1,33 @@
+#include "MultiviewDialog.h"
+
+#include "EventManager.h"
+
+MultiviewDialog::MultiviewDialog(QWidget* parent)
+    : QDialog(parent, Qt::Window | Qt::WindowCloseButtonHint | Qt::WindowMinimizeButtonHint | Qt::WindowMaximizeButtonHint),
+      applicationFullscreen(false)
+{
+    setupUi(this);
+
+    QObject::connect(&EventManager::getInstance(), SIGNAL(toggleFullscreen(const ToggleFullscreenEvent&)), this, SLOT(toggleFullscreen(const ToggleFullscreenEvent&)));
+}
+
+void MultiviewDialog::toggleFullscreen(const ToggleFullscreenEvent& event)
+{
+    Q_UNUSED(event);
+
+    this->applicationFullscreen = !this->applicationFullscreen;
+
+    (!isHidden() && isFullScreen()) ? setWindowState(Qt::WindowNoState) : setWindowState(Qt::WindowFullScreen);
+}
+
+void MultiviewDialog::visible()
+{
+    (this->applicationFullscreen == true) ? setWindowState(Qt::WindowFullScreen) : setWindowState(Qt::WindowNoState);
+
+    show();
+}
+
+MultiviewWidget* MultiviewDialog::getMultiview()
+{
+    return this->widgetMultiview;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Shared.h"
+#include "ui_MultiviewDialog.h"
+
+#include "Events/ToggleFullscreenEvent.h"
+
+#include <QtWidgets/QDialog>
+#include <QtWidgets/QWidget>
+
+class WIDGETS_EXPORT MultiviewDialog : public QDialog, Ui::MultiviewDialog
+{
+    Q_OBJECT
+
+    public:
+        explicit MultiviewDialog(QWidget* parent = 0);
+
+        void visible();
+
+        MultiviewWidget* getMultiview();
+
+        Q_SLOT void toggleFullscreen(const ToggleFullscreenEvent&);
+
+    private:
+        bool applicationFullscreen;
+};
@@ -0,0 +1,360 @@
+#include "MultiviewWidget.h"
+
+#include "Global.h"
+
+#include "DatabaseManager.h"
+#include "DeviceManager.h"
+
+#include <math.h>
+
+#include <QtCore/QThread>
+
+#include <QtGui/QPainter>
+
+#if defined(Q_OS_WIN)
+    #include <windows.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace
+{
+    // Lower resolution first, it costs the operator less than a stuttering picture.
+    const struct
+    {
+        float scale;
+        int frameRate;
+    } LEVELS[] = { { 1.0f, 0 }, { 0.75f, 0 }, { 0.5f, 0 }, { 0.5f, 25 }, { 0.25f, 25 }, { 0.25f, 12 } };
+
+    const int LEVEL_COUNT = sizeof(LEVELS) / sizeof(LEVELS[0]);
+
+    qint64 getProcessCpuTime()
+    {
+        // User and system time of the whole process in milliseconds, the libvlc decoder threads included.
+#if defined(Q_OS_WIN)
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+            return -1;
+
+        ULARGE_INTEGER kernelTime, userTime;
+        kernelTime.LowPart = kernel.dwLowDateTime;
+        kernelTime.HighPart = kernel.dwHighDateTime;
+        userTime.LowPart = user.dwLowDateTime;
+        userTime.HighPart = user.dwHighDateTime;
+
+        return (kernelTime.QuadPart + userTime.QuadPart) / 10000;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return -1;
+
+        return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000LL + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000;
+#endif
+    }
+}
+
+MultiviewWidget::MultiviewWidget(QWidget* parent)
+    : QWidget(parent),
+      firstPort(Stream::DEFAULT_PORT + 1), level(0), levelsWithinBudget(0), statisticsTimer(this), lastCpuTime(-1), lastClockTime(0)
+{
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    this->clock.start();
+
+    this->statisticsTimer.setInterval(Multiview::STATISTICS_INTERVAL);
+    QObject::connect(&this->statisticsTimer, SIGNAL(timeout()), this, SLOT(updateStatistics()));
+}
+
+MultiviewWidget::~MultiviewWidget()
+{
+    blockSignals(true);
+    removeTiles();
+}
+
+void MultiviewWidget::setFirstPort(int port)
+{
+    this->firstPort = port;
+}
+
+int MultiviewWidget::findTile(const QString& deviceName, int channel, bool key) const
+{
+    for (int i = 0; i < this->tiles.count(); i++)
+    {
+        const Tile& tile = this->tiles.at(i);
+        if (tile.deviceName == deviceName && tile.channel == channel && tile.key == key)
+            return i;
+    }
+
+    return -1;
+}
+
+bool MultiviewWidget::hasTile(const QString& deviceName, int channel, bool key) const
+{
+    return findTile(deviceName, channel, key) != -1;
+}
+
+int MultiviewWidget::findFreePort() const
+{
+    for (int port = this->firstPort; ; port++)
+    {
+        bool used = false;
+        foreach (const Tile& tile, this->tiles)
+            used |= (tile.port == port);
+
+        if (!used)
+            return port;
+    }
+}
+
+bool MultiviewWidget::addTile(const QString& deviceName, int channel, bool key)
+{
+    if (hasTile(deviceName, channel, key))
+        return true;
+
+    if (this->tiles.count() >= Multiview::MAX_TILES)
+    {
+        qWarning("The multiview shows at most %d channels", Multiview::MAX_TILES);
+        return false;
+    }
+
+    Tile tile;
+    tile.deviceName = deviceName;
+    tile.channel = channel;
+    tile.key = key;
+    tile.port = findFreePort();
+    tile.fps = 0;
+    tile.dropped = 0;
+    tile.lastDisplayed = 0;
+    tile.lastDropped = 0;
+
+    tile.preview = new LivePreview(this);
+    QObject::connect(tile.preview, SIGNAL(frameReady()), this, SLOT(frameReady()));
+
+    if (!tile.preview->start(tile.port))
+    {
+        qWarning("Unable to start the multiview preview on port %d", tile.port);
+        delete tile.preview;
+        return false;
+    }
+
+    startTileStream(tile);
+    this->tiles.append(tile);
+
+    if (!this->statisticsTimer.isActive())
+        this->statisticsTimer.start();
+
+    update();
+    emit tilesChanged();
+
+    return true;
+}
+
+void MultiviewWidget::removeTile(const QString& deviceName, int channel, bool key)
+{
+    int index = findTile(deviceName, channel, key);
+    if (index == -1)
+        return;
+
+    Tile tile = this->tiles.takeAt(index);
+    stopTileStream(tile);
+    delete tile.preview;
+
+    if (this->tiles.isEmpty())
+    {
+        this->statisticsTimer.stop();
+        setLevel(0);
+    }
+
+    update();
+    emit tilesChanged();
+}
+
+void MultiviewWidget::removeTiles()
+{
+    while (!this->tiles.isEmpty())
+    {
+        Tile tile = this->tiles.first();
+        removeTile(tile.deviceName, tile.channel, tile.key);
+    }
+}
+
+void MultiviewWidget::startTileStream(Tile& tile)
+{
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(tile.deviceName);
+    if (device == NULL || !device->isConnected())
+        return;
+
+    int quality = DatabaseManager::getInstance().getConfigurationByName("StreamQuality").getValue().toInt();
+    int width = qRound(Multiview::TILE_WIDTH * LEVELS[this->level].scale) & ~1;
+    int height = qRound(Multiview::TILE_HEIGHT * LEVELS[this->level].scale) & ~1;
+
+    device->startStream(tile.channel, tile.port, quality, tile.key, width, height, false, LEVELS[this->level].frameRate);
+}
+
+void MultiviewWidget::stopTileStream(Tile& tile)
+{
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(tile.deviceName);
+    if (device != NULL && device->isConnected())
+        device->stopStream(tile.channel, tile.port);
+}
+
+void MultiviewWidget::setLevel(int level)
+{
+    level = qBound(0, level, LEVEL_COUNT - 1);
+    if (level == this->level)
+        return;
+
+    qDebug("Multiview streams at %d%% resolution%s", qRound(LEVELS[level].scale * 100),
+           (LEVELS[level].frameRate > 0) ? qPrintable(QString(" and %1 fps").arg(LEVELS[level].frameRate)) : "");
+
+    this->level = level;
+    this->levelsWithinBudget = 0;
+
+    // Only the server side is restarted, the players keep running on their ports.
+    for (int i = 0; i < this->tiles.count(); i++)
+    {
+        stopTileStream(this->tiles[i]);
+        startTileStream(this->tiles[i]);
+    }
+}
+
+int MultiviewWidget::getCpuUsage()
+{
+    qint64 cpuTime = getProcessCpuTime();
+    qint64 clockTime = this->clock.elapsed();
+
+    int usage = -1;
+    if (cpuTime != -1 && this->lastCpuTime != -1 && clockTime > this->lastClockTime)
+        usage = (cpuTime - this->lastCpuTime) * 100 / ((clockTime - this->lastClockTime) * qMax(1, QThread::idealThreadCount()));
+
+    this->lastCpuTime = cpuTime;
+    this->lastClockTime = clockTime;
+
+    return usage;
+}
+
+void MultiviewWidget::updateStatistics()
+{
+    int displayed = 0;
+    int dropped = 0;
+    for (int i = 0; i < this->tiles.count(); i++)
+    {
+        Tile& tile = this->tiles[i];
+
+        int tileDisplayed = tile.preview->getDisplayedFrames();
+        int tileDropped = tile.preview->getDroppedFrames() + tile.preview->getLostFrames();
+
+        tile.fps = (tileDisplayed - tile.lastDisplayed) * 1000 / Multiview::STATISTICS_INTERVAL;
+        tile.dropped = tileDropped;
+
+        displayed += tileDisplayed - tile.lastDisplayed;
+        dropped += qMax(0, tileDropped - tile.lastDropped);
+
+        tile.lastDisplayed = tileDisplayed;
+        tile.lastDropped = tileDropped;
+    }
+
+    int cpuUsage = getCpuUsage();
+    bool saturated = (cpuUsage > Multiview::CPU_BUDGET) ||
+                     (displayed + dropped > 0 && dropped * 100 / (displayed + dropped) > Multiview::DROP_BUDGET);
+
+    if (saturated)
+    {
+        setLevel(this->level + 1);
+    }
+    else if (cpuUsage != -1 && cpuUsage < Multiview::CPU_BUDGET / 2 && dropped == 0)
+    {
+        // Step back up only after a while, or the streams would flap between two levels.
+        if (++this->levelsWithinBudget >= Multiview::RECOVER_DELAY)
+            setLevel(this->level - 1);
+    }
+    else
+    {
+        this->levelsWithinBudget = 0;
+    }
+
+    update();
+}
+
+void MultiviewWidget::frameReady()
+{
+    LivePreview* preview = qobject_cast<LivePreview*>(sender());
+    for (int i = 0; i < this->tiles.count(); i++)
+    {
+        if (this->tiles.at(i).preview != preview)
+            continue;
+
+        QImage frame = preview->getFrame();
+        if (!frame.isNull())
+        {
+            this->tiles[i].frame = frame;
+            update(getTileRect(i));
+        }
+
+        break;
+    }
+}
+
+QRect MultiviewWidget::getTileRect(int index) const
+{
+    int columns = qMax(1, static_cast<int>(ceil(sqrt(static_cast<double>(this->tiles.count())))));
+    int rows = qMax(1, (this->tiles.count() + columns - 1) / columns);
+
+    int width = this->width() / columns;
+    int height = this->height() / rows;
+
+    return QRect((index % columns) * width, (index / columns) * height, width, height);
+}
+
+void MultiviewWidget::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(this);
+    painter.fillRect(event->rect(), Qt::black);
+
+    QFont font = painter.font();
+    font.setPixelSize(11);
+    painter.setFont(font);
+
+    if (this->tiles.isEmpty())
+    {
+        painter.setPen(QColor(128, 128, 128));
+        painter.drawText(rect(), Qt::AlignCenter, "Pick the channels to watch from the Multiview menu of the Live panel");
+        return;
+    }
+
+    for (int i = 0; i < this->tiles.count(); i++)
+    {
+        const Tile& tile = this->tiles.at(i);
+
+        QRect rect = getTileRect(i);
+        if (!rect.intersects(event->rect()))
+            continue;
+
+        QRect area = rect.adjusted(1, 1, -1, -1);
+        if (!tile.frame.isNull())
+        {
+            // Keep the aspect of the stream, the tile may be any shape.
+            QSize size = tile.frame.size().scaled(area.size(), Qt::KeepAspectRatio);
+            QRect target(QPoint(0, 0), size);
+            target.moveCenter(area.center());
+
+            painter.drawImage(target, tile.frame);
+        }
+        else
+        {
+            painter.setPen(QColor(128, 128, 128));
+            painter.drawText(area, Qt::AlignCenter, "No signal");
+        }
+
+        painter.setPen(QColor(42, 42, 42));
+        painter.drawRect(rect.adjusted(0, 0, -1, -1));
+
+        QString label = QString("%1, Channel %2%3").arg(tile.deviceName).arg(tile.channel).arg((tile.key) ? " (Key)" : "");
+        QString statistics = QString("%1x%2, %3 fps, %4 dropped").arg(tile.frame.width()).arg(tile.frame.height()).arg(tile.fps).arg(tile.dropped);
+
+        painter.setPen(Qt::white);
+        painter.drawText(area.adjusted(4, 2, -4, -2), Qt::AlignLeft | Qt::AlignTop, label);
+        painter.setPen((tile.dropped > 0) ? QColor(Qt::yellow) : QColor(Qt::white));
+        painter.drawText(area.adjusted(4, 2, -4, -2), Qt::AlignLeft | Qt::AlignBottom, statistics);
+    }
+}
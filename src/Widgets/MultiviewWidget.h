@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Shared.h"
+#include "LivePreview.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include <QtGui/QImage>
+#include <QtGui/QPaintEvent>
+
+#include <QtWidgets/QWidget>
+
+// Several channel streams at once, one tile each in a grid. Every tile has its own LivePreview, so the
+// streams are decoded in parallel on the libvlc threads, and the widget only composites the newest frames.
+// When the client can't keep up the streams are asked for at a lower resolution, then at a lower frame rate.
+class WIDGETS_EXPORT MultiviewWidget : public QWidget
+{
+    Q_OBJECT
+
+    public:
+        explicit MultiviewWidget(QWidget* parent = 0);
+        ~MultiviewWidget();
+
+        void setFirstPort(int port);
+
+        bool addTile(const QString& deviceName, int channel, bool key);
+        void removeTile(const QString& deviceName, int channel, bool key);
+        bool hasTile(const QString& deviceName, int channel, bool key) const;
+        void removeTiles();
+
+        Q_SIGNAL void tilesChanged();
+
+    protected:
+        void paintEvent(QPaintEvent* event);
+
+    private:
+        struct Tile
+        {
+            QString deviceName;
+            int channel;
+            bool key;
+            int port;
+
+            LivePreview* preview;
+            QImage frame;
+
+            int fps;
+            int dropped;
+            int lastDisplayed;
+            int lastDropped;
+        };
+
+        int firstPort;
+        int level;
+        int levelsWithinBudget;
+
+        QList<Tile> tiles;
+
+        QTimer statisticsTimer;
+        QElapsedTimer clock;
+        qint64 lastCpuTime;
+        qint64 lastClockTime;
+
+        int findTile(const QString& deviceName, int channel, bool key) const;
+        int findFreePort() const;
+        QRect getTileRect(int index) const;
+
+        void startTileStream(Tile& tile);
+        void stopTileStream(Tile& tile);
+        void setLevel(int level);
+        int getCpuUsage();
+
+        Q_SLOT void frameReady();
+        Q_SLOT void updateStatistics();
+};
@@ -2,6 +2,7 @@
 
 #include "Global.h"
 
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "EventManager.h"
 #include "Models/LibraryModel.h"
@@ -11,7 +12,7 @@
 
 PreviewWidget::PreviewWidget(QWidget* parent)
     : QWidget(parent),
-      viewAlpha(false), collapsed(false)
+      viewAlpha(false), collapsed(false), thumbnailRequest(0)
 {
     setupUi(this);
     setupMenus();
@@ -63,37 +64,42 @@ void PreviewWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
 
 void PreviewWidget::setThumbnail()
 {
+    // Results of earlier requests that are still in flight are ignored.
+    int request = ++this->thumbnailRequest;
+
     if (this->model->getType() != Rundown::STILL && this->model->getType() != Rundown::MOVIE)
     {
         this->labelPreview->clear();
         return;
     }
 
-    int thumbnailId = this->model->getThumbnailId();
     QString name = this->model->getName();
     QString deviceName = this->model->getDeviceName();
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
+    // Fetch and decode on the database thread, only the pixmap conversion happens here.
+    AsyncDatabaseManager::getInstance().read<QImage>([name, deviceName]()
+    {
+        QImage image;
 
-    /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(thumbnailId).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
-    */
+        QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
+        if (!data.isEmpty())
+            image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
 
-    if (!data.isEmpty())
+        return image;
+    }, this, [this, request](const QImage& image)
     {
-        this->image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
+        if (request != this->thumbnailRequest)
+            return;
 
-        if (this->viewAlpha)
+        this->image = image;
+
+        if (this->image.isNull())
+            this->labelPreview->clear();
+        else if (this->viewAlpha)
             this->labelPreview->setPixmap(QPixmap::fromImage(this->image.alphaChannel()));
         else
             this->labelPreview->setPixmap(QPixmap::fromImage(this->image));
-    }
-    else
-    {
-        this->labelPreview->clear();
-    }
+    });
 }
 
 void PreviewWidget::viewAlphaChanged(bool enabled)
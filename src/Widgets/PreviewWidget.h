@@ -24,6 +24,7 @@ class WIDGETS_EXPORT PreviewWidget : public QWidget, Ui::PreviewWidget
     private:
         bool viewAlpha;
         bool collapsed;
+        int thumbnailRequest;
         QImage image;
         LibraryModel* model;
 
@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownAtemAudioGainWidget::clone()
     RundownAtemAudioGainWidget* widget = new RundownAtemAudioGainWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                           this->inGroup, this->compactView);
 
-    AtemAudioGainCommand* command = dynamic_cast<AtemAudioGainCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setInput(this->command.getInput());
-    command->setGain(this->command.getGain());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
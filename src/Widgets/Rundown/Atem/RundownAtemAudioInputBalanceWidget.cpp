@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownAtemAudioInputBalanceWidget::clone()
     RundownAtemAudioInputBalanceWidget* widget = new RundownAtemAudioInputBalanceWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                           this->inGroup, this->compactView);
 
-    AtemAudioInputBalanceCommand* command = dynamic_cast<AtemAudioInputBalanceCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setInput(this->command.getInput());
-    command->setBalance(this->command.getBalance());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
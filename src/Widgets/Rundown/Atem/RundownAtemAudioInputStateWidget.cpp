@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownAtemAudioInputStateWidget::clone()
     RundownAtemAudioInputStateWidget* widget = new RundownAtemAudioInputStateWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                           this->inGroup, this->compactView);
 
-    AtemAudioInputStateCommand* command = dynamic_cast<AtemAudioInputStateCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setInput(this->command.getInput());
-    command->setState(this->command.getState());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
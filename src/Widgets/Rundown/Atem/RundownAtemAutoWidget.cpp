@@ -118,19 +118,7 @@ AbstractRundownWidget* RundownAtemAutoWidget::clone()
     RundownAtemAutoWidget* widget = new RundownAtemAutoWidget(this->model, this->parentWidget(), this->color, this->active,
                                                               this->inGroup, this->compactView);
 
-    AtemAutoCommand* command = dynamic_cast<AtemAutoCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setStep(this->command.getStep());
-    command->setSpeed(this->command.getSpeed());
-    command->setTransition(this->command.getTransition());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setMixerStep(this->command.getMixerStep());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
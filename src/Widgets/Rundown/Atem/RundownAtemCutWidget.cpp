@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownAtemCutWidget::clone()
     RundownAtemCutWidget* widget = new RundownAtemCutWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->inGroup, this->compactView);
 
-    AtemCutCommand* command = dynamic_cast<AtemCutCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setStep(this->command.getStep());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setMixerStep(this->command.getMixerStep());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
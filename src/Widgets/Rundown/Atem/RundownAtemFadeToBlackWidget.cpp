@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownAtemFadeToBlackWidget::clone()
     RundownAtemFadeToBlackWidget* widget = new RundownAtemFadeToBlackWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                             this->inGroup, this->compactView);
 
-    AtemFadeToBlackCommand* command = dynamic_cast<AtemFadeToBlackCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setMixerStep(this->command.getMixerStep());
-    command->setSpeed(this->command.getSpeed());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
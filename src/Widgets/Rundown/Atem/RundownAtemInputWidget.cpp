@@ -47,6 +47,7 @@ RundownAtemInputWidget::RundownAtemInputWidget(const LibraryModel& model, QWidge
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(inputChanged(const QString&)), this, SLOT(inputChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(preview(const PreviewEvent&)), this, SLOT(preview(const PreviewEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(atemDeviceChanged(const AtemDeviceChangedEvent&)), this, SLOT(atemDeviceChanged(const AtemDeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
@@ -54,13 +55,17 @@ RundownAtemInputWidget::RundownAtemInputWidget(const LibraryModel& model, QWidge
     QObject::connect(&AtemDeviceManager::getInstance(), SIGNAL(deviceAdded(AtemDevice&)), this, SLOT(deviceAdded(AtemDevice&)));
     const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+        QObject::connect(device.data(), SIGNAL(tallyChanged(AtemDevice&)), this, SLOT(deviceTallyChanged(AtemDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
     checkEmptyDevice();
     checkGpiConnection();
     checkDeviceConnection();
+    checkTally();
 }
 
 void RundownAtemInputWidget::preview(const PreviewEvent& event)
@@ -97,7 +102,10 @@ void RundownAtemInputWidget::atemDeviceChanged(const AtemDeviceChangedEvent& eve
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<AtemDevice> oldDevice = AtemDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(tallyChanged(AtemDevice&)), this, SLOT(deviceTallyChanged(AtemDevice&)));
+        }
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -106,11 +114,15 @@ void RundownAtemInputWidget::atemDeviceChanged(const AtemDeviceChangedEvent& eve
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<AtemDevice> newDevice = AtemDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(tallyChanged(AtemDevice&)), this, SLOT(deviceTallyChanged(AtemDevice&)));
+        }
     }
 
     checkEmptyDevice();
     checkDeviceConnection();
+    checkTally();
 }
 
 AbstractRundownWidget* RundownAtemInputWidget::clone()
@@ -118,18 +130,7 @@ AbstractRundownWidget* RundownAtemInputWidget::clone()
     RundownAtemInputWidget* widget = new RundownAtemInputWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                 this->inGroup, this->compactView);
 
-    AtemInputCommand* command = dynamic_cast<AtemInputCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setSwitcher(this->command.getSwitcher());
-    command->setInput(this->command.getInput());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setMixerStep(this->command.getMixerStep());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -317,6 +318,24 @@ void RundownAtemInputWidget::checkDeviceConnection()
         this->labelDisconnected->setVisible(!device->isConnected());
 }
 
+void RundownAtemInputWidget::checkTally()
+{
+    int tally = AtemDevice::TallyNone;
+
+    const QSharedPointer<AtemDevice> device = AtemDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device != NULL && !this->command.getInput().isEmpty())
+        tally = device->getTally(this->command.getInput().toUShort());
+
+    // Program wins when the input is on both.
+    QString color = Color::DEFAULT_ATEM_COLOR;
+    if (tally & AtemDevice::TallyProgram)
+        color = Color::DEFAULT_TALLY_PROGRAM_COLOR;
+    else if (tally & AtemDevice::TallyPreview)
+        color = Color::DEFAULT_TALLY_PREVIEW_COLOR;
+
+    this->labelColor->setStyleSheet(QString("background-color: %1;").arg(color));
+}
+
 void RundownAtemInputWidget::configureOscSubscriptions()
 {
     if (!this->command.getAllowRemoteTriggering())
@@ -388,12 +407,30 @@ void RundownAtemInputWidget::deviceConnectionStateChanged(AtemDevice& device)
     checkDeviceConnection();
 }
 
+void RundownAtemInputWidget::deviceTallyChanged(AtemDevice& device)
+{
+    Q_UNUSED(device);
+
+    checkTally();
+}
+
+void RundownAtemInputWidget::inputChanged(const QString& input)
+{
+    Q_UNUSED(input);
+
+    checkTally();
+}
+
 void RundownAtemInputWidget::deviceAdded(AtemDevice& device)
 {
     if (AtemDeviceManager::getInstance().getDeviceModelByAddress(device.getAddress()).getName() == this->model.getDeviceName())
+    {
         QObject::connect(&device, SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+        QObject::connect(&device, SIGNAL(tallyChanged(AtemDevice&)), this, SLOT(deviceTallyChanged(AtemDevice&)));
+    }
 
     checkDeviceConnection();
+    checkTally();
 }
 
 void RundownAtemInputWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
@@ -77,6 +77,7 @@ class WIDGETS_EXPORT RundownAtemInputWidget : public QWidget, Ui::RundownAtemInp
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
+        void checkTally();
         void configureOscSubscriptions();
 
         Q_SLOT void executePlay();
@@ -86,6 +87,8 @@ class WIDGETS_EXPORT RundownAtemInputWidget : public QWidget, Ui::RundownAtemInp
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(AtemDevice&);
+        Q_SLOT void deviceTallyChanged(AtemDevice&);
+        Q_SLOT void inputChanged(const QString&);
         Q_SLOT void deviceAdded(AtemDevice&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playNowControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -118,18 +118,7 @@ AbstractRundownWidget* RundownAtemKeyerStateWidget::clone()
     RundownAtemKeyerStateWidget* widget = new RundownAtemKeyerStateWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                           this->inGroup, this->compactView);
 
-    AtemKeyerStateCommand* command = dynamic_cast<AtemKeyerStateCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setKeyer(this->command.getKeyer());
-    command->setState(this->command.getState());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setMixerStep(this->command.getMixerStep());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
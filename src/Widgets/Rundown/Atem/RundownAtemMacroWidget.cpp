@@ -119,16 +119,7 @@ AbstractRundownWidget* RundownAtemMacroWidget::clone()
     RundownAtemMacroWidget* widget = new RundownAtemMacroWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                 this->inGroup, this->compactView);
 
-    AtemMacroCommand* command = dynamic_cast<AtemMacroCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setMacro(this->command.getMacro());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
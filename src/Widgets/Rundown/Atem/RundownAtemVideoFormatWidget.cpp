@@ -118,16 +118,7 @@ AbstractRundownWidget* RundownAtemVideoFormatWidget::clone()
     RundownAtemVideoFormatWidget* widget = new RundownAtemVideoFormatWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                             this->inGroup, this->compactView);
 
-    AtemVideoFormatCommand* command = dynamic_cast<AtemVideoFormatCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setFormat(this->command.getFormat());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
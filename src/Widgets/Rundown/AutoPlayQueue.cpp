@@ -0,0 +1,114 @@
+#include "AutoPlayQueue.h"
+#include "RundownMovieWidget.h"
+
+#include "Commands/MovieCommand.h"
+
+AutoPlayQueue::AutoPlayQueue()
+{
+}
+
+void AutoPlayQueue::start(const QList<RundownMovieWidget*>& widgets)
+{
+    if (widgets.isEmpty())
+        return;
+
+    // A new queue on a layer replaces whatever was queued there, the server only keeps one background clip.
+    QString key = getLayerKey(widgets.first());
+    removeLayer(key);
+
+    foreach (RundownMovieWidget* widget, widgets)
+        remove(widget);
+
+    Layer layer;
+    layer.widgets = widgets;
+    layer.queued = NULL;
+
+    this->layers.insert(key, layer);
+    foreach (RundownMovieWidget* widget, widgets)
+        this->index.insert(widget, key);
+}
+
+void AutoPlayQueue::remove(RundownMovieWidget* widget)
+{
+    QHash<RundownMovieWidget*, QString>::iterator position = this->index.find(widget);
+    if (position == this->index.end())
+        return;
+
+    QString key = position.value();
+    this->index.erase(position);
+
+    Layer& layer = this->layers[key];
+    layer.widgets.removeOne(widget);
+    if (layer.queued == widget)
+        layer.queued = NULL;
+
+    if (layer.widgets.isEmpty())
+        this->layers.remove(key);
+}
+
+void AutoPlayQueue::clear()
+{
+    this->layers.clear();
+    this->index.clear();
+}
+
+RundownMovieWidget* AutoPlayQueue::started(RundownMovieWidget* widget)
+{
+    QHash<RundownMovieWidget*, QString>::const_iterator position = this->index.constFind(widget);
+    if (position == this->index.constEnd())
+        return NULL;
+
+    QString key = position.value();
+    Layer& layer = this->layers[key];
+
+    // Everything up to and including the clip on air is done.
+    int count = layer.widgets.indexOf(widget) + 1;
+    for (int i = 0; i < count; i++)
+        this->index.remove(layer.widgets.at(i));
+
+    layer.widgets.erase(layer.widgets.begin(), layer.widgets.begin() + count);
+    if (layer.widgets.isEmpty())
+    {
+        this->layers.remove(key);
+        return NULL;
+    }
+
+    if (layer.queued == layer.widgets.first())
+        return NULL; // Already in the background.
+
+    layer.queued = layer.widgets.first();
+
+    return layer.queued;
+}
+
+RundownMovieWidget* AutoPlayQueue::getQueued(RundownMovieWidget* widget) const
+{
+    QHash<RundownMovieWidget*, QString>::const_iterator position = this->index.constFind(widget);
+    if (position != this->index.constEnd())
+        return this->layers.value(position.value()).widgets.first();
+
+    // The clip on air has already left the queue, look up the layer it plays on.
+    QString key = getLayerKey(widget);
+    if (this->layers.contains(key))
+        return this->layers.value(key).widgets.first();
+
+    return NULL;
+}
+
+void AutoPlayQueue::removeLayer(const QString& key)
+{
+    if (!this->layers.contains(key))
+        return;
+
+    foreach (RundownMovieWidget* widget, this->layers.value(key).widgets)
+        this->index.remove(widget);
+
+    this->layers.remove(key);
+}
+
+QString AutoPlayQueue::getLayerKey(RundownMovieWidget* widget)
+{
+    const MovieCommand* command = dynamic_cast<MovieCommand*>(widget->getCommand());
+
+    return QString("%1/%2/%3").arg(widget->getLibraryModel()->getDeviceName()).arg(command->getChannel()).arg(command->getVideolayer());
+}
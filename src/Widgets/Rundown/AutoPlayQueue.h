@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+class RundownMovieWidget;
+
+// Group AutoPlay queues, one per layer. The clip after the one on air is loaded into the background
+// with LOADBG AUTO, the server then starts it the moment the current clip ends.
+class WIDGETS_EXPORT AutoPlayQueue
+{
+    public:
+        explicit AutoPlayQueue();
+
+        void start(const QList<RundownMovieWidget*>& widgets);
+        void remove(RundownMovieWidget* widget);
+        void clear();
+
+        RundownMovieWidget* started(RundownMovieWidget* widget);
+        RundownMovieWidget* getQueued(RundownMovieWidget* widget) const;
+
+    private:
+        struct Layer
+        {
+            QList<RundownMovieWidget*> widgets;
+            RundownMovieWidget* queued;
+        };
+
+        QHash<QString, Layer> layers;
+        QHash<RundownMovieWidget*, QString> index;
+
+        void removeLayer(const QString& key);
+
+        static QString getLayerKey(RundownMovieWidget* widget);
+};
@@ -69,17 +69,7 @@ AbstractRundownWidget* RundownPanasonicPresetWidget::clone()
     RundownPanasonicPresetWidget* widget = new RundownPanasonicPresetWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                             this->inGroup, this->compactView);
 
-    PanasonicPresetCommand* command = dynamic_cast<PanasonicPresetCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setAddress(this->command.getAddress());
-    command->setPreset(this->command.getPreset());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
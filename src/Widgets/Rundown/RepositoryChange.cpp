@@ -0,0 +1,82 @@
+#include "RepositoryChange.h"
+
+#include <sstream>
+
+#include <boost/foreach.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+RepositoryChange::RepositoryChange(const RepositoryChangeModel& model)
+    : type(model.getType()), storyId(model.getStoryId())
+{
+    if (model.getData().isEmpty())
+        return;
+
+    std::wstringstream wstringstream;
+    wstringstream << model.getData().toStdWString();
+
+    boost::property_tree::wptree pt;
+    try
+    {
+        boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+
+        this->items = pt.get_child(L"items");
+    }
+    catch (const boost::property_tree::ptree_error& error)
+    {
+        qWarning("Failed to parse repository change for story %s: %s", qPrintable(this->storyId), error.what());
+
+        return;
+    }
+
+    BOOST_FOREACH(boost::property_tree::wptree::value_type& value, this->items)
+    {
+        if (value.second.count(L"storyid") > 0)
+            this->storyIds.insert(QString::fromStdWString(value.second.get(L"storyid", L"")));
+    }
+}
+
+bool RepositoryChange::isEmpty() const
+{
+    if (this->type == "REMOVE")
+        return false;
+
+    return this->items.count(L"item") == 0;
+}
+
+bool RepositoryChange::containsStoryId(const QString& storyId) const
+{
+    return this->storyIds.contains(storyId);
+}
+
+void RepositoryChange::removeStoryId(const QString& storyId)
+{
+    for (boost::property_tree::wptree::iterator position = this->items.begin(); position != this->items.end(); )
+    {
+        if (QString::fromStdWString(position->second.get(L"storyid", L"")) == storyId)
+            position = this->items.erase(position);
+        else
+            ++position;
+    }
+
+    this->storyIds.remove(storyId);
+}
+
+const QString& RepositoryChange::getType() const
+{
+    return this->type;
+}
+
+const QString& RepositoryChange::getStoryId() const
+{
+    return this->storyId;
+}
+
+const QSet<QString>& RepositoryChange::getStoryIds() const
+{
+    return this->storyIds;
+}
+
+boost::property_tree::wptree& RepositoryChange::getItems()
+{
+    return this->items;
+}
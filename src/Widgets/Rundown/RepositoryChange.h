@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include "Models/RepositoryChangeModel.h"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// A repository change with its XML parsed once, the parsing is done off the GUI thread.
+class WIDGETS_EXPORT RepositoryChange
+{
+    public:
+        explicit RepositoryChange(const RepositoryChangeModel& model);
+
+        bool isEmpty() const;
+        bool containsStoryId(const QString& storyId) const;
+        void removeStoryId(const QString& storyId);
+
+        const QString& getType() const;
+        const QString& getStoryId() const;
+        const QSet<QString>& getStoryIds() const;
+        boost::property_tree::wptree& getItems();
+
+    private:
+        QString type;
+        QString storyId;
+        QSet<QString> storyIds;
+        boost::property_tree::wptree items;
+};
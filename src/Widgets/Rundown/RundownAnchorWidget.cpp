@@ -122,20 +122,7 @@ AbstractRundownWidget* RundownAnchorWidget::clone()
     RundownAnchorWidget* widget = new RundownAnchorWidget(this->model, this->parentWidget(), this->color,
                                                           this->active, this->inGroup, this->compactView);
 
-    AnchorCommand* command = dynamic_cast<AnchorCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setPositionX(this->command.getPositionX());
-    command->setPositionY(this->command.getPositionY());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -129,22 +129,7 @@ AbstractRundownWidget* RundownAudioWidget::clone()
     RundownAudioWidget* widget = new RundownAudioWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->loaded, this->paused, this->playing, this->inGroup, this->compactView);
 
-    AudioCommand* command = dynamic_cast<AudioCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setAudioName(this->command.getAudioName());
-    command->setTransition(this->command.getTransition());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDirection(this->command.getDirection());
-    command->setLoop(this->command.getLoop());
-    command->setUseAuto(this->command.getUseAuto());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
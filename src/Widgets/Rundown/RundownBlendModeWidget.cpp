@@ -122,15 +122,7 @@ AbstractRundownWidget* RundownBlendModeWidget::clone()
     RundownBlendModeWidget* widget = new RundownBlendModeWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                 this->inGroup, this->compactView);
 
-    BlendModeCommand* command = dynamic_cast<BlendModeCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setBlendMode(this->command.getBlendMode());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -122,18 +122,7 @@ AbstractRundownWidget* RundownBrightnessWidget::clone()
     RundownBrightnessWidget* widget = new RundownBrightnessWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                   this->inGroup, this->compactView);
 
-    BrightnessCommand* command = dynamic_cast<BrightnessCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setBrightness(this->command.getBrightness());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -122,18 +122,7 @@ AbstractRundownWidget* RundownChromaWidget::clone()
     RundownChromaWidget* widget = new RundownChromaWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                 this->inGroup, this->compactView);
 
-    ChromaCommand* command = dynamic_cast<ChromaCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setKey(this->command.getKey());
-    command->setThreshold(this->command.getThreshold());
-    command->setSpread(this->command.getSpread());
-    command->setSpill(this->command.getSpill());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
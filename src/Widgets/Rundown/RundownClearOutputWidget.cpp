@@ -107,16 +107,7 @@ AbstractRundownWidget* RundownClearOutputWidget::clone()
     RundownClearOutputWidget* widget = new RundownClearOutputWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                     this->inGroup, this->compactView);
 
-    ClearOutputCommand* command = dynamic_cast<ClearOutputCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setClearChannel(this->command.getClearChannel());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -122,21 +122,7 @@ AbstractRundownWidget* RundownClipWidget::clone()
     RundownClipWidget* widget = new RundownClipWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->inGroup, this->compactView);
 
-    ClipCommand* command = dynamic_cast<ClipCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setLeft(this->command.getLeft());
-    command->setWidth(this->command.getWidth());
-    command->setTop(this->command.getTop());
-    command->setHeight(this->command.getHeight());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
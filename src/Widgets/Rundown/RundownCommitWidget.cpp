@@ -109,14 +109,7 @@ AbstractRundownWidget* RundownCommitWidget::clone()
     RundownCommitWidget* widget = new RundownCommitWidget(this->model, this->parentWidget(), this->color, this->active,
                                                           this->inGroup, this->compactView);
 
-    CommitCommand* command = dynamic_cast<CommitCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
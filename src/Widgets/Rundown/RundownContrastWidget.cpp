@@ -122,18 +122,7 @@ AbstractRundownWidget* RundownContrastWidget::clone()
     RundownContrastWidget* widget = new RundownContrastWidget(this->model, this->parentWidget(), this->color,
                                                               this->active, this->inGroup, this->compactView);
 
-    ContrastCommand* command = dynamic_cast<ContrastCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setContrast(this->command.getContrast());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -122,21 +122,7 @@ AbstractRundownWidget* RundownCropWidget::clone()
     RundownCropWidget* widget = new RundownCropWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->inGroup, this->compactView);
 
-    CropCommand* command = dynamic_cast<CropCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setLeft(this->command.getLeft());
-    command->setTop(this->command.getTop());
-    command->setRight(this->command.getRight());
-    command->setBottom(this->command.getBottom());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
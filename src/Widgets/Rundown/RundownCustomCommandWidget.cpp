@@ -107,26 +107,7 @@ AbstractRundownWidget* RundownCustomCommandWidget::clone()
     RundownCustomCommandWidget* widget = new RundownCustomCommandWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                         this->inGroup, this->compactView);
 
-    CustomCommand* command = dynamic_cast<CustomCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setStopCommand(this->command.getStopCommand());
-    command->setPlayCommand(this->command.getPlayCommand());
-    command->setLoadCommand(this->command.getLoadCommand());
-    command->setPauseCommand(this->command.getPauseCommand());
-    command->setNextCommand(this->command.getNextCommand());
-    command->setUpdateCommand(this->command.getUpdateCommand());
-    command->setInvokeCommand(this->command.getInvokeCommand());
-    command->setPreviewCommand(this->command.getPreviewCommand());
-    command->setClearCommand(this->command.getClearCommand());
-    command->setClearVideolayerCommand(this->command.getClearVideolayerCommand());
-    command->setClearChannelCommand(this->command.getClearChannelCommand());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -112,20 +112,7 @@ AbstractRundownWidget* RundownDeckLinkInputWidget::clone()
                                                                         this->active, this->loaded, this->paused, this->playing,
                                                                         this->inGroup, this->compactView);
 
-    DeckLinkInputCommand* command = dynamic_cast<DeckLinkInputCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setDevice(this->command.getDevice());
-    command->setFormat(this->command.getFormat());
-    command->setTransition(this->command.getTransition());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDirection(this->command.getDirection());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
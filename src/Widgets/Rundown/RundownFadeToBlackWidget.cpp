@@ -113,20 +113,7 @@ AbstractRundownWidget* RundownFadeToBlackWidget::clone()
                                                                     this->loaded, this->paused, this->playing, this->inGroup,
                                                                     this->compactView);
 
-    FadeToBlackCommand* command = dynamic_cast<FadeToBlackCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setTransition(this->command.getTransition());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDirection(this->command.getDirection());
-    command->setUseAuto(this->command.getUseAuto());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
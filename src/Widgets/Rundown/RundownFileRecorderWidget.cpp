@@ -118,19 +118,7 @@ AbstractRundownWidget* RundownFileRecorderWidget::clone()
     RundownFileRecorderWidget* widget = new RundownFileRecorderWidget(this->model, this->parentWidget(), this->color,
                                                                       this->active, this->inGroup, this->compactView);
 
-    FileRecorderCommand* command = dynamic_cast<FileRecorderCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setOutput(this->command.getOutput());
-    command->setCodec(this->command.getCodec());
-    command->setPreset(this->command.getPreset());
-    command->setTune(this->command.getTune());
-    command->setWithAlpha(this->command.getWithAlpha());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
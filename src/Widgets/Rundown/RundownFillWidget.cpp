@@ -122,23 +122,7 @@ AbstractRundownWidget* RundownFillWidget::clone()
     RundownFillWidget* widget = new RundownFillWidget(this->model, this->parentWidget(), this->color,
                                                       this->active, this->inGroup, this->compactView);
 
-    FillCommand* command = dynamic_cast<FillCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setPositionX(this->command.getPositionX());
-    command->setPositionY(this->command.getPositionY());
-    command->setScaleX(this->command.getScaleX());
-    command->setScaleY(this->command.getScaleY());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setDefer(this->command.getDefer());
-    command->setUseMipmap(this->command.getUseMipmap());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
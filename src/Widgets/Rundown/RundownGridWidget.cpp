@@ -124,18 +124,7 @@ AbstractRundownWidget* RundownGridWidget::clone()
     RundownGridWidget* widget = new RundownGridWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->inGroup, this->compactView);
 
-    GridCommand* command = dynamic_cast<GridCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setGrid(this->command.getGrid());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -71,17 +71,7 @@ AbstractRundownWidget* RundownGroupWidget::clone()
     RundownGroupWidget* widget = new RundownGroupWidget(this->model, this->parentWidget(), this->color,
                                                         this->active, this->compactView);
 
-    GroupCommand* command = dynamic_cast<GroupCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setNotes(this->command.getNotes());
-    command->setAutoStep(this->command.getAutoStep());
-    command->setAutoPlay(this->command.getAutoPlay());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
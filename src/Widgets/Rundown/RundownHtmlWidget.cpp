@@ -109,22 +109,7 @@ AbstractRundownWidget* RundownHtmlWidget::clone()
     RundownHtmlWidget* widget = new RundownHtmlWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->loaded, this->paused, this->playing, this->inGroup, this->compactView);
 
-    HtmlCommand* command = dynamic_cast<HtmlCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setTransition(this->command.getTransition());
-    command->setUrl(this->command.getUrl());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDirection(this->command.getDirection());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setFreezeOnLoad(this->command.getFreezeOnLoad());
-    command->setUseAuto(this->command.getUseAuto());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
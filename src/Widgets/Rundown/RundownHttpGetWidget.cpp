@@ -78,17 +78,7 @@ AbstractRundownWidget* RundownHttpGetWidget::clone()
     RundownHttpGetWidget* widget = new RundownHttpGetWidget(this->model, this->parentWidget(), this->color, this->active,
                                                             this->inGroup, this->compactView);
 
-    HttpGetCommand* command = dynamic_cast<HttpGetCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setUrl(this->command.getUrl());
-    command->setHttpDataModels(this->command.getHttpDataModels());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -78,17 +78,7 @@ AbstractRundownWidget* RundownHttpPostWidget::clone()
     RundownHttpPostWidget* widget = new RundownHttpPostWidget(this->model, this->parentWidget(), this->color, this->active,
                                                               this->inGroup, this->compactView);
 
-    HttpPostCommand* command = dynamic_cast<HttpPostCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setUrl(this->command.getUrl());
-    command->setHttpDataModels(this->command.getHttpDataModels());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
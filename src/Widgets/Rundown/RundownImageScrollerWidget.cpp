@@ -129,19 +129,7 @@ AbstractRundownWidget* RundownImageScrollerWidget::clone()
                                                                         this->active, this->loaded, this->paused, this->playing,
                                                                         this->inGroup, this->compactView);
 
-    ImageScrollerCommand* command = dynamic_cast<ImageScrollerCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setImageScrollerName(this->command.getImageScrollerName());
-    command->setBlur(this->command.getBlur());
-    command->setSpeed(this->command.getSpeed());
-    command->setPremultiply(this->command.getPremultiply());
-    command->setProgressive(this->command.getProgressive());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
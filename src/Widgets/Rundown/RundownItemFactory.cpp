@@ -60,8 +60,80 @@
 #include "Sony/RundownSonyPresetWidget.h"
 #include "Spyder/RundownSpyderPresetWidget.h"
 
+namespace
+{
+    template <typename T>
+    AbstractRundownWidget* construct(const LibraryModel& model, QWidget* parent)
+    {
+        return new T(model, parent);
+    }
+}
+
 Q_GLOBAL_STATIC(RundownItemFactory, rundownItemFactory)
 
+RundownItemFactory::RundownItemFactory()
+{
+    // One lookup per item instead of comparing the type against every name in turn.
+    this->constructors.insert(Rundown::BLENDMODE, &construct<RundownBlendModeWidget>);
+    this->constructors.insert(Rundown::BRIGHTNESS, &construct<RundownBrightnessWidget>);
+    this->constructors.insert(Rundown::CONTRAST, &construct<RundownContrastWidget>);
+    this->constructors.insert(Rundown::CLIP, &construct<RundownClipWidget>);
+    this->constructors.insert(Rundown::CHROMAKEY, &construct<RundownChromaWidget>);
+    this->constructors.insert(Rundown::DECKLINKINPUT, &construct<RundownDeckLinkInputWidget>);
+    this->constructors.insert(Rundown::FILERECORDER, &construct<RundownFileRecorderWidget>);
+    this->constructors.insert(Rundown::FILL, &construct<RundownFillWidget>);
+    this->constructors.insert(Rundown::GRID, &construct<RundownGridWidget>);
+    this->constructors.insert(Rundown::GPIOUTPUT, &construct<RundownGpiOutputWidget>);
+    this->constructors.insert(Rundown::KEYER, &construct<RundownKeyerWidget>);
+    this->constructors.insert(Rundown::LEVELS, &construct<RundownLevelsWidget>);
+    this->constructors.insert(Rundown::AUDIO, &construct<RundownAudioWidget>);
+    this->constructors.insert(Rundown::MOVIE, &construct<RundownMovieWidget>);
+    this->constructors.insert(Rundown::STILL, &construct<RundownStillWidget>);
+    this->constructors.insert(Rundown::OPACITY, &construct<RundownOpacityWidget>);
+    this->constructors.insert(Rundown::SATURATION, &construct<RundownSaturationWidget>);
+    this->constructors.insert(Rundown::TEMPLATE, &construct<RundownTemplateWidget>);
+    this->constructors.insert(Rundown::VOLUME, &construct<RundownVolumeWidget>);
+    this->constructors.insert(Rundown::COMMIT, &construct<RundownCommitWidget>);
+    this->constructors.insert(Rundown::IMAGESCROLLER, &construct<RundownImageScrollerWidget>);
+    this->constructors.insert(Rundown::SEPARATOR, &construct<RundownSeparatorWidget>);
+    this->constructors.insert(Rundown::PRINT, &construct<RundownPrintWidget>);
+    this->constructors.insert(Rundown::CLEAROUTPUT, &construct<RundownClearOutputWidget>);
+    this->constructors.insert(Rundown::SOLIDCOLOR, &construct<RundownSolidColorWidget>);
+    this->constructors.insert(Rundown::CUSTOMCOMMAND, &construct<RundownCustomCommandWidget>);
+    this->constructors.insert(Rundown::TRICASTERINPUT, &construct<RundownInputWidget>);
+    this->constructors.insert(Rundown::TRICASTERPRESET, &construct<RundownPresetWidget>);
+    this->constructors.insert(Rundown::TRICASTERTAKE, &construct<RundownTakeWidget>);
+    this->constructors.insert(Rundown::TRICASTERAUTO, &construct<RundownAutoWidget>);
+    this->constructors.insert(Rundown::TRICASTERNETSOURCE, &construct<RundownNetworkSourceWidget>);
+    this->constructors.insert(Rundown::TRICASTERMACRO, &construct<RundownMacroWidget>);
+    this->constructors.insert(Rundown::OSCOUTPUT, &construct<RundownOscOutputWidget>);
+    this->constructors.insert(Rundown::ATEMINPUT, &construct<RundownAtemInputWidget>);
+    this->constructors.insert(Rundown::ATEMFADETOBLACK, &construct<RundownAtemFadeToBlackWidget>);
+    this->constructors.insert(Rundown::ATEMAUTO, &construct<RundownAtemAutoWidget>);
+    this->constructors.insert(Rundown::ATEMCUT, &construct<RundownAtemCutWidget>);
+    this->constructors.insert(Rundown::ATEMKEYERSTATE, &construct<RundownAtemKeyerStateWidget>);
+    this->constructors.insert(Rundown::ATEMVIDEOFORMAT, &construct<RundownAtemVideoFormatWidget>);
+    this->constructors.insert(Rundown::ATEMAUDIOINPUTSTATE, &construct<RundownAtemAudioInputStateWidget>);
+    this->constructors.insert(Rundown::ATEMAUDIOGAIN, &construct<RundownAtemAudioGainWidget>);
+    this->constructors.insert(Rundown::ATEMAUDIOINPUTBALANCE, &construct<RundownAtemAudioInputBalanceWidget>);
+    this->constructors.insert(Rundown::ATEMMACRO, &construct<RundownAtemMacroWidget>);
+    this->constructors.insert(Rundown::PLAYOUTCOMMAND, &construct<RundownPlayoutCommandWidget>);
+    this->constructors.insert(Rundown::FADETOBLACK, &construct<RundownFadeToBlackWidget>);
+    this->constructors.insert(Rundown::PANASONICPRESET, &construct<RundownPanasonicPresetWidget>);
+    this->constructors.insert(Rundown::PERSPECTIVE, &construct<RundownPerspectiveWidget>);
+    this->constructors.insert(Rundown::ROTATION, &construct<RundownRotationWidget>);
+    this->constructors.insert(Rundown::ANCHOR, &construct<RundownAnchorWidget>);
+    this->constructors.insert(Rundown::CROP, &construct<RundownCropWidget>);
+    this->constructors.insert(Rundown::HTTPGET, &construct<RundownHttpGetWidget>);
+    this->constructors.insert(Rundown::HTTPPOST, &construct<RundownHttpPostWidget>);
+    this->constructors.insert(Rundown::RESET, &construct<RundownResetWidget>);
+    this->constructors.insert(Rundown::HTML, &construct<RundownHtmlWidget>);
+    this->constructors.insert(Rundown::ROUTECHANNEL, &construct<RundownRouteChannelWidget>);
+    this->constructors.insert(Rundown::ROUTEVIDEOLAYER, &construct<RundownRouteVideolayerWidget>);
+    this->constructors.insert(Rundown::SONYPRESET, &construct<RundownSonyPresetWidget>);
+    this->constructors.insert(Rundown::SPYDERPRESET, &construct<RundownSpyderPresetWidget>);
+}
+
 RundownItemFactory& RundownItemFactory::getInstance()
 {
     return *rundownItemFactory();
@@ -69,64 +141,9 @@ RundownItemFactory& RundownItemFactory::getInstance()
 
 AbstractRundownWidget* RundownItemFactory::createWidget(const LibraryModel& model)
 {
-    if (model.getType() == Rundown::BLENDMODE) return new RundownBlendModeWidget(model, this);
-    else if (model.getType() == Rundown::BRIGHTNESS) return new RundownBrightnessWidget(model, this);
-    else if (model.getType() == Rundown::CONTRAST) return new RundownContrastWidget(model, this);
-    else if (model.getType() == Rundown::CLIP) return new RundownClipWidget(model, this);
-    else if (model.getType() == Rundown::CHROMAKEY) return new RundownChromaWidget(model, this);
-    else if (model.getType() == Rundown::DECKLINKINPUT) return new RundownDeckLinkInputWidget(model, this);
-    else if (model.getType() == Rundown::FILERECORDER) return new RundownFileRecorderWidget(model, this);
-    else if (model.getType() == Rundown::FILL) return new RundownFillWidget(model, this);
-    else if (model.getType() == Rundown::GRID) return new RundownGridWidget(model, this);
-    else if (model.getType() == Rundown::GPIOUTPUT) return new RundownGpiOutputWidget(model, this);
-    else if (model.getType() == Rundown::KEYER) return new RundownKeyerWidget(model, this);
-    else if (model.getType() == Rundown::LEVELS) return new RundownLevelsWidget(model, this);
-    else if (model.getType() == Rundown::AUDIO) return new RundownAudioWidget(model, this);
-    else if (model.getType() == Rundown::MOVIE) return new RundownMovieWidget(model, this);
-    else if (model.getType() == Rundown::STILL) return new RundownStillWidget(model, this);
-    else if (model.getType() == Rundown::OPACITY) return new RundownOpacityWidget(model, this);
-    else if (model.getType() == Rundown::SATURATION) return new RundownSaturationWidget(model, this);
-    else if (model.getType() == Rundown::TEMPLATE) return new RundownTemplateWidget(model, this);
-    else if (model.getType() == Rundown::VOLUME) return new RundownVolumeWidget(model, this);
-    else if (model.getType() == Rundown::COMMIT) return new RundownCommitWidget(model, this);
-    else if (model.getType() == Rundown::IMAGESCROLLER) return new RundownImageScrollerWidget(model, this);
-    else if (model.getType() == Rundown::SEPARATOR) return new RundownSeparatorWidget(model, this);
-    else if (model.getType() == Rundown::PRINT) return new RundownPrintWidget(model, this);
-    else if (model.getType() == Rundown::CLEAROUTPUT) return new RundownClearOutputWidget(model, this);
-    else if (model.getType() == Rundown::SOLIDCOLOR) return new RundownSolidColorWidget(model, this);
-    else if (model.getType() == Rundown::CUSTOMCOMMAND) return new RundownCustomCommandWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERINPUT) return new RundownInputWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERPRESET) return new RundownPresetWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERTAKE) return new RundownTakeWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERAUTO) return new RundownAutoWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERNETSOURCE) return new RundownNetworkSourceWidget(model, this);
-    else if (model.getType() == Rundown::TRICASTERMACRO) return new RundownMacroWidget(model, this);
-    else if (model.getType() == Rundown::OSCOUTPUT) return new RundownOscOutputWidget(model, this);
-    else if (model.getType() == Rundown::ATEMINPUT) return new RundownAtemInputWidget(model, this);
-    else if (model.getType() == Rundown::ATEMFADETOBLACK) return new RundownAtemFadeToBlackWidget(model, this);
-    else if (model.getType() == Rundown::ATEMAUTO) return new RundownAtemAutoWidget(model, this);
-    else if (model.getType() == Rundown::ATEMCUT) return new RundownAtemCutWidget(model, this);
-    else if (model.getType() == Rundown::ATEMKEYERSTATE) return new RundownAtemKeyerStateWidget(model, this);
-    else if (model.getType() == Rundown::ATEMVIDEOFORMAT) return new RundownAtemVideoFormatWidget(model, this);
-    else if (model.getType() == Rundown::ATEMAUDIOINPUTSTATE) return new RundownAtemAudioInputStateWidget(model, this);
-    else if (model.getType() == Rundown::ATEMAUDIOGAIN) return new RundownAtemAudioGainWidget(model, this);
-    else if (model.getType() == Rundown::ATEMAUDIOINPUTBALANCE) return new RundownAtemAudioInputBalanceWidget(model, this);
-    else if (model.getType() == Rundown::ATEMMACRO) return new RundownAtemMacroWidget(model, this);
-    else if (model.getType() == Rundown::PLAYOUTCOMMAND) return new RundownPlayoutCommandWidget(model, this);
-    else if (model.getType() == Rundown::FADETOBLACK) return new RundownFadeToBlackWidget(model, this);
-    else if (model.getType() == Rundown::PANASONICPRESET) return new RundownPanasonicPresetWidget(model, this);
-    else if (model.getType() == Rundown::PERSPECTIVE) return new RundownPerspectiveWidget(model, this);
-    else if (model.getType() == Rundown::ROTATION) return new RundownRotationWidget(model, this);
-    else if (model.getType() == Rundown::ANCHOR) return new RundownAnchorWidget(model, this);
-    else if (model.getType() == Rundown::CROP) return new RundownCropWidget(model, this);
-    else if (model.getType() == Rundown::HTTPGET) return new RundownHttpGetWidget(model, this);
-    else if (model.getType() == Rundown::HTTPPOST) return new RundownHttpPostWidget(model, this);
-    else if (model.getType() == Rundown::RESET) return new RundownResetWidget(model, this);
-    else if (model.getType() == Rundown::HTML) return new RundownHtmlWidget(model, this);
-    else if (model.getType() == Rundown::ROUTECHANNEL) return new RundownRouteChannelWidget(model, this);
-    else if (model.getType() == Rundown::ROUTEVIDEOLAYER) return new RundownRouteVideolayerWidget(model, this);
-    else if (model.getType() == Rundown::SONYPRESET) return new RundownSonyPresetWidget(model, this);
-    else if (model.getType() == Rundown::SPYDERPRESET) return new RundownSpyderPresetWidget(model, this);
+    Constructor constructor = this->constructors.value(model.getType(), NULL);
+    if (constructor == NULL)
+        return NULL;
 
-    return NULL;
+    return constructor(model, this);
 }
@@ -7,6 +7,9 @@
 
 #include "Models/LibraryModel.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
 #include <QtWidgets/QWidget>
 
 class WIDGETS_EXPORT RundownItemFactory : public QWidget
@@ -14,9 +17,14 @@ class WIDGETS_EXPORT RundownItemFactory : public QWidget
     Q_OBJECT
 
     public:
-        explicit RundownItemFactory() {}
+        explicit RundownItemFactory();
 
         static RundownItemFactory& getInstance();
 
         AbstractRundownWidget* createWidget(const LibraryModel& model);
+
+    private:
+        typedef AbstractRundownWidget* (*Constructor)(const LibraryModel&, QWidget*);
+
+        QHash<QString, Constructor> constructors;
 };
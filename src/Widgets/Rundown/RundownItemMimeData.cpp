@@ -0,0 +1,112 @@
+#include "RundownItemMimeData.h"
+
+#include "Global.h"
+
+#include "Commands/AbstractCommand.h"
+
+#include <QtCore/QXmlStreamWriter>
+
+RundownItemMimeData::RundownItemMimeData(const QList<Item>& items, const QObject* source)
+    : QMimeData(),
+      items(items), source(source)
+{
+}
+
+RundownItemMimeData::~RundownItemMimeData()
+{
+    // The commands were copied for us, nothing else has them.
+    foreach (const Item& item, this->items)
+        deleteItem(item);
+}
+
+const QList<RundownItemMimeData::Item>& RundownItemMimeData::getItems() const
+{
+    return this->items;
+}
+
+const QObject* RundownItemMimeData::getSource() const
+{
+    return this->source.data();
+}
+
+QStringList RundownItemMimeData::formats() const
+{
+    QStringList formats;
+    formats.append("application/rundown-item");
+    formats.append("text/plain");
+
+    return formats;
+}
+
+bool RundownItemMimeData::hasFormat(const QString& mimeType) const
+{
+    return formats().contains(mimeType);
+}
+
+QVariant RundownItemMimeData::retrieveData(const QString& mimeType, QVariant::Type type) const
+{
+    if (!hasFormat(mimeType))
+        return QMimeData::retrieveData(mimeType, type);
+
+    // Only another application, a preset or a paste of properties reads the text.
+    if (this->data.isEmpty())
+    {
+        QXmlStreamWriter writer(&this->data);
+
+        writer.writeStartDocument();
+        writer.writeStartElement("items");
+        foreach (const Item& item, this->items)
+            writeItem(item, &writer);
+
+        writer.writeEndElement();
+        writer.writeEndDocument();
+    }
+
+    if (mimeType == "text/plain")
+        return this->data;
+
+    return this->data.toUtf8();
+}
+
+void RundownItemMimeData::writeItem(const Item& item, QXmlStreamWriter* writer)
+{
+    writer->writeStartElement("item");
+    writer->writeTextElement("type", item.model.getType());
+
+    if (item.model.getType() == "GROUP")
+    {
+        writer->writeTextElement("label", item.model.getLabel());
+        writer->writeTextElement("expanded", (item.expanded == true ? "true" : "false"));
+    }
+    else
+    {
+        writer->writeTextElement("devicename", item.model.getDeviceName());
+        writer->writeTextElement("label", item.model.getLabel());
+        writer->writeTextElement("name", item.model.getName());
+    }
+
+    // The same elements the widgets write for themselves.
+    item.command->writeProperties(writer);
+    writer->writeTextElement("color", item.color);
+    if (item.model.getType() == Rundown::MOVIE)
+        writer->writeTextElement("timecode", item.model.getTimecode());
+
+    if (item.model.getType() == "GROUP")
+    {
+        writer->writeStartElement("items");
+        foreach (const Item& child, item.children)
+            writeItem(child, writer);
+
+        writer->writeEndElement();
+    }
+
+    writer->writeEndElement();
+}
+
+void RundownItemMimeData::deleteItem(const Item& item)
+{
+    foreach (const Item& child, item.children)
+        deleteItem(child);
+
+    delete item.command;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include "Models/LibraryModel.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMimeData>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+class AbstractCommand;
+class QXmlStreamWriter;
+
+// Rundown items on the clipboard or in a drag, as copies of their commands and library models. The target builds
+// its own widgets from them, the XML the rundown is saved in is only written when someone asks for it as text.
+class WIDGETS_EXPORT RundownItemMimeData : public QMimeData
+{
+    Q_OBJECT
+
+    public:
+        struct Item
+        {
+            LibraryModel model;
+            QString color;
+            bool expanded;
+            AbstractCommand* command;
+            QList<Item> children;
+        };
+
+        explicit RundownItemMimeData(const QList<Item>& items, const QObject* source = 0);
+        ~RundownItemMimeData();
+
+        const QList<Item>& getItems() const;
+
+        const QObject* getSource() const;
+
+        QStringList formats() const;
+        bool hasFormat(const QString& mimeType) const;
+
+    protected:
+        QVariant retrieveData(const QString& mimeType, QVariant::Type type) const;
+
+    private:
+        QList<Item> items;
+        QPointer<const QObject> source;
+
+        mutable QString data;
+
+        static void writeItem(const Item& item, QXmlStreamWriter* writer);
+        static void deleteItem(const Item& item);
+};
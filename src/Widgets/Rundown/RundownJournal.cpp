@@ -0,0 +1,1004 @@
+#include "RundownJournal.h"
+#include "RundownTreeBaseWidget.h"
+#include "AbstractRundownWidget.h"
+
+#include "Global.h"
+
+#include "EventManager.h"
+
+#include <sstream>
+
+#include <boost/foreach.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+#include <QtCore/QUuid>
+#include <QtCore/QXmlStreamWriter>
+
+namespace
+{
+    typedef QMap<QString, QPair<bool, QString>> PropertyMap;
+
+    boost::property_tree::wptree readXml(const QString& data)
+    {
+        std::wstringstream wstringstream;
+        wstringstream << data.toStdWString();
+
+        boost::property_tree::wptree pt;
+        boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+
+        return pt;
+    }
+
+    QString writeTree(const boost::property_tree::wptree& tree)
+    {
+        boost::property_tree::wptree pt;
+        pt.add_child(L"value", tree);
+
+        std::wstringstream wstringstream;
+        boost::property_tree::xml_parser::write_xml(wstringstream, pt);
+
+        return QString::fromStdWString(wstringstream.str());
+    }
+
+    boost::property_tree::wptree readTree(const QString& data)
+    {
+        return readXml(data).get_child(L"value");
+    }
+
+    // The properties of one item, i.e. every element directly below it. Elements with children of their own are
+    // kept as XML, the children of a group are items in the tree and not properties of the group.
+    PropertyMap readProperties(const QString& xml, int childRow)
+    {
+        PropertyMap properties;
+
+        boost::property_tree::wptree pt = readXml(xml);
+        const boost::property_tree::wptree* element = &pt.get_child(L"item");
+        if (childRow >= 0)
+        {
+            const boost::property_tree::wptree& items = element->get_child(L"items");
+
+            boost::property_tree::wptree::const_iterator iterator = items.begin();
+            for (int i = 0; i < childRow && iterator != items.end(); i++)
+                ++iterator;
+
+            if (iterator == items.end())
+                return properties;
+
+            element = &iterator->second;
+        }
+
+        BOOST_FOREACH(const boost::property_tree::wptree::value_type& value, *element)
+        {
+            QString key = QString::fromStdWString(value.first);
+            if (key == "items" || key == "expanded" || key == "<xmlattr>" || properties.contains(key))
+                continue;
+
+            if (value.second.empty())
+                properties.insert(key, qMakePair(false, QString::fromStdWString(value.second.data())));
+            else
+                properties.insert(key, qMakePair(true, writeTree(value.second)));
+        }
+
+        return properties;
+    }
+}
+
+RundownJournal::RundownJournal(RundownTreeBaseWidget* treeWidget)
+    : QObject(treeWidget),
+      treeWidget(treeWidget), recording(true), generation(0), savedGeneration(0), history(QString("%1/.CasparCG/Client/Journal/XXXXXX.history").arg(QDir::homePath())),
+      cache(Rundown::JOURNAL_CACHE_SIZE), hasPending(false), autosaveName(QString("%1 %2").arg(Rundown::DEFAULT_NAME).arg(QUuid::createUuid().toString())),
+      autosaveEntries(0)
+{
+    // A rundown that was never saved has no path yet, it is autosaved under a name of its own until it gets one.
+
+    // Several rows change in one operation, the tree is compared once it is done.
+    this->synchronizeTimer.setSingleShot(true);
+    this->synchronizeTimer.setInterval(0);
+    QObject::connect(&this->synchronizeTimer, SIGNAL(timeout()), this, SLOT(synchronizeTree()));
+
+    this->currentItemTimer.setSingleShot(true);
+    this->currentItemTimer.setInterval(0);
+    QObject::connect(&this->currentItemTimer, SIGNAL(timeout()), this, SLOT(recordCurrentItem()));
+
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)), this, SLOT(rowsChanged()));
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsRemoved(const QModelIndex&, int, int)), this, SLOT(rowsChanged()));
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsMoved(const QModelIndex&, int, int, const QModelIndex&, int)), this, SLOT(rowsChanged()));
+    QObject::connect(this->treeWidget, SIGNAL(itemExpanded(QTreeWidgetItem*)), this, SLOT(itemExpansionChanged(QTreeWidgetItem*)));
+    QObject::connect(this->treeWidget, SIGNAL(itemCollapsed(QTreeWidgetItem*)), this, SLOT(itemExpansionChanged(QTreeWidgetItem*)));
+
+    // Edits the inspector makes to the widget rather than to the command.
+    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(currentItemEdited()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(currentItemEdited()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(channelChanged(const ChannelChangedEvent&)), this, SLOT(currentItemEdited()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(videolayerChanged(const VideolayerChangedEvent&)), this, SLOT(currentItemEdited()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(currentItemEdited()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(templateChanged(const TemplateChangedEvent&)), this, SLOT(currentItemEdited()));
+}
+
+RundownJournal::~RundownJournal()
+{
+    // Only a client that went down without closing the rundown leaves an autosave behind.
+    removeAutosave();
+}
+
+void RundownJournal::reset()
+{
+    this->undoStack.clear();
+    this->redoStack.clear();
+    this->cache.clear();
+    this->hasPending = false;
+
+    if (this->history.isOpen())
+        this->history.resize(0);
+
+    resume();
+
+    this->savedGeneration = this->generation;
+}
+
+void RundownJournal::suspend()
+{
+    if (!this->recording)
+        return;
+
+    if (this->synchronizeTimer.isActive())
+    {
+        this->synchronizeTimer.stop();
+        synchronize(true);
+    }
+
+    closePending();
+
+    this->recording = false;
+    this->currentItemTimer.stop();
+}
+
+void RundownJournal::resume()
+{
+    synchronize(false);
+
+    this->recording = true;
+}
+
+bool RundownJournal::canUndo() const
+{
+    return this->hasPending || !this->undoStack.isEmpty();
+}
+
+bool RundownJournal::canRedo() const
+{
+    return !this->redoStack.isEmpty();
+}
+
+bool RundownJournal::undo()
+{
+    if (!this->recording)
+        return false;
+
+    if (this->synchronizeTimer.isActive())
+    {
+        this->synchronizeTimer.stop();
+        synchronize(true);
+    }
+
+    closePending();
+
+    if (this->undoStack.isEmpty())
+        return false;
+
+    qint64 offset = this->undoStack.last();
+
+    Entry entry;
+    if (!readHistory(offset, entry) || !apply(entry, false))
+    {
+        qWarning("Unable to undo, the rundown no longer matches its history");
+
+        this->undoStack.clear();
+        this->redoStack.clear();
+
+        return false;
+    }
+
+    this->undoStack.removeLast();
+    this->redoStack.append(offset);
+
+    return true;
+}
+
+bool RundownJournal::redo()
+{
+    if (!this->recording)
+        return false;
+
+    // An edit the journal has not seen yet ends what can be redone.
+    if (this->synchronizeTimer.isActive())
+    {
+        this->synchronizeTimer.stop();
+        synchronize(true);
+    }
+
+    if (this->redoStack.isEmpty())
+        return false;
+
+    qint64 offset = this->redoStack.last();
+
+    Entry entry;
+    if (!readHistory(offset, entry) || !apply(entry, true))
+    {
+        qWarning("Unable to redo, the rundown no longer matches its history");
+
+        this->redoStack.clear();
+
+        return false;
+    }
+
+    this->redoStack.removeLast();
+    this->undoStack.append(offset);
+
+    return true;
+}
+
+void RundownJournal::itemChanged(QTreeWidgetItem* item)
+{
+    if (item != NULL)
+        recordItem(this->treeWidget->itemWidget(item, 0));
+}
+
+void RundownJournal::touch()
+{
+    this->generation++;
+}
+
+quint64 RundownJournal::getGeneration() const
+{
+    return this->generation;
+}
+
+bool RundownJournal::isModified() const
+{
+    // An edit waiting to be compared counts, it will move the generation on.
+    return this->generation != this->savedGeneration || this->synchronizeTimer.isActive() || this->currentItemTimer.isActive();
+}
+
+void RundownJournal::markSaved()
+{
+    this->savedGeneration = this->generation;
+
+    foreach (const Shadow& shadow, this->shadows)
+    {
+        if (!shadow.item.widget.isNull() && shadow.item.command != NULL)
+            shadow.item.command->setDirty(false);
+
+        foreach (const Node& node, shadow.children)
+        {
+            if (!node.widget.isNull() && node.command != NULL)
+                node.command->setDirty(false);
+        }
+    }
+}
+
+QString RundownJournal::getItemXml(int row) const
+{
+    QTreeWidgetItem* item = this->treeWidget->topLevelItem(row);
+
+    // What we keep is only trusted while the journal follows the tree, and for commands untouched since the last save.
+    if (!this->recording || this->synchronizeTimer.isActive() || this->currentItemTimer.isActive() ||
+        row >= this->shadows.count() || !matches(this->shadows.at(row), item) || isDirty(this->shadows.at(row)))
+        return writeItem(item);
+
+    return this->shadows.at(row).xml;
+}
+
+bool RundownJournal::matches(const Shadow& shadow, QTreeWidgetItem* item) const
+{
+    if (shadow.item.widget.isNull() || shadow.item.widget != this->treeWidget->itemWidget(item, 0))
+        return false;
+
+    if (shadow.children.count() != item->childCount())
+        return false;
+
+    for (int i = 0; i < item->childCount(); i++)
+    {
+        if (shadow.children.at(i).widget.isNull() || shadow.children.at(i).widget != this->treeWidget->itemWidget(item->child(i), 0))
+            return false;
+    }
+
+    return true;
+}
+
+bool RundownJournal::isDirty(const Shadow& shadow) const
+{
+    if (shadow.item.command != NULL && shadow.item.command->isDirty())
+        return true;
+
+    foreach (const Node& node, shadow.children)
+    {
+        if (node.command != NULL && node.command->isDirty())
+            return true;
+    }
+
+    return false;
+}
+
+RundownJournal::Node RundownJournal::createNode(QTreeWidgetItem* item)
+{
+    Node node;
+    node.widget = this->treeWidget->itemWidget(item, 0);
+    node.command = NULL;
+
+    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(node.widget.data());
+    if (widget == NULL || widget->getCommand() == NULL)
+        return node;
+
+    AbstractCommand* command = widget->getCommand();
+    command->trackChanges();
+    QObject::connect(command, SIGNAL(changed()), this, SLOT(commandChanged()), Qt::UniqueConnection);
+
+    node.command = command;
+    this->commands.insert(command, node.widget.data());
+
+    return node;
+}
+
+RundownJournal::Shadow RundownJournal::createShadow(QTreeWidgetItem* item)
+{
+    Shadow shadow;
+    shadow.item = createNode(item);
+
+    for (int i = 0; i < item->childCount(); i++)
+        shadow.children.append(createNode(item->child(i)));
+
+    shadow.xml = writeItem(item);
+
+    return shadow;
+}
+
+void RundownJournal::releaseShadow(const Shadow& shadow)
+{
+    QList<Node> nodes = shadow.children;
+    nodes.append(shadow.item);
+
+    foreach (const Node& node, nodes)
+    {
+        if (node.command == NULL)
+            continue;
+
+        // A deleted widget took its command with it, there is nothing left to disconnect.
+        if (!node.widget.isNull())
+            QObject::disconnect(node.command, 0, this, 0);
+
+        this->commands.remove(node.command);
+    }
+}
+
+QString RundownJournal::writeItem(QTreeWidgetItem* item) const
+{
+    QString xml;
+    QXmlStreamWriter writer(&xml);
+    this->treeWidget->writeProperties(item, &writer);
+
+    return xml;
+}
+
+void RundownJournal::synchronize(bool recordChanges)
+{
+    int count = this->treeWidget->topLevelItemCount();
+
+    // Whatever is the same at the top and at the bottom was left alone, the rest is what changed.
+    int first = 0;
+    while (first < count && first < this->shadows.count() && matches(this->shadows.at(first), this->treeWidget->topLevelItem(first)))
+        first++;
+
+    int last = 0;
+    while (last < count - first && last < this->shadows.count() - first &&
+           matches(this->shadows.at(this->shadows.count() - 1 - last), this->treeWidget->topLevelItem(count - 1 - last)))
+        last++;
+
+    if (first + last == count && first + last == this->shadows.count())
+        return;
+
+    Entry entry;
+    entry.type = Structure;
+    entry.row = first;
+    entry.childRow = -1;
+    entry.count = 0;
+
+    // Items moved within the tree keep their widgets, the shadows only have to change places.
+    int rotation = (count == this->shadows.count()) ? findRotation(first, count - last, QList<Shadow>()) : 0;
+    if (rotation > 0)
+    {
+        QList<Shadow> window = this->shadows.mid(first, count - last - first);
+        for (int i = 0; i < window.count(); i++)
+            this->shadows[first + i] = window.at((i + rotation) % window.count());
+    }
+
+    // Moving with the arrows or by dragging clones the widgets, what they write still tells that nothing else changed.
+    QList<Shadow> created;
+    if (rotation == 0)
+    {
+        for (int i = first; i < count - last; i++)
+            created.append(createShadow(this->treeWidget->topLevelItem(i)));
+
+        if (count == this->shadows.count())
+            rotation = findRotation(first, count - last, created);
+
+        for (int i = first; i < this->shadows.count() - last; i++)
+        {
+            if (rotation == 0)
+                entry.before.append(this->shadows.at(i).xml);
+
+            releaseShadow(this->shadows.at(i));
+        }
+
+        if (rotation == 0)
+        {
+            foreach (const Shadow& shadow, created)
+                entry.after.append(shadow.xml);
+        }
+
+        for (int i = this->shadows.count() - last - first; i > 0; i--)
+            this->shadows.removeAt(first);
+
+        for (int i = 0; i < created.count(); i++)
+            this->shadows.insert(first + i, created.at(i));
+    }
+
+    // The smaller of the two blocks is the one that moved.
+    if (rotation > 0)
+    {
+        int size = count - last - first;
+
+        entry.type = Move;
+        if (rotation <= size - rotation)
+        {
+            entry.row = first;
+            entry.childRow = first + size - rotation;
+            entry.count = rotation;
+        }
+        else
+        {
+            entry.row = first + rotation;
+            entry.childRow = first;
+            entry.count = size - rotation;
+        }
+    }
+
+    if (recordChanges)
+        record(entry);
+}
+
+// Finds k such that the rows from first to end are the shadows there rotated by k, i.e. a block moved. The tree is
+// compared by widget, or by the shadows created for it when given. Other orders are recorded as replaced items.
+int RundownJournal::findRotation(int first, int end, const QList<Shadow>& created) const
+{
+    int size = end - first;
+    if (size < 2)
+        return 0;
+
+    for (int rotation = 1; rotation < size; rotation++)
+    {
+        bool rotated = true;
+        for (int i = 0; i < size && rotated; i++)
+        {
+            const Shadow& shadow = this->shadows.at(first + (i + rotation) % size);
+            if (created.isEmpty())
+                rotated = matches(shadow, this->treeWidget->topLevelItem(first + i));
+            else
+                rotated = shadow.xml == created.at(i).xml;
+        }
+
+        if (rotated)
+            return rotation;
+    }
+
+    return 0;
+}
+
+void RundownJournal::recordItem(QWidget* widget)
+{
+    if (!this->recording || widget == NULL)
+        return;
+
+    if (this->synchronizeTimer.isActive())
+    {
+        this->synchronizeTimer.stop();
+        synchronize(true);
+    }
+
+    for (int row = 0; row < this->shadows.count(); row++)
+    {
+        Shadow& shadow = this->shadows[row];
+
+        int childRow = -1;
+        if (shadow.item.widget != widget)
+        {
+            for (int i = 0; i < shadow.children.count() && childRow == -1; i++)
+            {
+                if (shadow.children.at(i).widget == widget)
+                    childRow = i;
+            }
+
+            if (childRow == -1)
+                continue;
+        }
+
+        QString xml = writeItem(this->treeWidget->topLevelItem(row));
+        if (xml == shadow.xml)
+            return;
+
+        PropertyMap before = readProperties(shadow.xml, childRow);
+        PropertyMap after = readProperties(xml, childRow);
+
+        shadow.xml = xml;
+
+        Entry entry;
+        entry.type = Property;
+        entry.row = row;
+        entry.childRow = childRow;
+        entry.count = 0;
+
+        QStringList keys = before.keys() + after.keys();
+        keys.removeDuplicates();
+
+        foreach (const QString& key, keys)
+        {
+            if (before.value(key) == after.value(key))
+                continue;
+
+            Change change;
+            change.key = key;
+            change.tree = before.value(key).first || after.value(key).first;
+            change.before = before.value(key).second;
+            change.after = after.value(key).second;
+
+            entry.changes.append(change);
+        }
+
+        if (!entry.changes.isEmpty())
+            record(entry);
+
+        return;
+    }
+}
+
+void RundownJournal::record(const Entry& entry)
+{
+    this->generation++;
+
+    writeAutosave(entry, true);
+
+    this->redoStack.clear();
+
+    // Typing in a field changes a property once per key, that is one step to undo.
+    if (this->hasPending && this->pending.type == Property && entry.type == Property &&
+        this->pending.row == entry.row && this->pending.childRow == entry.childRow &&
+        this->pendingTime.elapsed() < Rundown::JOURNAL_MERGE_INTERVAL)
+    {
+        foreach (const Change& change, entry.changes)
+        {
+            bool merged = false;
+            for (int i = 0; i < this->pending.changes.count() && !merged; i++)
+            {
+                if (this->pending.changes.at(i).key == change.key)
+                {
+                    this->pending.changes[i].after = change.after;
+                    merged = true;
+                }
+            }
+
+            if (!merged)
+                this->pending.changes.append(change);
+        }
+
+        this->pendingTime.restart();
+
+        return;
+    }
+
+    closePending();
+
+    this->pending = entry;
+    this->hasPending = true;
+    this->pendingTime.restart();
+}
+
+void RundownJournal::closePending()
+{
+    if (!this->hasPending)
+        return;
+
+    this->hasPending = false;
+
+    qint64 offset = writeHistory(this->pending);
+    if (offset == -1)
+        return;
+
+    this->undoStack.append(offset);
+    this->cache.insert(offset, new Entry(this->pending), getCost(this->pending));
+}
+
+bool RundownJournal::apply(const Entry& entry, bool forward)
+{
+    const QStringList& removed = (forward) ? entry.before : entry.after;
+    const QStringList& inserted = (forward) ? entry.after : entry.before;
+
+    int count = this->treeWidget->topLevelItemCount();
+
+    QTreeWidgetItem* currentItem = NULL;
+    if (entry.type == Structure)
+    {
+        if (entry.row + removed.count() > count)
+            return false;
+
+        this->recording = false;
+
+        this->treeWidget->removeItems(entry.row, removed.count());
+        if (!inserted.isEmpty())
+        {
+            boost::property_tree::wptree pt = readXml(QString("<items>%1</items>").arg(inserted.join("")));
+            this->treeWidget->insertItems(pt, entry.row);
+        }
+
+        count = this->treeWidget->topLevelItemCount();
+        if (count > 0)
+            currentItem = this->treeWidget->topLevelItem(qMin(entry.row, count - 1));
+    }
+    else if (entry.type == Move)
+    {
+        int from = (forward) ? entry.row : entry.childRow;
+        int to = (forward) ? entry.childRow : entry.row;
+
+        if (qMax(from, to) + entry.count > count || from + entry.count > this->shadows.count())
+            return false;
+
+        // Only the moved block is written back, from what the journal already has of it.
+        QStringList moved;
+        for (int i = from; i < from + entry.count; i++)
+        {
+            if (!matches(this->shadows.at(i), this->treeWidget->topLevelItem(i)))
+                return false;
+
+            moved.append(this->shadows.at(i).xml);
+        }
+
+        this->recording = false;
+
+        this->treeWidget->removeItems(from, entry.count);
+
+        boost::property_tree::wptree pt = readXml(QString("<items>%1</items>").arg(moved.join("")));
+        this->treeWidget->insertItems(pt, to);
+
+        currentItem = this->treeWidget->topLevelItem(to);
+    }
+    else
+    {
+        QTreeWidgetItem* item = (entry.row < count) ? this->treeWidget->topLevelItem(entry.row) : NULL;
+        if (item != NULL && entry.childRow >= 0)
+            item = (entry.childRow < item->childCount()) ? item->child(entry.childRow) : NULL;
+
+        if (item == NULL)
+            return false;
+
+        boost::property_tree::wptree pt = readXml(writeItem(item));
+        boost::property_tree::wptree& element = pt.get_child(L"item");
+
+        foreach (const Change& change, entry.changes)
+        {
+            const QString& value = (forward) ? change.after : change.before;
+            if (change.tree)
+                element.put_child(change.key.toStdWString(), readTree(value));
+            else
+                element.put(change.key.toStdWString(), value.toStdWString());
+        }
+
+        this->recording = false;
+
+        this->treeWidget->replaceItem(item, element);
+        currentItem = item;
+    }
+
+    synchronize(false);
+
+    this->recording = true;
+    this->generation++;
+
+    writeAutosave(entry, forward);
+
+    if (currentItem != NULL)
+        this->treeWidget->setCurrentItem(currentItem);
+
+    return true;
+}
+
+qint64 RundownJournal::writeHistory(const Entry& entry)
+{
+    if (!this->history.isOpen())
+    {
+        QDir().mkpath(QString("%1/.CasparCG/Client/Journal").arg(QDir::homePath()));
+        if (!this->history.open())
+        {
+            qWarning("Unable to open the rundown history %s", qPrintable(this->history.fileTemplate()));
+            return -1;
+        }
+    }
+
+    qint64 offset = this->history.size();
+    this->history.seek(offset);
+
+    QDataStream stream(&this->history);
+    stream.setVersion(QDataStream::Qt_5_0);
+    writeEntry(stream, entry);
+
+    return offset;
+}
+
+bool RundownJournal::readHistory(qint64 offset, Entry& entry)
+{
+    if (this->cache.contains(offset))
+    {
+        entry = *this->cache.object(offset);
+        return true;
+    }
+
+    if (!this->history.isOpen() || !this->history.seek(offset))
+        return false;
+
+    QDataStream stream(&this->history);
+    stream.setVersion(QDataStream::Qt_5_0);
+    if (!readEntry(stream, entry))
+        return false;
+
+    this->cache.insert(offset, new Entry(entry), getCost(entry));
+
+    return true;
+}
+
+void RundownJournal::setAutosaveName(const QString& name)
+{
+    if (name == this->autosaveName)
+        return;
+
+    removeAutosave();
+
+    this->autosaveName = name;
+}
+
+QString RundownJournal::getAutosavePath(const QString& extension) const
+{
+    return QString("%1/.CasparCG/Client/Journal/%2.%3").arg(QDir::homePath())
+                                                      .arg(QString(QCryptographicHash::hash(this->autosaveName.toUtf8(), QCryptographicHash::Md5).toHex()))
+                                                      .arg(extension);
+}
+
+bool RundownJournal::hasAutosave() const
+{
+    return !this->autosaveName.isEmpty() && !this->autosaveLog.isOpen() && QFile::exists(getAutosavePath("xml"));
+}
+
+bool RundownJournal::recoverAutosave()
+{
+    if (!hasAutosave())
+        return false;
+
+    QFile file(getAutosavePath("xml"));
+    if (!file.open(QFile::ReadOnly))
+        return false;
+
+    QString data = QString::fromUtf8(file.readAll());
+    file.close();
+
+    // The log is read up front, replaying it starts a new autosave in the same place.
+    QList<QPair<bool, Entry>> entries;
+
+    QFile log(getAutosavePath("log"));
+    if (log.open(QFile::ReadOnly))
+    {
+        QDataStream stream(&log);
+        stream.setVersion(QDataStream::Qt_5_0);
+
+        while (!stream.atEnd())
+        {
+            bool forward;
+            Entry entry;
+
+            stream >> forward;
+            if (!readEntry(stream, entry))
+                break; // Cut short by the crash.
+
+            entries.append(qMakePair(forward, entry));
+        }
+
+        log.close();
+    }
+
+    suspend();
+
+    this->treeWidget->removeAllItems();
+
+    boost::property_tree::wptree pt = readXml(data);
+    this->treeWidget->insertItems(pt, 0);
+
+    reset();
+
+    int replayed = 0;
+    for (int i = 0; i < entries.count() && apply(entries.at(i).second, entries.at(i).first); i++)
+        replayed++;
+
+    qDebug("Recovered rundown %s from its autosave, %d of %d changes replayed", qPrintable(this->autosaveName), replayed, entries.count());
+
+    compactAutosave();
+
+    return true;
+}
+
+void RundownJournal::removeAutosave()
+{
+    if (this->autosaveLog.isOpen())
+        this->autosaveLog.close();
+
+    if (!this->autosaveName.isEmpty())
+    {
+        QFile::remove(getAutosavePath("xml"));
+        QFile::remove(getAutosavePath("log"));
+    }
+
+    this->autosaveEntries = 0;
+}
+
+void RundownJournal::writeAutosave(const Entry& entry, bool forward)
+{
+    if (this->autosaveName.isEmpty())
+        return;
+
+    // The snapshot is taken after the change, it already has this entry.
+    if (!this->autosaveLog.isOpen() || this->autosaveEntries >= Rundown::JOURNAL_COMPACT_ENTRIES)
+    {
+        compactAutosave();
+        return;
+    }
+
+    QDataStream stream(&this->autosaveLog);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << forward;
+    writeEntry(stream, entry);
+
+    this->autosaveLog.flush();
+    this->autosaveEntries++;
+}
+
+void RundownJournal::compactAutosave()
+{
+    QDir().mkpath(QString("%1/.CasparCG/Client/Journal").arg(QDir::homePath()));
+
+    // Put together from the XML we keep anyway, nothing in the tree is written again.
+    QFile file(getAutosavePath("tmp"));
+    if (!file.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        qWarning("Unable to write the autosave %s", qPrintable(file.fileName()));
+        return;
+    }
+
+    file.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?><items>");
+    foreach (const Shadow& shadow, this->shadows)
+        file.write(shadow.xml.toUtf8());
+
+    file.write("</items>");
+    file.close();
+
+    QFile::remove(getAutosavePath("xml"));
+    QFile::rename(getAutosavePath("tmp"), getAutosavePath("xml"));
+
+    if (this->autosaveLog.isOpen())
+        this->autosaveLog.close();
+
+    this->autosaveLog.setFileName(getAutosavePath("log"));
+    if (!this->autosaveLog.open(QFile::WriteOnly | QFile::Truncate))
+        qWarning("Unable to write the autosave %s", qPrintable(this->autosaveLog.fileName()));
+
+    this->autosaveEntries = 0;
+}
+
+void RundownJournal::writeEntry(QDataStream& stream, const Entry& entry)
+{
+    stream << qint32(entry.type) << qint32(entry.row) << qint32(entry.childRow) << entry.before << entry.after;
+
+    stream << qint32(entry.changes.count());
+    foreach (const Change& change, entry.changes)
+        stream << change.key << change.tree << change.before << change.after;
+
+    // Only moves have a count, entries written before them read the same.
+    if (entry.type == Move)
+        stream << qint32(entry.count);
+}
+
+bool RundownJournal::readEntry(QDataStream& stream, Entry& entry)
+{
+    qint32 type, row, childRow, count;
+    stream >> type >> row >> childRow >> entry.before >> entry.after >> count;
+
+    entry.type = type;
+    entry.row = row;
+    entry.childRow = childRow;
+
+    entry.changes.clear();
+    for (int i = 0; i < count && stream.status() == QDataStream::Ok; i++)
+    {
+        Change change;
+        stream >> change.key >> change.tree >> change.before >> change.after;
+
+        entry.changes.append(change);
+    }
+
+    entry.count = 0;
+    if (entry.type == Move)
+    {
+        stream >> count;
+        entry.count = count;
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
+int RundownJournal::getCost(const Entry& entry)
+{
+    int cost = 0;
+    foreach (const QString& xml, entry.before + entry.after)
+        cost += xml.size() * sizeof(QChar);
+
+    foreach (const Change& change, entry.changes)
+        cost += (change.key.size() + change.before.size() + change.after.size()) * sizeof(QChar);
+
+    return cost;
+}
+
+void RundownJournal::rowsChanged()
+{
+    if (this->recording)
+        this->synchronizeTimer.start();
+}
+
+void RundownJournal::synchronizeTree()
+{
+    synchronize(true);
+}
+
+void RundownJournal::itemExpansionChanged(QTreeWidgetItem* item)
+{
+    if (!this->recording || this->synchronizeTimer.isActive())
+        return;
+
+    // Not something to undo, but the next snapshot should have it.
+    int row = this->treeWidget->indexOfTopLevelItem(item);
+    if (row >= 0 && row < this->shadows.count() && matches(this->shadows.at(row), item))
+    {
+        QString xml = writeItem(item);
+        if (xml != this->shadows.at(row).xml)
+        {
+            this->shadows[row].xml = xml;
+            this->generation++;
+        }
+    }
+}
+
+void RundownJournal::commandChanged()
+{
+    if (this->recording)
+        recordItem(this->commands.value(sender()));
+}
+
+void RundownJournal::currentItemEdited()
+{
+    // Inspector events go to every rundown, only the visible one is being edited.
+    if (this->recording && this->treeWidget->isVisible())
+        this->currentItemTimer.start();
+}
+
+void RundownJournal::recordCurrentItem()
+{
+    itemChanged(this->treeWidget->currentItem());
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QCache>
+#include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+#include <QtWidgets/QTreeWidgetItem>
+#include <QtWidgets/QWidget>
+
+class AbstractCommand;
+class RundownTreeBaseWidget;
+
+// Undo and redo for a rundown. The journal keeps the XML of every top level item as it was last seen, edits
+// are found by comparing the tree against it, so no operation has to report itself. A structural edit is stored
+// as the items it replaced and the items it left, items that only changed places as a move, and a command edit
+// only as the properties that changed.
+// Entries live in a temporary file and only their offsets stay in memory. Each entry is also appended to an
+// autosave log next to a snapshot of the rundown, the snapshot is rewritten from time to time and the log emptied.
+// Every change also moves a generation counter on, the rundown needs saving while it differs from the saved one.
+class WIDGETS_EXPORT RundownJournal : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownJournal(RundownTreeBaseWidget* treeWidget);
+        ~RundownJournal();
+
+        void reset();
+        void suspend();
+        void resume();
+
+        bool canUndo() const;
+        bool canRedo() const;
+        bool undo();
+        bool redo();
+
+        void itemChanged(QTreeWidgetItem* item);
+        void touch();
+
+        quint64 getGeneration() const;
+        bool isModified() const;
+        void markSaved();
+        QString getItemXml(int row) const;
+
+        void setAutosaveName(const QString& name);
+        bool hasAutosave() const;
+        bool recoverAutosave();
+        void removeAutosave();
+
+    private:
+        enum EntryType
+        {
+            Structure,
+            Property,
+            Move
+        };
+
+        struct Change
+        {
+            QString key;
+            bool tree;
+            QString before;
+            QString after;
+        };
+
+        struct Entry
+        {
+            int type;
+            int row;
+            int childRow;
+            int count;
+            QStringList before;
+            QStringList after;
+            QList<Change> changes;
+        };
+
+        struct Node
+        {
+            QPointer<QWidget> widget;
+            AbstractCommand* command;
+        };
+
+        struct Shadow
+        {
+            Node item;
+            QList<Node> children;
+            QString xml;
+        };
+
+        RundownTreeBaseWidget* treeWidget;
+
+        bool recording;
+        quint64 generation;
+        quint64 savedGeneration;
+        QList<Shadow> shadows;
+        QHash<const QObject*, QWidget*> commands;
+        QTimer synchronizeTimer;
+        QTimer currentItemTimer;
+
+        QTemporaryFile history;
+        QVector<qint64> undoStack;
+        QVector<qint64> redoStack;
+        QCache<qint64, Entry> cache;
+
+        Entry pending;
+        bool hasPending;
+        QElapsedTimer pendingTime;
+
+        QString autosaveName;
+        QFile autosaveLog;
+        int autosaveEntries;
+
+        bool matches(const Shadow& shadow, QTreeWidgetItem* item) const;
+        bool isDirty(const Shadow& shadow) const;
+        Node createNode(QTreeWidgetItem* item);
+        Shadow createShadow(QTreeWidgetItem* item);
+        void releaseShadow(const Shadow& shadow);
+        QString writeItem(QTreeWidgetItem* item) const;
+        void synchronize(bool record);
+        int findRotation(int first, int end, const QList<Shadow>& created) const;
+
+        void recordItem(QWidget* widget);
+        void record(const Entry& entry);
+        void closePending();
+        bool apply(const Entry& entry, bool forward);
+
+        qint64 writeHistory(const Entry& entry);
+        bool readHistory(qint64 offset, Entry& entry);
+
+        QString getAutosavePath(const QString& extension) const;
+        void writeAutosave(const Entry& entry, bool forward);
+        void compactAutosave();
+
+        static void writeEntry(QDataStream& stream, const Entry& entry);
+        static bool readEntry(QDataStream& stream, Entry& entry);
+        static int getCost(const Entry& entry);
+
+        Q_SLOT void rowsChanged();
+        Q_SLOT void synchronizeTree();
+        Q_SLOT void itemExpansionChanged(QTreeWidgetItem*);
+        Q_SLOT void commandChanged();
+        Q_SLOT void currentItemEdited();
+        Q_SLOT void recordCurrentItem();
+};
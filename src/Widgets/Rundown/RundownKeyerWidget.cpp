@@ -110,14 +110,7 @@ AbstractRundownWidget* RundownKeyerWidget::clone()
     RundownKeyerWidget* widget = new RundownKeyerWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->inGroup, this->compactView);
 
-    KeyerCommand* command = dynamic_cast<KeyerCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
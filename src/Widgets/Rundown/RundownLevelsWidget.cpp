@@ -122,22 +122,7 @@ AbstractRundownWidget* RundownLevelsWidget::clone()
     RundownLevelsWidget* widget = new RundownLevelsWidget(this->model, this->parentWidget(), this->color, this->active,
                                                           this->inGroup, this->compactView);
 
-    LevelsCommand* command = dynamic_cast<LevelsCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setMinIn(this->command.getMinIn());
-    command->setMaxIn(this->command.getMaxIn());
-    command->setMinOut(this->command.getMinOut());
-    command->setMaxOut(this->command.getMaxOut());
-    command->setGamma(this->command.getGamma());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
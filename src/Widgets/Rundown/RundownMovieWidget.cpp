@@ -6,11 +6,10 @@
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
+#include "OscStateManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Events/Rundown/AutoPlayRundownItemEvent.h"
 
-#include <math.h>
-
 #include <QtCore/QObject>
 #include <QtCore/QFileInfo>
 
@@ -21,9 +20,8 @@
 RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* parent, const QString& color, bool active,
                                        bool loaded, bool paused, bool playing, bool inGroup, bool compactView)
     : QWidget(parent),
-      active(active), loaded(loaded), paused(paused), playing(playing), inGroup(inGroup), compactView(compactView), color(color), model(model),
-      reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false), useFreezeOnLoad(false), fileModel(NULL), timeSubscription(NULL),
-      frameSubscription(NULL), fpsSubscription(NULL), pathSubscription(NULL), pausedSubscription(NULL), loopSubscription(NULL), stopControlSubscription(NULL),
+      active(active), inGroup(inGroup), compactView(compactView), color(color), model(model),
+      reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false), useFreezeOnLoad(false), layerState(NULL), stopControlSubscription(NULL),
       playControlSubscription(NULL), playNowControlSubscription(NULL), loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL),
       updateControlSubscription(NULL), previewControlSubscription(NULL), clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL)
 {
@@ -31,7 +29,9 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
 
     this->animation = new ActiveAnimation(this->labelActiveColor);
 
-    this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
+    this->executor = new MovieCommandExecutor(&this->command, &this->model, this);
+    this->executor->setState(loaded, paused, playing);
+
     this->markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
     this->useFreezeOnLoad = (DatabaseManager::getInstance().getConfigurationByName("UseFreezeOnLoad").getValue() == "true") ? true : false;
 
@@ -56,9 +56,7 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
     this->labelDelay->setText(QString("Delay: %1").arg(this->command.getDelay()));
     this->labelDevice->setText(QString("Server: %1").arg(this->model.getDeviceName()));
 
-    this->executeStartTimer.setSingleShot(true);
-    this->executeStopTimer.setSingleShot(true);
-
+    QObject::connect(this->executor, SIGNAL(executed(Playout::PlayoutType)), this, SLOT(commandExecuted(Playout::PlayoutType)));
     QObject::connect(&this->command, SIGNAL(channelChanged(int)), this, SLOT(channelChanged(int)));
     QObject::connect(&this->command, SIGNAL(videolayerChanged(int)), this, SLOT(videolayerChanged(int)));
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
@@ -166,27 +164,10 @@ void RundownMovieWidget::deviceChanged(const DeviceChangedEvent& event)
 AbstractRundownWidget* RundownMovieWidget::clone()
 {
     RundownMovieWidget* widget = new RundownMovieWidget(this->model, this->parentWidget(), this->color, this->active,
-                                                        this->loaded, this->paused, this->playing, this->inGroup, this->compactView);
-
-    MovieCommand* command = dynamic_cast<MovieCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setVideoName(this->command.getVideoName());
-    command->setTransition(this->command.getTransition());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDirection(this->command.getDirection());
-    command->setLoop(this->command.getLoop());
-    command->setSeek(this->command.getSeek());
-    command->setLength(this->command.getLength());
-    command->setFreezeOnLoad(this->command.getFreezeOnLoad());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setAutoPlay(this->command.getAutoPlay());
+                                                        this->executor->isLoaded(), this->executor->isPaused(), this->executor->isPlaying(),
+                                                        this->inGroup, this->compactView);
+
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -330,12 +311,7 @@ void RundownMovieWidget::checkEmptyDevice()
 
 void RundownMovieWidget::clearDelayedCommands()
 {
-    this->executeStartTimer.stop();
-    this->executeStopTimer.stop();
-
-    this->paused = false;
-    this->loaded = false;
-    this->playing = false;
+    this->executor->clearDelayedCommands();
 }
 
 void RundownMovieWidget::setUsed(bool used)
@@ -368,78 +344,7 @@ void RundownMovieWidget::setUsed(bool used)
 
 bool RundownMovieWidget::executeCommand(Playout::PlayoutType type)
 {
-    if (type == Playout::PlayoutType::Stop)
-        executeStop();
-    else if ((type == Playout::PlayoutType::Play && !this->command.getTriggerOnNext()) || type == Playout::PlayoutType::Update)
-    {
-        if (this->command.getDelay() < 0)
-            return true;
-
-        if (this->command.getAutoPlay())
-            executePlay();
-        else
-        {
-            this->executeStartTimer.setInterval(0);
-            this->executeStopTimer.setInterval(0);
-            this->executeStartTimer.disconnect(); // Disconnect all events.
-            this->executeStopTimer.disconnect(); // Disconnect all events.
-            QObject::connect(&this->executeStartTimer, SIGNAL(timeout()), SLOT(executePlay()));
-            QObject::connect(&this->executeStopTimer, SIGNAL(timeout()), SLOT(executeStop()));
-
-            if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-            {
-                if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
-                {
-                    const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(this->model.getDeviceName()).getChannelFormats().split(",");
-                    if (this->command.getChannel() > channelFormats.count())
-                        return true;
-
-                    double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
-
-                    int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                    this->executeStartTimer.setInterval(startDelay);
-
-                    if (this->command.getDuration() > 0)
-                    {
-                        int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                        this->executeStopTimer.setInterval(startDelay + stopDelay);
-                    }
-                }
-                else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
-                {
-                    this->executeStartTimer.setInterval(this->command.getDelay());
-
-                    if (this->command.getDuration() > 0)
-                        this->executeStopTimer.setInterval(this->command.getDelay() + this->command.getDuration());
-                }
-
-                this->executeStartTimer.start();
-                if (this->executeStopTimer.interval() > 0)
-                    this->executeStopTimer.start();
-            }
-        }
-    }
-    else if (type == Playout::PlayoutType::PlayNow)
-        executePlay();
-    else if (type == Playout::PlayoutType::PauseResume)
-        executePause();
-    else if (type == Playout::PlayoutType::Load)
-        executeLoad();
-    else if (type == Playout::PlayoutType::Next)
-    {
-        if (this->command.getAutoPlay())
-            executeNext();
-        else if (this->command.getTriggerOnNext())
-            executePlay();
-    }
-    else if (type == Playout::PlayoutType::Clear)
-        executeClearVideolayer();
-    else if (type == Playout::PlayoutType::ClearVideoLayer)
-        executeClearVideolayer();
-    else if (type == Playout::PlayoutType::ClearChannel)
-        executeClearChannel();
-    else if (type == Playout::PlayoutType::Preview)
-        executeLoadPreview();
+    this->executor->execute(type);
 
     if (this->active)
         this->animation->start(1);
@@ -447,351 +352,44 @@ bool RundownMovieWidget::executeCommand(Playout::PlayoutType type)
     return true;
 }
 
-void RundownMovieWidget::executeStop()
-{
-    this->executeStartTimer.stop();
-    this->executeStopTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
-
-        // Stop preview channels item.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-            device->stop(deviceModel->getPreviewChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
-
-            // Stop preview channels item.
-            if (model.getPreviewChannel() > 0)
-                deviceShadow->stop(model.getPreviewChannel(), this->command.getVideolayer());
-        }
-    }
-
-    this->paused = false;
-    this->loaded = false;
-    this->playing = false;
-    this->sendAutoPlay= false;
-
-    this->widgetOscTime->setPaused(this->paused);
-    this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
-}
-
-void RundownMovieWidget::executePlay()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-        {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        }
-        else
-        {
-            if (this->command.getAutoPlay())
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), true);
-            }
-            else
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), this->command.getAutoPlay());
-            }
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                if (this->command.getAutoPlay())
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), true);
-                }
-                else
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), this->command.getAutoPlay());
-                }
-            }
-        }
-    }
-
-    if (this->markUsedItems)
-        setUsed(true);
-
-    this->paused = false;
-    this->loaded = false;
-    this->playing = true;
-    this->hasSentAutoPlay = false;
-
-    if (this->command.getAutoPlay())
-        this->sendAutoPlay= true;
-}
-
-void RundownMovieWidget::executePause()
+void RundownMovieWidget::executeQueue()
 {
-    if (!this->playing)
+    if (!this->executor->queue())
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->resume(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->resume(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
-
-    this->paused = !this->paused;
-
-    this->widgetOscTime->setPaused(this->paused);
-}
-
-void RundownMovieWidget::executeLoad()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                          this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                    this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-        }
-    }
-
-    this->loaded = true;
-    this->paused = false;
-    this->playing = false;
-    this->sendAutoPlay= false;
+    this->sendAutoPlay = true;
+    this->hasSentAutoPlay = false;
 }
 
-void RundownMovieWidget::executeLoadPreview()
+void RundownMovieWidget::commandExecuted(Playout::PlayoutType type)
 {
-    const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-    if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
+    if (type == Playout::PlayoutType::Stop || type == Playout::PlayoutType::ClearVideoLayer || type == Playout::PlayoutType::ClearChannel)
     {
-        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-        if (device != NULL && device->isConnected())
-        {
-            device->loadMovie(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                              this->command.getLoop(), true, false);
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
+        this->sendAutoPlay = false;
+        this->hasSentAutoPlay = false;
 
-        if (model.getPreviewChannel() > 0)
-        {
-            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-            {
-                deviceShadow->loadMovie(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                        this->command.getLoop(), true, false);
-            }
-        }
+        this->widgetOscTime->setPaused(false);
+        this->widgetOscTime->reset();
     }
-}
-
-void RundownMovieWidget::executeNext()
-{
-    if (this->command.getAutoPlay())
+    else if (type == Playout::PlayoutType::Play)
     {
-        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-        if (device != NULL && device->isConnected())
-        {
-            device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                              this->command.getLoop(), false);
-
-        }
-
-        foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-        {
-            if (model.getShadow() == "No")
-                continue;
-
-            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-            {
-                deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                        this->command.getLoop(), false);
-            }
-        }
+        if (this->markUsedItems)
+            setUsed(true);
 
-        this->paused = false;
-        this->loaded = false;
-        this->playing = true;
+        this->hasSentAutoPlay = false;
 
         if (this->command.getAutoPlay())
-            this->sendAutoPlay= true;
-    }
-}
-
-void RundownMovieWidget::executeClearVideolayer()
-{
-    this->executeStartTimer.stop();
-    this->executeStopTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-        // Clear preview channels videolayer.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-            device->clearVideolayer(deviceModel->getPreviewChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-            // Clear preview channels videolayer.
-            if (model.getPreviewChannel() > 0)
-                deviceShadow->clearVideolayer(model.getPreviewChannel(), this->command.getVideolayer());
-        }
-    }
-
-    this->paused = false;
-    this->loaded = false;
-    this->playing = false;
-    this->sendAutoPlay= false;
-
-    this->widgetOscTime->setPaused(this->paused);
-    this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
-}
-
-void RundownMovieWidget::executeClearChannel()
-{
-    this->executeStartTimer.stop();
-    this->executeStopTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-
-        // Clear preview channel.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-        {
-            device->clearChannel(deviceModel->getPreviewChannel());
-            device->clearMixerChannel(deviceModel->getPreviewChannel());
-        }
+            this->sendAutoPlay = true;
     }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    else if (type == Playout::PlayoutType::Next)
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-
-            // Clear preview channel.
-            if (model.getPreviewChannel() > 0)
-            {
-                deviceShadow->clearChannel(model.getPreviewChannel());
-                deviceShadow->clearMixerChannel(model.getPreviewChannel());
-            }
-        }
+        if (this->command.getAutoPlay())
+            this->sendAutoPlay = true;
     }
-
-    this->paused = false;
-    this->loaded = false;
-    this->playing = false;
-    this->sendAutoPlay= false;
-
-    this->widgetOscTime->setPaused(this->paused);
-    this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
+    else if (type == Playout::PlayoutType::Load)
+        this->sendAutoPlay = false;
+    else if (type == Playout::PlayoutType::PauseResume)
+        this->widgetOscTime->setPaused(this->executor->isPaused());
 }
 
 void RundownMovieWidget::checkGpiConnection()
@@ -821,71 +419,12 @@ void RundownMovieWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
             return;
 
-    if (this->timeSubscription != NULL)
-        this->timeSubscription->disconnect(); // Disconnect all events.
-
-    if (this->frameSubscription != NULL)
-        this->frameSubscription->disconnect(); // Disconnect all events.
-
-    if (this->fpsSubscription != NULL)
-        this->fpsSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pathSubscription != NULL)
-        this->pathSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pausedSubscription != NULL)
-        this->pausedSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loopSubscription != NULL)
-        this->loopSubscription->disconnect(); // Disconnect all events.
-
-    QString timeFilter = Osc::DEFAULT_TIME_FILTER;
-    timeFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->timeSubscription = new OscSubscription(timeFilter, this);
-    QObject::connect(this->timeSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(timeSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString frameFilter = Osc::DEFAULT_FRAME_FILTER;
-    frameFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-               .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->frameSubscription = new OscSubscription(frameFilter, this);
-    QObject::connect(this->frameSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(frameSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString fpsFilter = Osc::DEFAULT_FPS_FILTER;
-    fpsFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-             .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-             .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->fpsSubscription = new OscSubscription(fpsFilter, this);
-    QObject::connect(this->fpsSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(fpsSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pathFilter = Osc::DEFAULT_PATH_FILTER;
-    pathFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pathSubscription = new OscSubscription(pathFilter, this);
-    QObject::connect(this->pathSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pathSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pausedFilter = Osc::DEFAULT_PAUSED_FILTER;
-    pausedFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-                .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-                .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pausedSubscription = new OscSubscription(pausedFilter, this);
-    QObject::connect(this->pausedSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pausedSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString loopFilter = Osc::DEFAULT_LOOP_FILTER;
-    loopFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->loopSubscription = new OscSubscription(loopFilter, this);
-    QObject::connect(this->loopSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loopSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    if (this->layerState != NULL)
+        QObject::disconnect(this->layerState, SIGNAL(changed()), this, SLOT(layerStateChanged()));
+
+    this->layerState = OscStateManager::getInstance().getLayerState(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress(),
+                                                                    this->command.getChannel(), this->command.getVideolayer());
+    QObject::connect(this->layerState, SIGNAL(changed()), this, SLOT(layerStateChanged()));
 
     if (!this->command.getAllowRemoteTriggering())
         return;
@@ -1052,73 +591,44 @@ void RundownMovieWidget::deviceAdded(CasparDevice& device)
     configureOscSubscriptions();
 }
 
-void RundownMovieWidget::timeSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownMovieWidget::layerStateChanged()
 {
-    Q_UNUSED(predicate);
+    int changes = this->layerState->getChanges();
 
-    if (this->fileModel != NULL)
-    {
-        delete this->fileModel;
-        this->fileModel = NULL;
-    }
-
-    this->fileModel = new OscFileModel();
-    this->fileModel->setTime(arguments.at(0).toDouble());
-    this->fileModel->setTotalTime(arguments.at(1).toDouble());
-}
+    if (changes & OscLayerState::Paused)
+        this->widgetOscTime->setPaused(this->layerState->getPaused());
 
-void RundownMovieWidget::frameSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
+    if (changes & OscLayerState::Loop)
+        this->widgetOscTime->setLoop(this->layerState->getLoop());
 
-    if (this->fileModel == NULL)
+    if ((changes & OscLayerState::Path) == 0)
         return;
 
-    this->fileModel->setFrame(arguments.at(0).toInt());
-    this->fileModel->setTotalFrames(arguments.at(1).toInt());
-}
-
-void RundownMovieWidget::fpsSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setFramesPerSecond(arguments.at(0).toDouble());
-}
-
-void RundownMovieWidget::pathSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    QString name = arguments.at(0).toString();
+    QString name = this->layerState->getPath();
     name.remove(name.lastIndexOf('.'), name.length()); // Remove extension.
 
     if (this->model.getName().toLower() != name.toLower())
         return; // Wrong file.
 
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setPath(arguments.at(0).toString());
+    this->widgetOscTime->setProgress(this->layerState->getFrame());
 
-    this->widgetOscTime->setProgress(this->fileModel->getFrame());
-
-    if (this->reverseOscTime && this->fileModel->getFrame() > 0)
-        this->widgetOscTime->setTime(this->fileModel->getTotalFrames() - this->fileModel->getFrame());
+    if (this->reverseOscTime && this->layerState->getFrame() > 0)
+        this->widgetOscTime->setTime(this->layerState->getTotalFrames() - this->layerState->getFrame());
     else
-        this->widgetOscTime->setTime(this->fileModel->getFrame());
+        this->widgetOscTime->setTime(this->layerState->getFrame());
 
     if (this->command.getSeek() == 0 && this->command.getLength() == 0)
-        this->widgetOscTime->setInOutTime(0, this->fileModel->getTotalFrames());
+        this->widgetOscTime->setInOutTime(0, this->layerState->getTotalFrames());
     else
         this->widgetOscTime->setInOutTime(this->command.getSeek(), this->command.getLength());
 
-    this->widgetOscTime->setFramesPerSecond(this->fileModel->getFramesPerSecond());
+    this->widgetOscTime->setFramesPerSecond(this->layerState->getFramesPerSecond());
 
     if (this->sendAutoPlay && !this->hasSentAutoPlay)
     {
+        if (this->markUsedItems)
+            setUsed(true);
+
         EventManager::getInstance().fireAutoPlayRundownItemEvent(AutoPlayRundownItemEvent(this));
 
         this->sendAutoPlay = false;
@@ -1127,21 +637,7 @@ void RundownMovieWidget::pathSubscriptionReceived(const QString& predicate, cons
         qDebug("Dispatched AutoPlay event");
     }
 
-    this->playing = true;
-}
-
-void RundownMovieWidget::pausedSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setPaused(arguments.at(0).toBool());
-}
-
-void RundownMovieWidget::loopSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setLoop(arguments.at(0).toBool());
+    this->executor->setPlaying(true);
 }
 
 void RundownMovieWidget::autoPlayChanged(bool autoPlay)
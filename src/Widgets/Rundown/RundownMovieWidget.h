@@ -10,21 +10,21 @@
 
 #include "GpiDevice.h"
 
+#include "OscLayerState.h"
 #include "OscSubscription.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
 #include "Commands/MovieCommand.h"
+#include "Executors/MovieCommandExecutor.h"
 #include "Events/Inspector/ChannelChangedEvent.h"
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Events/Inspector/TargetChangedEvent.h"
 #include "Events/Inspector/VideolayerChangedEvent.h"
 #include "Models/LibraryModel.h"
-#include "Models/OscFileModel.h"
 
 #include <QtCore/QString>
-#include <QtCore/QTimer>
 
 #include <QtWidgets/QWidget>
 
@@ -43,6 +43,8 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         virtual bool isInGroup() const;
         virtual bool executeCommand(Playout::PlayoutType type);
 
+        void executeQueue();
+
         virtual AbstractCommand* getCommand();
         virtual LibraryModel* getLibraryModel();
 
@@ -61,30 +63,21 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
 
     private:
         bool active;
-        bool loaded;
-        bool paused;
-        bool playing;
         bool inGroup;
         bool compactView;
         QString color;
         LibraryModel model;
         MovieCommand command;
+        MovieCommandExecutor* executor;
         ActiveAnimation* animation;
         bool reverseOscTime;
         bool sendAutoPlay;
         bool hasSentAutoPlay;
-        QString delayType;
         bool markUsedItems;
         bool useFreezeOnLoad;
         bool selected = false;
 
-        OscFileModel* fileModel;
-        OscSubscription* timeSubscription;
-        OscSubscription* frameSubscription;
-        OscSubscription* fpsSubscription;
-        OscSubscription* pathSubscription;
-        OscSubscription* pausedSubscription;
-        OscSubscription* loopSubscription;
+        OscLayerState* layerState;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -98,9 +91,6 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeStartTimer;
-        QTimer executeStopTimer;
-
         void setThumbnail();
         void checkEmptyDevice();
         void checkGpiConnection();
@@ -109,14 +99,7 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         void setTimecode(const QString& timecode);
 
         Q_SLOT void channelChanged(int);
-        Q_SLOT void executeClearVideolayer();
-        Q_SLOT void executeClearChannel();
-        Q_SLOT void executeLoad();
-        Q_SLOT void executePlay();
-        Q_SLOT void executePause();
-        Q_SLOT void executeStop();
-        Q_SLOT void executeNext();
-        Q_SLOT void executeLoadPreview();
+        Q_SLOT void commandExecuted(Playout::PlayoutType);
         Q_SLOT void videolayerChanged(int);
         Q_SLOT void delayChanged(int);
         Q_SLOT void allowGpiChanged(bool);
@@ -125,12 +108,7 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void timeSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void frameSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void fpsSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pathSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pausedSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loopSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void layerStateChanged();
         Q_SLOT void autoPlayChanged(bool);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -122,19 +122,7 @@ AbstractRundownWidget* RundownOpacityWidget::clone()
     RundownOpacityWidget* widget = new RundownOpacityWidget(this->model, this->parentWidget(), this->color,
                                                             this->active, this->inGroup, this->compactView);
 
-    OpacityCommand* command = dynamic_cast<OpacityCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setOpacity(this->command.getOpacity());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "OscDeviceManager.h"
+#include "AsyncDatabaseManager.h"
 #include "DatabaseManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -45,9 +46,11 @@ RundownOscOutputWidget::RundownOscOutputWidget(const LibraryModel& model, QWidge
     QObject::connect(&this->executeTimer, SIGNAL(timeout()), SLOT(executePlay()));
 
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
+    QObject::connect(&this->command, SIGNAL(outputChanged(const QString&)), this, SLOT(outputChanged(const QString&)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(oscOutputChanged(const OscOutputChangedEvent&)), this, SLOT(oscOutputChanged(const OscOutputChangedEvent&)));
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -70,20 +73,7 @@ AbstractRundownWidget* RundownOscOutputWidget::clone()
     RundownOscOutputWidget* widget = new RundownOscOutputWidget(this->model, this->parentWidget(), this->color,
                                                                 this->active, this->inGroup, this->compactView);
 
-    OscOutputCommand* command = dynamic_cast<OscOutputCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setOutput(this->command.getOutput());
-    command->setPath(this->command.getPath());
-    command->setMessage(this->command.getMessage());
-    command->setType(this->command.getType());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setUseBundle(this->command.getUseBundle());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -230,8 +220,63 @@ void RundownOscOutputWidget::executeStop()
 
 void RundownOscOutputWidget::executePlay()
 {
-    OscOutputModel model = DatabaseManager::getInstance().getOscOutputByName(this->command.getOutput());
+    // The output is normally looked up when it is set. A take that comes before the lookup is back reads it
+    // here instead, it is never dropped.
+    if (this->resolvedRequest != this->outputRequest)
+    {
+        this->outputModel = DatabaseManager::getInstance().getOscOutputByName(this->command.getOutput());
+        this->resolvedRequest = this->outputRequest;
+    }
+
+    sendMessage(this->outputModel);
+
+    if (this->markUsedItems)
+        setUsed(true);
+}
+
+void RundownOscOutputWidget::resolveOutput()
+{
+    QString output = this->command.getOutput();
+    int request = ++this->outputRequest;
+
+    if (output.isEmpty())
+    {
+        this->outputModel = OscOutputModel();
+        this->resolvedRequest = request;
+        return;
+    }
 
+    AsyncDatabaseManager::getInstance().read<OscOutputModel>([output]()
+    {
+        return DatabaseManager::getInstance().getOscOutputByName(output);
+    }, this, [this, request](const OscOutputModel& model)
+    {
+        // A newer lookup is on its way.
+        if (request == this->outputRequest)
+        {
+            this->outputModel = model;
+            this->resolvedRequest = request;
+        }
+    });
+}
+
+void RundownOscOutputWidget::outputChanged(const QString& output)
+{
+    Q_UNUSED(output);
+
+    resolveOutput();
+}
+
+void RundownOscOutputWidget::oscOutputChanged(const OscOutputChangedEvent& event)
+{
+    Q_UNUSED(event);
+
+    // The address or port of an output may have been edited in the settings.
+    resolveOutput();
+}
+
+void RundownOscOutputWidget::sendMessage(const OscOutputModel& model)
+{
     if (this->command.getType() == "Boolean")
         OscDeviceManager::getInstance().getOscSender()->send(model.getAddress(), model.getPort(), this->command.getPath(), (this->command.getMessage() == "true") ? true : false, this->command.getUseBundle());
     else if (this->command.getType() == "Double")
@@ -242,9 +287,6 @@ void RundownOscOutputWidget::executePlay()
         OscDeviceManager::getInstance().getOscSender()->send(model.getAddress(), model.getPort(), this->command.getPath(), this->command.getMessage().toInt(), this->command.getUseBundle());
     else if (this->command.getType() == "String")
         OscDeviceManager::getInstance().getOscSender()->send(model.getAddress(), model.getPort(), this->command.getPath(), this->command.getMessage(), this->command.getUseBundle());
-
-    if (this->markUsedItems)
-        setUsed(true);
 }
 
 void RundownOscOutputWidget::delayChanged(int delay)
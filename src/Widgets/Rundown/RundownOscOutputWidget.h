@@ -13,8 +13,10 @@
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
 #include "Commands/OscOutputCommand.h"
+#include "Events/OscOutputChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Models/LibraryModel.h"
+#include "Models/OscOutputModel.h"
 
 #include <QtCore/QString>
 #include <QtCore/QTimer>
@@ -72,12 +74,20 @@ class WIDGETS_EXPORT RundownOscOutputWidget : public QWidget, Ui::RundownOscOutp
 
         QTimer executeTimer;
 
+        OscOutputModel outputModel;
+        int outputRequest = 0;
+        int resolvedRequest = -1; // Nothing looked up yet.
+
         void checkGpiConnection();
         void configureOscSubscriptions();
+        void resolveOutput();
+        void sendMessage(const OscOutputModel& model);
 
         Q_SLOT void executePlay();
         Q_SLOT void executeStop();
         Q_SLOT void delayChanged(int);
+        Q_SLOT void outputChanged(const QString&);
+        Q_SLOT void oscOutputChanged(const OscOutputChangedEvent&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void allowGpiChanged(bool);
         Q_SLOT void remoteTriggerIdChanged(const QString&);
@@ -122,27 +122,7 @@ AbstractRundownWidget* RundownPerspectiveWidget::clone()
     RundownPerspectiveWidget* widget = new RundownPerspectiveWidget(this->model, this->parentWidget(), this->color,
                                                                     this->active, this->inGroup, this->compactView);
 
-    PerspectiveCommand* command = dynamic_cast<PerspectiveCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setUpperLeftX(this->command.getUpperLeftX());
-    command->setUpperLeftY(this->command.getUpperLeftY());
-    command->setUpperRightX(this->command.getUpperRightX());
-    command->setUpperRightY(this->command.getUpperRightY());
-    command->setLowerRightX(this->command.getLowerRightX());
-    command->setLowerRightY(this->command.getLowerRightY());
-    command->setLowerLeftX(this->command.getLowerLeftX());
-    command->setLowerLeftY(this->command.getLowerLeftY());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setDefer(this->command.getDefer());
-    command->setUseMipmap(this->command.getUseMipmap());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -68,15 +68,7 @@ AbstractRundownWidget* RundownPlayoutCommandWidget::clone()
     RundownPlayoutCommandWidget* widget = new RundownPlayoutCommandWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                           this->inGroup, this->compactView);
 
-    PlayoutCommand* command = dynamic_cast<PlayoutCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setPlayoutCommand(this->command.getPlayoutCommand());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
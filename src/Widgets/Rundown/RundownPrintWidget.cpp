@@ -107,14 +107,7 @@ AbstractRundownWidget* RundownPrintWidget::clone()
     RundownPrintWidget* widget = new RundownPrintWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->inGroup, this->compactView);
 
-    PrintCommand* command = dynamic_cast<PrintCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
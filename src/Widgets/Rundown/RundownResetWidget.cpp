@@ -109,14 +109,7 @@ AbstractRundownWidget* RundownResetWidget::clone()
     RundownResetWidget* widget = new RundownResetWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->inGroup, this->compactView);
 
-    ResetCommand* command = dynamic_cast<ResetCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
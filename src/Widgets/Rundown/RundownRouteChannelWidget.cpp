@@ -112,15 +112,7 @@ AbstractRundownWidget* RundownRouteChannelWidget::clone()
                                                                       this->active, this->loaded, this->paused, this->playing,
                                                                       this->inGroup, this->compactView);
 
-    RouteChannelCommand* command = dynamic_cast<RouteChannelCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setFromChannel(this->command.getFromChannel());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
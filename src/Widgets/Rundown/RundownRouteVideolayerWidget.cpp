@@ -112,16 +112,7 @@ AbstractRundownWidget* RundownRouteVideolayerWidget::clone()
                                                                             this->active, this->loaded, this->paused, this->playing,
                                                                             this->inGroup, this->compactView);
 
-    RouteVideolayerCommand* command = dynamic_cast<RouteVideolayerCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setFromChannel(this->command.getFromChannel());
-    command->setFromVideolayer(this->command.getFromVideolayer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
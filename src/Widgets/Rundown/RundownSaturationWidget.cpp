@@ -122,18 +122,7 @@ AbstractRundownWidget* RundownSaturationWidget::clone()
     RundownSaturationWidget* widget = new RundownSaturationWidget(this->model, this->parentWidget(), this->color,
                                                                   this->active, this->inGroup, this->compactView);
 
-    SaturationCommand* command = dynamic_cast<SaturationCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setSaturation(this->command.getSaturation());
-    command->setTransitionDuration(this->command.getTransitionDuration());
-    command->setTween(this->command.getTween());
-    command->setDefer(this->command.getDefer());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
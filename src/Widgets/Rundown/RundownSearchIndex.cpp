@@ -0,0 +1,223 @@
+#include "RundownSearchIndex.h"
+#include "AbstractRundownWidget.h"
+
+#include "Trace.h"
+
+#include "Commands/TemplateCommand.h"
+#include "Models/KeyValueModel.h"
+
+#include <QtCore/QStringList>
+
+RundownSearchIndex::RundownSearchIndex(QTreeWidget* treeWidget)
+    : QObject(treeWidget),
+      treeWidget(treeWidget), orderValid(false), generation(0), lastGeneration(-1)
+{
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)), this, SLOT(rowsInserted(const QModelIndex&, int, int)));
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex&, int, int)), this, SLOT(rowsAboutToBeRemoved(const QModelIndex&, int, int)));
+    QObject::connect(this->treeWidget->model(), SIGNAL(rowsMoved(const QModelIndex&, int, int, const QModelIndex&, int)), this, SLOT(rowsMoved()));
+    QObject::connect(this->treeWidget->model(), SIGNAL(modelReset()), this, SLOT(modelReset()));
+
+    // Inspector edits only ever go to the current item, once it loses focus it is read again.
+    QObject::connect(this->treeWidget, SIGNAL(currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*)), this, SLOT(currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*)));
+}
+
+void RundownSearchIndex::build()
+{
+    TRACE_FUNCTION("rundown");
+
+    clear();
+
+    for (int i = 0; i < this->treeWidget->topLevelItemCount(); i++)
+        addItem(this->treeWidget->topLevelItem(i));
+
+    update();
+}
+
+void RundownSearchIndex::clear()
+{
+    this->entries.clear();
+    this->staleItems.clear();
+    this->order.clear();
+    this->orderValid = false;
+    this->generation++;
+}
+
+void RundownSearchIndex::invalidate(QTreeWidgetItem* item)
+{
+    if (item != NULL && this->entries.contains(item))
+        this->staleItems.insert(item);
+}
+
+QTreeWidgetItem* RundownSearchIndex::getItem(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return this->treeWidget->invisibleRootItem();
+
+    QTreeWidgetItem* parent = getItem(index.parent());
+    return (parent != NULL) ? parent->child(index.row()) : NULL;
+}
+
+void RundownSearchIndex::addItem(QTreeWidgetItem* item)
+{
+    // The item widget is set after the row is inserted, so the text is read on the next search.
+    this->entries.insert(item, QString());
+    this->staleItems.insert(item);
+
+    for (int i = 0; i < item->childCount(); i++)
+        addItem(item->child(i));
+}
+
+void RundownSearchIndex::removeItem(QTreeWidgetItem* item)
+{
+    this->entries.remove(item);
+    this->staleItems.remove(item);
+
+    for (int i = 0; i < item->childCount(); i++)
+        removeItem(item->child(i));
+}
+
+void RundownSearchIndex::readItem(QTreeWidgetItem* item)
+{
+    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidget->itemWidget(item, 0));
+    if (widget == NULL)
+        return;
+
+    QStringList fields;
+    fields.append(widget->getLibraryModel()->getLabel());
+    fields.append(widget->getLibraryModel()->getName());
+    fields.append(widget->getCommand()->getRemoteTriggerId());
+    fields.append(widget->getCommand()->getStoryId());
+
+    const TemplateCommand* templateCommand = dynamic_cast<TemplateCommand*>(widget->getCommand());
+    if (templateCommand != NULL)
+    {
+        foreach (const KeyValueModel& model, templateCommand->getTemplateDataModels())
+            fields.append(model.getValue());
+    }
+
+    // One line per field so a term never matches across two of them.
+    QString text = fields.join("\n").toLower();
+
+    this->staleItems.remove(item);
+
+    QString& entry = this->entries[item];
+    if (entry != text)
+    {
+        entry = text;
+        this->generation++;
+    }
+}
+
+void RundownSearchIndex::update()
+{
+    if (!this->orderValid)
+    {
+        this->order.clear();
+        this->order.reserve(this->entries.count());
+
+        for (int i = 0; i < this->treeWidget->topLevelItemCount(); i++)
+        {
+            QTreeWidgetItem* item = this->treeWidget->topLevelItem(i);
+            this->order.append(item);
+
+            for (int j = 0; j < item->childCount(); j++)
+                this->order.append(item->child(j));
+        }
+
+        this->orderValid = true;
+        this->generation++;
+    }
+
+    foreach (QTreeWidgetItem* item, this->staleItems.toList())
+        readItem(item);
+
+    // The current item may be in the middle of an edit.
+    if (this->treeWidget->currentItem() != NULL && this->entries.contains(this->treeWidget->currentItem()))
+        readItem(this->treeWidget->currentItem());
+}
+
+QList<QTreeWidgetItem*> RundownSearchIndex::search(const QString& query)
+{
+    TRACE_FUNCTION("rundown");
+
+    QStringList terms = query.toLower().split(' ', QString::SkipEmptyParts);
+    if (terms.isEmpty())
+    {
+        this->lastQuery.clear();
+        this->lastResults.clear();
+
+        return QList<QTreeWidgetItem*>();
+    }
+
+    update();
+
+    // Typing only narrows the result, unless the rundown changed the last matches are all there is to scan.
+    bool narrowing = this->lastGeneration == this->generation && !this->lastQuery.isEmpty() && query.startsWith(this->lastQuery, Qt::CaseInsensitive);
+    const QList<QTreeWidgetItem*> candidates = (narrowing) ? this->lastResults : this->order;
+
+    QList<QTreeWidgetItem*> results;
+    foreach (QTreeWidgetItem* item, candidates)
+    {
+        const QString text = this->entries.value(item);
+
+        bool match = true;
+        foreach (const QString& term, terms)
+        {
+            if (!text.contains(term))
+            {
+                match = false;
+                break;
+            }
+        }
+
+        if (match)
+            results.append(item);
+    }
+
+    this->lastQuery = query;
+    this->lastGeneration = this->generation;
+    this->lastResults = results;
+
+    return results;
+}
+
+void RundownSearchIndex::rowsInserted(const QModelIndex& parent, int first, int last)
+{
+    QTreeWidgetItem* parentItem = getItem(parent);
+    if (parentItem == NULL)
+        return;
+
+    for (int row = first; row <= last && row < parentItem->childCount(); row++)
+        addItem(parentItem->child(row));
+
+    this->orderValid = false;
+}
+
+void RundownSearchIndex::rowsAboutToBeRemoved(const QModelIndex& parent, int first, int last)
+{
+    QTreeWidgetItem* parentItem = getItem(parent);
+    if (parentItem == NULL)
+        return;
+
+    for (int row = first; row <= last && row < parentItem->childCount(); row++)
+        removeItem(parentItem->child(row));
+
+    this->orderValid = false;
+}
+
+void RundownSearchIndex::rowsMoved()
+{
+    this->orderValid = false;
+}
+
+void RundownSearchIndex::modelReset()
+{
+    clear();
+}
+
+void RundownSearchIndex::currentItemChanged(QTreeWidgetItem* current, QTreeWidgetItem* previous)
+{
+    Q_UNUSED(current);
+
+    invalidate(previous);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QModelIndex>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+#include <QtWidgets/QTreeWidget>
+#include <QtWidgets/QTreeWidgetItem>
+
+// Searchable text of every item in a rundown: label, target name, template data values, remote trigger id
+// and story id. The text is read once when an item is added and again when it may have been edited, a
+// search then only scans strings and never touches the item widgets.
+class WIDGETS_EXPORT RundownSearchIndex : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownSearchIndex(QTreeWidget* treeWidget);
+
+        void build();
+        void invalidate(QTreeWidgetItem* item);
+
+        QList<QTreeWidgetItem*> search(const QString& query);
+
+    private:
+        QTreeWidget* treeWidget;
+
+        QHash<QTreeWidgetItem*, QString> entries;
+        QSet<QTreeWidgetItem*> staleItems;
+        QList<QTreeWidgetItem*> order;
+        bool orderValid;
+        int generation;
+
+        QString lastQuery;
+        int lastGeneration;
+        QList<QTreeWidgetItem*> lastResults;
+
+        void clear();
+        void update();
+        void addItem(QTreeWidgetItem* item);
+        void removeItem(QTreeWidgetItem* item);
+        void readItem(QTreeWidgetItem* item);
+        QTreeWidgetItem* getItem(const QModelIndex& index) const;
+
+        Q_SLOT void rowsInserted(const QModelIndex&, int, int);
+        Q_SLOT void rowsAboutToBeRemoved(const QModelIndex&, int, int);
+        Q_SLOT void rowsMoved();
+        Q_SLOT void modelReset();
+        Q_SLOT void currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*);
+};
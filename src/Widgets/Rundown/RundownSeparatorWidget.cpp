@@ -49,6 +49,8 @@ AbstractRundownWidget* RundownSeparatorWidget::clone()
     RundownSeparatorWidget* widget = new RundownSeparatorWidget(this->model, this->parentWidget(), this->color,
                                                                 this->active, this->inGroup, this->compactView);
 
+    widget->getCommand()->copyProperties(&this->command);
+
     return widget;
 }
 
@@ -10,10 +10,7 @@
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Events/Inspector/AddTemplateDataEvent.h"
 
-#include <math.h>
-
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
 #include <QtCore/QMimeData>
 
 #include <QtWidgets/QGraphicsOpacityEffect>
@@ -21,7 +18,7 @@
 RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget* parent, const QString& color, bool active,
                                              bool loaded, bool inGroup, bool compactView)
     : QWidget(parent),
-      active(active), loaded(loaded), inGroup(inGroup), compactView(compactView), color(color), model(model), stopControlSubscription(NULL),
+      active(active), inGroup(inGroup), compactView(compactView), color(color), model(model), stopControlSubscription(NULL),
       playControlSubscription(NULL), playNowControlSubscription(NULL), loadControlSubscription(NULL), nextControlSubscription(NULL), updateControlSubscription(NULL),
       invokeControlSubscription(NULL), previewControlSubscription(NULL), clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL)
 {
@@ -30,7 +27,9 @@ RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget*
 
     this->animation = new ActiveAnimation(this->labelActiveColor);
 
-    this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
+    this->executor = new TemplateCommandExecutor(&this->command, &this->model, this);
+    this->executor->setLoaded(loaded);
+
     this->markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
 
     setColor(this->color);
@@ -50,9 +49,7 @@ RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget*
     this->labelFlashlayer->setText(QString("Flash layer: %1").arg(this->command.getFlashlayer()));
     this->labelDevice->setText(QString("Server: %1").arg(this->model.getDeviceName()));
 
-    this->executeTimer.setSingleShot(true);
-    this->executePreviewTimer.setSingleShot(true);
-
+    QObject::connect(this->executor, SIGNAL(executed(Playout::PlayoutType)), this, SLOT(commandExecuted(Playout::PlayoutType)));
     QObject::connect(&this->command, SIGNAL(channelChanged(int)), this, SLOT(channelChanged(int)));
     QObject::connect(&this->command, SIGNAL(videolayerChanged(int)), this, SLOT(videolayerChanged(int)));
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
@@ -159,24 +156,9 @@ void RundownTemplateWidget::dropEvent(QDropEvent* event)
 AbstractRundownWidget* RundownTemplateWidget::clone()
 {
     RundownTemplateWidget* widget = new RundownTemplateWidget(this->model, this->parentWidget(), this->color, this->active,
-                                                              this->loaded, this->inGroup, this->compactView);
-
-    TemplateCommand* command = dynamic_cast<TemplateCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setFlashlayer(this->command.getFlashlayer());
-    command->setInvoke(this->command.getInvoke());
-    command->setTemplateName(this->command.getTemplateName());
-    command->setTemplateDataModels(this->command.getTemplateDataModels());
-    command->setUseStoredData(this->command.getUseStoredData());
-    command->setUseUppercaseData(this->command.getUseUppercaseData());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
-    command->setSendAsJson(this->command.getSendAsJson());
+                                                              this->executor->isLoaded(), this->inGroup, this->compactView);
+
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -273,10 +255,7 @@ void RundownTemplateWidget::checkEmptyDevice()
 
 void RundownTemplateWidget::clearDelayedCommands()
 {
-    this->executeTimer.stop();
-    this->executePreviewTimer.stop();
-
-    this->loaded = false;
+    this->executor->clearDelayedCommands();
 }
 
 void RundownTemplateWidget::setUsed(bool used)
@@ -297,137 +276,7 @@ void RundownTemplateWidget::setUsed(bool used)
 
 bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
 {
-    if (type == Playout::PlayoutType::Stop)
-        executeStop();
-    else if (type == Playout::PlayoutType::Play && !this->command.getTriggerOnNext())
-    {
-        if (this->command.getDelay() < 0)
-            return true;
-
-        this->executeTimer.disconnect(); // Disconnect all events.
-        QObject::connect(&this->executeTimer, SIGNAL(timeout()), SLOT(executePlay()));
-
-        if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-        {
-            if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
-            {
-                const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(this->model.getDeviceName()).getChannelFormats().split(",");
-                if (this->command.getChannel() > channelFormats.count())
-                    return true;
-
-                double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
-
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
-
-                if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                     QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
-            }
-            else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
-            {
-                this->executeTimer.setInterval(this->command.getDelay());
-
-                if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
-            }
-
-            this->executeTimer.start();
-        }
-    }
-    else if (type == Playout::PlayoutType::PlayNow)
-        executePlay();
-    else if (type == Playout::PlayoutType::Update)
-    {
-        if (this->command.getDelay() < 0)
-            return true;
-
-        this->executeTimer.disconnect(); // Disconnect all events.
-        QObject::connect(&this->executeTimer, SIGNAL(timeout()), SLOT(executeUpdate()));
-
-        if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-        {
-            if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
-            {
-                const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(this->model.getDeviceName()).getChannelFormats().split(",");
-                if (this->command.getChannel() > channelFormats.count())
-                    return true;
-
-                double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
-
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
-            }
-            else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
-            {
-                this->executeTimer.setInterval(this->command.getDelay());
-            }
-
-            this->executeTimer.start();
-        }
-    }
-    else if (type == Playout::PlayoutType::Load)
-        executeLoad();
-    else if (type == Playout::PlayoutType::Next)
-    {
-        if (this->command.getTriggerOnNext())
-            executePlay();
-        else
-            executeNext();
-    }
-    else if (type == Playout::PlayoutType::Invoke)
-        executeInvoke();
-    else if (type == Playout::PlayoutType::Clear)
-        executeClear();
-    else if (type == Playout::PlayoutType::ClearVideoLayer)
-        executeClearVideolayer();
-    else if (type == Playout::PlayoutType::ClearChannel)
-        executeClearChannel();
-    else if (type == Playout::PlayoutType::Preview)
-    {
-        if (this->command.getDelay() < 0)
-            return true;
-
-        this->executePreviewTimer.disconnect(); // Disconnect all events.
-        QObject::connect(&this->executePreviewTimer, SIGNAL(timeout()), SLOT(executePlayPreview()));
-
-        if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-        {
-            const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-            if (deviceModel == NULL)
-                return true;
-
-            if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
-            {
-                // Is preview channel valid?
-                const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(this->model.getDeviceName()).getChannelFormats().split(",");
-                if (deviceModel->getPreviewChannel() == 0 || deviceModel->getPreviewChannel() > channelFormats.count())
-                    return true;
-
-                double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[deviceModel->getPreviewChannel() - 1]).getFramesPerSecond().toDouble();
-
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executePreviewTimer.setInterval(startDelay);
-
-                if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStopPreview()));
-                }
-            }
-            else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
-            {
-                this->executePreviewTimer.setInterval(this->command.getDelay());
-
-                if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStopPreview()));
-            }
-
-            this->executePreviewTimer.start();
-        }
-    }
+    this->executor->execute(type);
 
     if (this->active)
         this->animation->start(1);
@@ -435,359 +284,10 @@ bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
     return true;
 }
 
-void RundownTemplateWidget::executeStop()
-{
-    this->executeTimer.stop();
-    this->executePreviewTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->stopTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-        // Stop preview channels item.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-            device->stopTemplate(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->stopTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-            // Stop preview channels item.
-            if (model.getPreviewChannel() > 0)
-                deviceShadow->stopTemplate(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-        }
-    }
-
-    this->loaded = false;
-}
-
-void RundownTemplateWidget::executeStopPreview()
-{
-    this->executePreviewTimer.stop();
-
-    const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-    if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-    {
-        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-        if (device != NULL && device->isConnected())
-            device->stopTemplate(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        if (model.getPreviewChannel() > 0)
-        {
-            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-                deviceShadow->stopTemplate(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-        }
-    }
-}
-
-void RundownTemplateWidget::executePlay()
+void RundownTemplateWidget::commandExecuted(Playout::PlayoutType type)
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-        {
-            device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-        }
-        else
-        {
-            if (this->command.getTemplateData().isEmpty())
-                device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName());
-            else
-                device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName(), this->command.getTemplateData());
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-            }
-            else
-            {
-                if (this->command.getTemplateData().isEmpty())
-                    deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName());
-                else
-                    deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName(), this->command.getTemplateData());
-            }
-        }
-    }
-
-    if (this->markUsedItems)
+    if (type == Playout::PlayoutType::Play && this->markUsedItems)
         setUsed(true);
-
-    this->loaded = false;
-}
-
-void RundownTemplateWidget::executePlayPreview()
-{
-    const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-    if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-    {
-        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-        if (device != NULL && device->isConnected())
-        {
-            if (this->command.getTemplateData().isEmpty())
-                device->playTemplate(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName());
-            else
-                device->playTemplate(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName(), this->command.getTemplateData());
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        if (model.getPreviewChannel() > 0)
-        {
-            const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-            {
-                if (this->command.getTemplateData().isEmpty())
-                    deviceShadow->playTemplate(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName());
-                else
-                    deviceShadow->playTemplate(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName(), this->command.getTemplateData());
-            }
-        }
-    }
-}
-
-void RundownTemplateWidget::executeLoad()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->command.getTemplateData().isEmpty())
-            device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                this->command.getTemplateName(), false);
-        else
-            device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                this->command.getTemplateName(), false, this->command.getTemplateData());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->command.getTemplateData().isEmpty())
-                deviceShadow->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                          this->command.getTemplateName(), false);
-            else
-                deviceShadow->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                          this->command.getTemplateName(), false, this->command.getTemplateData());
-        }
-    }
-
-    this->loaded = true;
-}
-
-void RundownTemplateWidget::executeNext()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->nextTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->nextTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-    }
-}
-
-void RundownTemplateWidget::executeUpdate()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->updateTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                               this->command.getFlashlayer(), this->command.getTemplateData());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->updateTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                                         this->command.getFlashlayer(), this->command.getTemplateData());
-        }
-    }
-}
-
-void RundownTemplateWidget::executeInvoke()
-{
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->invokeTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                               this->command.getFlashlayer(), this->command.getInvoke());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->invokeTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                                         this->command.getFlashlayer(), this->command.getInvoke());
-    }
-}
-
-void RundownTemplateWidget::executeClear()
-{
-    this->executeTimer.stop();
-    this->executePreviewTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->removeTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-        // Clear preview channels item.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-            device->removeTemplate(deviceModel->getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->removeTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-            // Clear preview channels item.
-            if (model.getPreviewChannel() > 0)
-                deviceShadow->removeTemplate(model.getPreviewChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-        }
-    }
-
-    this->loaded = false;
-}
-
-void RundownTemplateWidget::executeClearVideolayer()
-{
-    this->executeTimer.stop();
-    this->executePreviewTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-        // Clear preview channels videolayer.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-            device->clearVideolayer(deviceModel->getPreviewChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-            // Clear preview channels videolayer.
-            if (model.getPreviewChannel() > 0)
-                deviceShadow->clearVideolayer(model.getPreviewChannel(), this->command.getVideolayer());
-        }
-    }
-
-    this->loaded = false;
-}
-
-void RundownTemplateWidget::executeClearChannel()
-{
-    this->executeTimer.stop();
-    this->executePreviewTimer.stop();
-
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-
-        // Clear preview channel.
-        const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
-        if (deviceModel != NULL && deviceModel->getPreviewChannel() > 0)
-        {
-            device->clearChannel(deviceModel->getPreviewChannel());
-            device->clearMixerChannel(deviceModel->getPreviewChannel());
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-
-            // Clear preview channel.
-            if (model.getPreviewChannel() > 0)
-            {
-                deviceShadow->clearChannel(model.getPreviewChannel());
-                deviceShadow->clearMixerChannel(model.getPreviewChannel());
-            }
-        }
-    }
-
-
-    this->loaded = false;
 }
 
 void RundownTemplateWidget::channelChanged(int channel)
@@ -15,6 +15,7 @@
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
 #include "Commands/TemplateCommand.h"
+#include "Executors/TemplateCommandExecutor.h"
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Events/Inspector/TargetChangedEvent.h"
@@ -22,7 +23,6 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QString>
-#include <QtCore/QTimer>
 
 #include <QtGui/QDragEnterEvent>
 #include <QtGui/QDropEvent>
@@ -66,14 +66,13 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
 
     private:
         bool active;
-        bool loaded;
         bool inGroup;
         bool compactView;
         QString color;
         LibraryModel model;
         TemplateCommand command;
+        TemplateCommandExecutor* executor;
         ActiveAnimation* animation;
-        QString delayType;
         bool markUsedItems;
         bool selected = false;
 
@@ -89,26 +88,13 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
-        QTimer executePreviewTimer;
-
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
         void configureOscSubscriptions();
 
         Q_SLOT void channelChanged(int);
-        Q_SLOT void executeStop();
-        Q_SLOT void executePlay();
-        Q_SLOT void executeLoad();
-        Q_SLOT void executeNext();
-        Q_SLOT void executeUpdate();
-        Q_SLOT void executeInvoke();
-        Q_SLOT void executeClear();
-        Q_SLOT void executeClearVideolayer();
-        Q_SLOT void executeClearChannel();
-        Q_SLOT void executePlayPreview();
-        Q_SLOT void executeStopPreview();
+        Q_SLOT void commandExecuted(Playout::PlayoutType);
         Q_SLOT void videolayerChanged(int);
         Q_SLOT void delayChanged(int);
         Q_SLOT void flashlayerChanged(int);
@@ -1,6 +1,10 @@
 #include "RundownTreeBaseWidget.h"
 #include "RundownItemFactory.h"
+#include "RundownJournal.h"
 #include "RundownGroupWidget.h"
+#include "Library/LibraryItemMimeData.h"
+
+#include "Trace.h"
 
 #include "DatabaseManager.h"
 #include "EventManager.h"
@@ -13,8 +17,13 @@
 
 #include <iostream>
 
-#include <QtCore/QTime>
 #include <QtCore/QDebug>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTime>
+#include <QtCore/QXmlStreamReader>
+
+#include <QtConcurrent/QtConcurrentMap>
 
 #include <QtGui/QDrag>
 #include <QtGui/QPainter>
@@ -22,14 +31,114 @@
 
 #include <QtWidgets/QApplication>
 
+namespace
+{
+    // The text of every element directly below <items>, in order. Only the reader's tokenizer runs here, the
+    // tree is built by the workers.
+    bool splitItems(const QString& data, QStringList& elements)
+    {
+        QXmlStreamReader reader(data);
+
+        int depth = 0;
+        qint64 start = 0;
+        while (!reader.atEnd())
+        {
+            qint64 offset = reader.characterOffset();
+            reader.readNext();
+
+            if (reader.isStartElement())
+            {
+                if (depth == 0 && reader.name() != "items")
+                    return false;
+
+                if (++depth == 2)
+                    start = offset;
+            }
+            else if (reader.isEndElement())
+            {
+                if (depth-- == 2)
+                {
+                    QString element = data.mid(start, reader.characterOffset() - start).trimmed();
+                    if (!element.startsWith('<') || !element.endsWith('>'))
+                        return false;
+
+                    elements.append(element);
+                }
+            }
+        }
+
+        return !reader.hasError() && depth == 0;
+    }
+
+    struct ParsedItem
+    {
+        boost::property_tree::wptree pt;
+        QString error;
+    };
+
+    ParsedItem parseItem(const QString& data)
+    {
+        ParsedItem item;
+
+        try
+        {
+            std::wstringstream wstringstream;
+            wstringstream << data.toStdWString();
+
+            boost::property_tree::xml_parser::read_xml(wstringstream, item.pt);
+        }
+        catch (const boost::property_tree::xml_parser_error& error)
+        {
+            item.error = QString::fromLocal8Bit(error.what());
+        }
+
+        return item;
+    }
+
+    RundownItemMimeData::Item copyItem(AbstractRundownWidget* widget, bool expanded)
+    {
+        RundownItemMimeData::Item item;
+        item.model = *widget->getLibraryModel();
+        item.color = widget->getColor();
+        item.expanded = expanded;
+        item.command = widget->getCommand()->clone();
+
+        return item;
+    }
+}
+
 RundownTreeBaseWidget::RundownTreeBaseWidget(QWidget* parent)
-    : QTreeWidget(parent), compactView(false), theme(""), lock(false)
+    : QTreeWidget(parent), compactView(false), theme(""), lock(false), lastParseTime(0), lastCreateTime(0), storyIndexValid(false), applyingRepositoryChanges(false)
 {
     this->theme = DatabaseManager::getInstance().getConfigurationByName("Theme").getValue();
 
+    this->searchIndex = new RundownSearchIndex(this);
+    this->journal = new RundownJournal(this);
+
+    // Any edit outside of the repository updates makes the story id index stale.
+    QObject::connect(QTreeWidget::model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)), this, SLOT(invalidateStoryIndex()));
+    QObject::connect(QTreeWidget::model(), SIGNAL(rowsRemoved(const QModelIndex&, int, int)), this, SLOT(invalidateStoryIndex()));
+    QObject::connect(QTreeWidget::model(), SIGNAL(rowsMoved(const QModelIndex&, int, int, const QModelIndex&, int)), this, SLOT(invalidateStoryIndex()));
+    QObject::connect(QTreeWidget::model(), SIGNAL(modelReset()), this, SLOT(invalidateStoryIndex()));
+
     QObject::connect(&EventManager::getInstance(), SIGNAL(repositoryRundown(const RepositoryRundownEvent&)), this, SLOT(repositoryRundown(const RepositoryRundownEvent&)));
 }
 
+RundownJournal* RundownTreeBaseWidget::getJournal() const
+{
+    return this->journal;
+}
+
+int RundownTreeBaseWidget::getLastParseTime() const
+{
+    return this->lastParseTime;
+}
+
+int RundownTreeBaseWidget::getLastCreateTime() const
+{
+    return this->lastCreateTime;
+}
+
 bool RundownTreeBaseWidget::getCompactView() const
 {
     return this->compactView;
@@ -42,7 +151,15 @@ void RundownTreeBaseWidget::setCompactView(bool compactView)
 
 void RundownTreeBaseWidget::writeProperties(QTreeWidgetItem* item, QXmlStreamWriter* writer) const
 {
-    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+    QList<AbstractRundownWidget*> children;
+    for (int i = 0; i < item->childCount(); i++)
+        children.append(dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item->child(i), 0)));
+
+    writeItem(dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0)), item->isExpanded(), children, writer);
+}
+
+void RundownTreeBaseWidget::writeItem(AbstractRundownWidget* widget, bool expanded, const QList<AbstractRundownWidget*>& children, QXmlStreamWriter* writer)
+{
     if (widget->getLibraryModel()->getType() == "GROUP")
     {
         QString label = widget->getLibraryModel()->getLabel();
@@ -50,13 +167,13 @@ void RundownTreeBaseWidget::writeProperties(QTreeWidgetItem* item, QXmlStreamWri
         writer->writeStartElement("item");
         writer->writeTextElement("type", widget->getLibraryModel()->getType());
         writer->writeTextElement("label", label);
-        writer->writeTextElement("expanded", (item->isExpanded() == true ? "true" : "false"));
+        writer->writeTextElement("expanded", (expanded == true ? "true" : "false"));
         widget->getCommand()->writeProperties(writer);
         widget->writeProperties(writer);
 
         writer->writeStartElement("items");
-        for (int i = 0; i < item->childCount(); i++)
-            writeProperties(item->child(i), writer);
+        foreach (AbstractRundownWidget* child, children)
+            writeItem(child, false, QList<AbstractRundownWidget*>(), writer);
 
         writer->writeEndElement();
         writer->writeEndElement();
@@ -113,22 +230,47 @@ AbstractRundownWidget* RundownTreeBaseWidget::readProperties(boost::property_tre
     return widget;
 }
 
-bool RundownTreeBaseWidget::copySelectedItems() const
+AbstractRundownWidget* RundownTreeBaseWidget::createWidget(const RundownItemMimeData::Item& item)
 {
-    QString data;
-    QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
+    AbstractRundownWidget* widget = NULL;
+    if (item.model.getType() == "GROUP")
+    {
+        widget = new RundownGroupWidget(item.model, this);
+        widget->setExpanded(true);
+    }
+    else
+        widget = RundownItemFactory::getInstance().createWidget(item.model);
+
+    widget->setCompactView(this->compactView);
+    widget->getCommand()->copyProperties(item.command);
+    widget->setColor(item.color);
+
+    if (this->compactView)
+        dynamic_cast<QWidget*>(widget)->setFixedHeight(Rundown::COMPACT_ITEM_HEIGHT);
+    else
+        dynamic_cast<QWidget*>(widget)->setFixedHeight(Rundown::DEFAULT_ITEM_HEIGHT);
 
-    writer->writeStartDocument();
-    writer->writeStartElement("items");
-    for (int i = 0; i < QTreeWidget::selectedItems().count(); i++)
-        writeProperties(QTreeWidget::selectedItems().at(i), writer);
+    return widget;
+}
 
-    writer->writeEndElement();
-    writer->writeEndDocument();
+RundownItemMimeData* RundownTreeBaseWidget::createItemData() const
+{
+    // Only the commands are copied, the widgets are built again wherever the items end up.
+    QList<RundownItemMimeData::Item> items;
+    foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
+    {
+        items.append(copyItem(dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0)), item->isExpanded()));
+        for (int i = 0; i < item->childCount(); i++)
+            items.last().children.append(copyItem(dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item->child(i), 0)), false));
+    }
 
-    qApp->clipboard()->setText(data);
+    return new RundownItemMimeData(items, this);
+}
 
-    delete writer;
+bool RundownTreeBaseWidget::copySelectedItems() const
+{
+    // The clipboard takes ownership.
+    qApp->clipboard()->setMimeData(createItemData());
 
     return true;
 }
@@ -156,7 +298,11 @@ bool RundownTreeBaseWidget::pasteItemProperties()
         {
             AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
             if (widget->getLibraryModel()->getType() == type)
+            {
                 widget->getCommand()->readProperties(parentValue.second);
+                this->searchIndex->invalidate(item);
+                this->journal->itemChanged(item);
+            }
         }
     }
 
@@ -164,16 +310,76 @@ bool RundownTreeBaseWidget::pasteItemProperties()
 }
 
 bool RundownTreeBaseWidget::pasteSelectedItems(bool repositoryRundown)
+{
+    const RundownItemMimeData* data = qobject_cast<const RundownItemMimeData*>(qApp->clipboard()->mimeData());
+    if (data != NULL)
+        return pasteItems(data, repositoryRundown);
+
+    return pasteItems(qApp->clipboard()->text(), repositoryRundown);
+}
+
+bool RundownTreeBaseWidget::pasteItems(const QString& data, bool repositoryRundown)
 {
     QTime time;
     time.start();
 
-    std::wstringstream wstringstream;
-    wstringstream << qApp->clipboard()->text().toStdWString();
+    boost::property_tree::wptree pt;
+
+    // Items need no widgets until they are inserted, so they are parsed on the thread pool and put back in order.
+    QStringList elements;
+    if (splitItems(data, elements))
+    {
+        QList<ParsedItem> trees = QtConcurrent::blockingMapped(elements, parseItem);
+
+        // Insert nothing rather than a rundown with holes in it.
+        for (int i = 0; i < trees.count(); i++)
+        {
+            if (!trees[i].error.isEmpty())
+            {
+                qWarning("Unable to parse rundown element %d: %s", i + 1, qPrintable(trees[i].error));
+                return false;
+            }
+        }
+
+        boost::property_tree::wptree& items = pt.put_child(L"items", boost::property_tree::wptree());
+        for (int i = 0; i < trees.count(); i++)
+        {
+            BOOST_FOREACH(boost::property_tree::wptree::value_type& value, trees[i].pt)
+                items.push_back(std::make_pair(value.first, boost::property_tree::wptree()))->second.swap(value.second);
+        }
+
+        qDebug("Parsed %d rundown elements on %d threads in %d msec", elements.count(), QThreadPool::globalInstance()->maxThreadCount(), time.elapsed());
+    }
+    else
+    {
+        try
+        {
+            std::wstringstream wstringstream;
+            wstringstream << data.toStdWString();
+
+            boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+        }
+        catch (const boost::property_tree::xml_parser_error& error)
+        {
+            qWarning("Unable to parse rundown: %s", error.what());
+            return false;
+        }
+    }
+
+    this->lastParseTime = time.elapsed();
+
+    return pasteItems(pt, repositoryRundown);
+}
+
+bool RundownTreeBaseWidget::pasteItems(boost::property_tree::wptree& pt, bool repositoryRundown)
+{
+    TRACE_FUNCTION("rundown");
+
+    QTime time;
+    time.start();
 
     int offset = 1; // Drop offset.
-    boost::property_tree::wptree pt;
-    boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+    int count = 0;
 
     if (pt.get_child(L"items").count(L"allowremotetriggering") > 0)
     {
@@ -190,76 +396,180 @@ bool RundownTreeBaseWidget::pasteSelectedItems(bool repositoryRundown)
 
         AbstractRundownWidget* parentWidget = readProperties(parentValue.second);
 
-        int row  = QTreeWidget::currentIndex().row();
-
-        QTreeWidgetItem* parentItem = new QTreeWidgetItem();
-        if (QTreeWidget::currentItem() == NULL || QTreeWidget::currentItem()->parent() == NULL) // Top level item.
+        bool expanded = false;
+        QList<AbstractRundownWidget*> children;
+        if (parentWidget->isGroup())
         {
-            parentWidget->setInGroup(false);
-            parentWidget->setExpanded(false);
-
-            // If we don't have a selected row then we add the item to the bottom of the
-            // rundown. This can be the case when we drag and drop a preset to the rundown.
-            if (row != -1)
-                QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
-            else
-                QTreeWidget::invisibleRootItem()->addChild(parentItem);
+            expanded = parentValue.second.get(L"expanded", false);
+
+            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
+                children.append(readProperties(childValue.second));
         }
-        else
-        {
-            if (parentWidget->isGroup())
-                continue; // We don't support group in groups.
 
-            parentWidget->setInGroup(true);
+        insertItem(parentWidget, expanded, children, offset);
+        count += 1 + children.count();
+    }
 
-            QTreeWidget::currentItem()->parent()->insertChild(row + offset++, parentItem);
-        }
+    checkEmptyRundown();
 
-        QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
-        //QTreeWidget::setCurrentItem(parentItem);
+    this->lastCreateTime = time.elapsed();
+
+    qDebug("Created %d rundown items in %d msec", count, time.elapsed());
+
+    return true;
+}
 
+bool RundownTreeBaseWidget::pasteItems(const RundownItemMimeData* data, bool repositoryRundown)
+{
+    TRACE_FUNCTION("rundown");
+
+    if (data->getItems().isEmpty())
+        return false;
+
+    QTime time;
+    time.start();
+
+    int offset = 1; // Drop offset.
+    int count = 0;
+
+    EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
+
+    // Every paste copies the commands again, the same items can be pasted any number of times.
+    foreach (const RundownItemMimeData::Item& item, data->getItems())
+    {
+        AbstractRundownWidget* parentWidget = createWidget(item);
+
+        QList<AbstractRundownWidget*> children;
         if (parentWidget->isGroup())
         {
-            bool expanded = parentValue.second.get(L"expanded", false);
-            parentItem->setExpanded(expanded);
-            parentWidget->setExpanded(expanded);
+            foreach (const RundownItemMimeData::Item& child, item.children)
+                children.append(createWidget(child));
+        }
 
-            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
-            {
-                AbstractRundownWidget* childWidget = readProperties(childValue.second);
-                childWidget->setInGroup(true);
+        insertItem(parentWidget, item.expanded, children, offset);
+        count += 1 + children.count();
+    }
 
-                QTreeWidgetItem* childItem = new QTreeWidgetItem();
-                parentItem->addChild(childItem);
+    checkEmptyRundown();
 
-                QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
-            }
+    this->lastCreateTime = time.elapsed();
+
+    qDebug("Created %d rundown items in %d msec", count, time.elapsed());
+
+    return true;
+}
+
+void RundownTreeBaseWidget::insertItems(boost::property_tree::wptree& pt, int row)
+{
+    BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
+    {
+        if (parentValue.first != L"item")
+            continue;
+
+        AbstractRundownWidget* parentWidget = readProperties(parentValue.second);
+        parentWidget->setInGroup(false);
+        parentWidget->setExpanded(false);
+
+        bool expanded = false;
+        QList<AbstractRundownWidget*> children;
+        if (parentWidget->isGroup())
+        {
+            expanded = parentValue.second.get(L"expanded", false);
+
+            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
+                children.append(readProperties(childValue.second));
         }
 
-        QTreeWidget::doItemsLayout(); // Refresh
-        QTreeWidget::repaint();
+        QTreeWidgetItem* parentItem = new QTreeWidgetItem();
+        QTreeWidget::invisibleRootItem()->insertChild(qMin(row++, QTreeWidget::invisibleRootItem()->childCount()), parentItem);
+
+        setupItem(parentItem, parentWidget, expanded, children);
     }
 
     checkEmptyRundown();
+}
 
-    return true;
+void RundownTreeBaseWidget::replaceItem(QTreeWidgetItem* item, boost::property_tree::wptree& pt)
+{
+    AbstractRundownWidget* widget = readProperties(pt);
+    widget->setInGroup(item->parent() != NULL);
+    widget->setExpanded(item->isExpanded());
+
+    // The item keeps its place and its children, the view deletes the old widget.
+    QTreeWidget::setItemWidget(item, 0, dynamic_cast<QWidget*>(widget));
+
+    this->searchIndex->invalidate(item);
 }
 
-bool RundownTreeBaseWidget::duplicateSelectedItems()
+void RundownTreeBaseWidget::insertItem(AbstractRundownWidget* parentWidget, bool expanded, const QList<AbstractRundownWidget*>& children, int& offset)
+{
+    int row  = QTreeWidget::currentIndex().row();
+
+    QTreeWidgetItem* parentItem = new QTreeWidgetItem();
+    if (QTreeWidget::currentItem() == NULL || QTreeWidget::currentItem()->parent() == NULL) // Top level item.
+    {
+        parentWidget->setInGroup(false);
+        parentWidget->setExpanded(false);
+
+        // If we don't have a selected row then we add the item to the bottom of the
+        // rundown. This can be the case when we drag and drop a preset to the rundown.
+        if (row != -1)
+            QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
+        else
+            QTreeWidget::invisibleRootItem()->addChild(parentItem);
+    }
+    else
+    {
+        if (parentWidget->isGroup())
+        {
+            // We don't support group in groups.
+            foreach (AbstractRundownWidget* child, children)
+                delete dynamic_cast<QWidget*>(child);
+
+            delete dynamic_cast<QWidget*>(parentWidget);
+            delete parentItem;
+
+            return;
+        }
+
+        parentWidget->setInGroup(true);
+
+        QTreeWidget::currentItem()->parent()->insertChild(row + offset++, parentItem);
+    }
+
+    setupItem(parentItem, parentWidget, expanded, children);
+}
+
+void RundownTreeBaseWidget::setupItem(QTreeWidgetItem* parentItem, AbstractRundownWidget* parentWidget, bool expanded, const QList<AbstractRundownWidget*>& children)
 {
-    // Save the latest value stored in the clipboard.
-    QString latest = qApp->clipboard()->text();
+    QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
+
+    if (parentWidget->isGroup())
+    {
+        parentItem->setExpanded(expanded);
+        parentWidget->setExpanded(expanded);
 
-    if (!copySelectedItems())
-        return true;
+        foreach (AbstractRundownWidget* childWidget, children)
+        {
+            childWidget->setInGroup(true);
 
-    if (!pasteSelectedItems())
-        return true;
+            QTreeWidgetItem* childItem = new QTreeWidgetItem();
+            parentItem->addChild(childItem);
 
-    // Set previous stored clipboard value.
-    qApp->clipboard()->setText(latest);
+            QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
+        }
+    }
 
-    return true;
+    QTreeWidget::doItemsLayout(); // Refresh
+    QTreeWidget::repaint();
+}
+
+bool RundownTreeBaseWidget::duplicateSelectedItems()
+{
+    // Straight from the selected widgets, whatever is on the clipboard stays there.
+    QScopedPointer<RundownItemMimeData> data(createItemData());
+
+    return pasteItems(data.data());
 }
 
 void RundownTreeBaseWidget::checkEmptyRundown()
@@ -273,72 +583,58 @@ void RundownTreeBaseWidget::checkEmptyRundown()
 void RundownTreeBaseWidget::removeSelectedItems()
 {
     foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
-    {
-        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->isGroup())
-        {
-            for (int i = item->childCount() - 1; i >= 0; i--)
-            {
-                QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
-
-                // Remove our items from the auto play queue if it exists.
-                EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
-
-                // Clear current playing item.
-                EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
+        removeItem(item);
 
-                delete childWidget;
-                delete item->child(i);
-            }
-        }
+    checkEmptyRundown();
+}
 
-        // Remove our items from the AutoPlay queue if it exists.
-        EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
+void RundownTreeBaseWidget::removeAllItems()
+{
+    for (int i = QTreeWidget::invisibleRootItem()->childCount() - 1; i >= 0; i--)
+        removeItem(QTreeWidget::invisibleRootItem()->child(i));
 
-        // Clear current playing item.
-        EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
+    checkEmptyRundown();
+}
 
-        delete widget;
-        delete item;
+void RundownTreeBaseWidget::removeItems(int row, int count)
+{
+    for (int i = row + count - 1; i >= row; i--)
+    {
+        if (i < QTreeWidget::invisibleRootItem()->childCount())
+            removeItem(QTreeWidget::invisibleRootItem()->child(i));
     }
 
     checkEmptyRundown();
 }
 
-void RundownTreeBaseWidget::removeAllItems()
+void RundownTreeBaseWidget::removeItem(QTreeWidgetItem* item)
 {
-    for (int i = QTreeWidget::invisibleRootItem()->childCount() - 1; i >= 0; i--)
+    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+    if (widget->isGroup())
     {
-        QTreeWidgetItem* item = QTreeWidget::invisibleRootItem()->child(i);
-        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->isGroup())
+        for (int i = item->childCount() - 1; i >= 0; i--)
         {
-            for (int i = item->childCount() - 1; i >= 0; i--)
-            {
-                QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
+            QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
 
-                // Remove our items from the auto play queue if it exists.
-                EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
+            // Remove our items from the auto play queue if it exists.
+            EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
 
-                // Clear current playing item.
-                EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
+            // Clear current playing item.
+            EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
 
-                delete childWidget;
-                delete item->child(i);
-            }
+            delete childWidget;
+            delete item->child(i);
         }
+    }
 
-        // Remove our items from the auto play queue if it exists.
-        EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
-
-        // Clear current playing item.
-        EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
+    // Remove our items from the auto play queue if it exists.
+    EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
 
-        delete widget;
-        delete item;
-    }
+    // Clear current playing item.
+    EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
 
-    checkEmptyRundown();
+    delete widget;
+    delete item;
 }
 
 void RundownTreeBaseWidget::groupItems()
@@ -754,6 +1050,36 @@ void RundownTreeBaseWidget::setExpanded(bool expanded)
         rundownWidget->setExpanded(expanded);
 }
 
+void RundownTreeBaseWidget::buildSearchIndex()
+{
+    this->searchIndex->build();
+}
+
+QList<QTreeWidgetItem*> RundownTreeBaseWidget::searchItems(const QString& query)
+{
+    return this->searchIndex->search(query);
+}
+
+void RundownTreeBaseWidget::jumpToItem(QTreeWidgetItem* item)
+{
+    if (item == NULL)
+        return;
+
+    // Only the collapsed group is expanded, the rest of the rundown keeps its layout.
+    QTreeWidgetItem* parentItem = item->parent();
+    if (parentItem != NULL && !parentItem->isExpanded())
+    {
+        AbstractRundownWidget* parentWidget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(parentItem, 0));
+        if (parentWidget != NULL)
+            parentWidget->setExpanded(true);
+
+        parentItem->setExpanded(true);
+    }
+
+    QTreeWidget::setCurrentItem(item);
+    QTreeWidget::scrollToItem(item, QAbstractItemView::PositionAtCenter);
+}
+
 void RundownTreeBaseWidget::keyPressEvent(QKeyEvent* event)
 {
     if (this->lock)
@@ -786,6 +1112,11 @@ void RundownTreeBaseWidget::keyPressEvent(QKeyEvent* event)
             groupItems();
         else if (event->key() == Qt::Key_U && event->modifiers() == Qt::ControlModifier)
             ungroupItems();
+        else if (event->key() == Qt::Key_Z && event->modifiers() == Qt::ControlModifier)
+            this->journal->undo();
+        else if ((event->key() == Qt::Key_Y && event->modifiers() == Qt::ControlModifier) ||
+                 (event->key() == Qt::Key_Z && event->modifiers() == (Qt::ControlModifier | Qt::ShiftModifier)))
+            this->journal->redo();
         else if (event->key() == Qt::Key_X && event->modifiers() == Qt::ControlModifier)
         {
             copySelectedItems();
@@ -831,14 +1162,8 @@ void RundownTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
     if ((event->pos() - dragStartPosition).manhattanLength() < qApp->startDragDistance())
          return;
 
-    if (!copySelectedItems())
-        return;
-
-    QMimeData* mimeData = new QMimeData();
-    mimeData->setData("application/rundown-item", qApp->clipboard()->text().toUtf8());
-
     QDrag* drag = new QDrag(this);
-    drag->setMimeData(mimeData);
+    drag->setMimeData(createItemData());
 
     drag->exec(Qt::CopyAction);
 }
@@ -870,7 +1195,15 @@ bool RundownTreeBaseWidget::dropMimeData(QTreeWidgetItem* parent, int index, con
     if (!mimeData->hasFormat("application/library-item") && !mimeData->hasFormat("application/rundown-item"))
         return false;
 
-    if (mimeData->hasFormat("application/library-item"))
+    const LibraryItemMimeData* libraryData = qobject_cast<const LibraryItemMimeData*>(mimeData);
+    if (libraryData != NULL) // Drop from the library in this client, no need to go through the text.
+    {
+        QTreeWidget::setCurrentItem(parent);
+
+        foreach (const LibraryModel& model, libraryData->getModels())
+            EventManager::getInstance().fireAddRudnownItemEvent(model);
+    }
+    else if (mimeData->hasFormat("application/library-item"))
     {
         QString dndData = QString::fromUtf8(mimeData->data("application/library-item"));
         if (dndData.startsWith("<treeWidgetVideo>") ||
@@ -895,52 +1228,47 @@ bool RundownTreeBaseWidget::dropMimeData(QTreeWidgetItem* parent, int index, con
             QTreeWidget::setCurrentItem(parent);
 
             QStringList dataSplit = dndData.split(",,");
-            EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(dataSplit.at(3)));
+            EventManager::getInstance().fireAddPresetItemEvent(AddPresetItemEvent(dataSplit.at(2).toInt()));
         }
     }
     else if (mimeData->hasFormat("application/rundown-item"))
     {
-        QString dndData = QString::fromUtf8(mimeData->data("application/rundown-item"));
-        if (dndData.contains("<items>")) // Internal drop
+        // Items dragged within this rundown are moved, items from another rundown are copied.
+        const RundownItemMimeData* itemData = qobject_cast<const RundownItemMimeData*>(mimeData);
+        if (itemData != NULL && itemData->getSource() != this)
+        {
+            QTreeWidget::setCurrentItem(parent);
+
+            if (!pasteItems(itemData))
+                return false;
+
+            selectItemBelow();
+        }
+        else if (itemData != NULL) // Internal drop
         {
             QList<QTreeWidgetItem*> items = QTreeWidget::selectedItems();
 
             QTreeWidget::setCurrentItem(parent);
 
-            if (!pasteSelectedItems())
+            if (!pasteItems(itemData))
                 return false;
 
             selectItemBelow();
 
             for (int i = items.count() - 1; i >= 0; i--)
+                removeItem(items.at(i));
+        }
+        else
+        {
+            QString dndData = QString::fromUtf8(mimeData->data("application/rundown-item"));
+            if (dndData.contains("<items>")) // External drop
             {
-                QTreeWidgetItem* item = items.at(i);
-                AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-                if (widget->isGroup())
-                {
-                    for (int i = item->childCount() - 1; i >= 0; i--)
-                    {
-                        QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
-
-                        // Remove our items from the auto play queue if it exists.
-                        EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
+                QTreeWidget::setCurrentItem(parent);
 
-                        // Clear current playing item.
-                        EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
+                if (!pasteItems(dndData))
+                    return false;
 
-                        delete childWidget;
-                        delete item->child(i);
-                    }
-                }
-
-                // Remove our items from the auto play queue if it exists.
-                EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
-
-                // Clear current playing item.
-                EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
-
-                delete widget;
-                delete item;
+                selectItemBelow();
             }
         }
     }
@@ -1024,26 +1352,38 @@ void RundownTreeBaseWidget::applyRepositoryChanges()
     // Get the current selected item story id.
     QString currentStoryId = currentItemStoryId();
 
+    if (!this->storyIndexValid)
+        buildStoryIndex();
+
+    this->applyingRepositoryChanges = true;
+
     int index = 0;
     while (index < this->repositoryChanges.count())
     {
-        const RepositoryChangeModel& model = this->repositoryChanges.at(index);
+        QSharedPointer<RepositoryChange> change = this->repositoryChanges.at(index);
 
         // Skip update if ADD or REMOVE contians the current selected item story id.
-        if ((model.getType() == "REMOVE" && model.getStoryId() == currentStoryId) || (model.getType() == "ADD" && containsStoryId(currentStoryId, model.getData())))
+        if ((change->getType() == "REMOVE" && change->getStoryId() == currentStoryId) || (change->getType() == "ADD" && change->containsStoryId(currentStoryId)))
         {
             index++;
             continue;
         }
 
-        if (model.getType() == "ADD")
-            addRepositoryItem(model.getStoryId(), model.getData());
+        if (change->getType() == "ADD")
+        {
+            foreach (const QString& storyId, change->getStoryIds())
+                this->pendingStoryIds.remove(storyId, change);
+
+            addRepositoryItem(*change);
+        }
         else
-            removeRepositoryItem(model.getStoryId());
+            removeRepositoryItem(change->getStoryId());
 
         this->repositoryChanges.removeAt(index);
     }
 
+    this->applyingRepositoryChanges = false;
+
     // Do we have updates which we can nott apply?
     if (this->repositoryChanges.count() > 0)
         checRepositoryChanges();
@@ -1069,33 +1409,65 @@ QString RundownTreeBaseWidget::currentItemStoryId()
     return currentStoryId;
 }
 
-bool RundownTreeBaseWidget::containsStoryId(const QString& storyId, const QString& data)
+void RundownTreeBaseWidget::buildStoryIndex()
 {
-    if (!data.isEmpty())
+    this->storyIndex.clear();
+
+    for (int i = 0; i < QTreeWidget::topLevelItemCount(); i++)
     {
-        std::wstringstream wstringstream;
-        wstringstream << data.toStdWString();
+        QTreeWidgetItem* item = QTreeWidget::topLevelItem(i);
+        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+        if (widget == NULL || widget->getCommand()->getStoryId().isEmpty())
+            continue;
 
-        boost::property_tree::wptree pt;
-        boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+        this->storyIndex[widget->getCommand()->getStoryId()].append(item);
+    }
+
+    this->storyIndexValid = true;
+}
+
+void RundownTreeBaseWidget::invalidateStoryIndex()
+{
+    if (this->applyingRepositoryChanges)
+        return; // The index is kept up to date while applying changes.
 
-        BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
+    this->storyIndexValid = false;
+}
+
+void RundownTreeBaseWidget::addRepositoryChange(const QSharedPointer<RepositoryChange>& change)
+{
+    if (change->getType() == "REMOVE")
+    {
+        // Drop the story from pending ADDs, an ADD followed by a REMOVE cancels out.
+        QList<QSharedPointer<RepositoryChange>> pendingChanges = this->pendingStoryIds.values(change->getStoryId());
+        if (!pendingChanges.isEmpty())
         {
-            if (parentValue.second.count(L"storyid") > 0)
+            this->pendingStoryIds.remove(change->getStoryId());
+
+            foreach (const QSharedPointer<RepositoryChange>& pendingChange, pendingChanges)
             {
-                QString storyid = QString::fromStdWString(parentValue.second.get(L"storyid", L""));
-                if (storyid == storyId)
-                    return true;
+                pendingChange->removeStoryId(change->getStoryId());
+                if (pendingChange->isEmpty())
+                    this->repositoryChanges.removeOne(pendingChange);
             }
+
+            if (!this->storyIndexValid)
+                buildStoryIndex();
+
+            if (!this->storyIndex.contains(change->getStoryId()))
+                return; // The story never reached the rundown.
         }
     }
+    else
+    {
+        if (change->isEmpty())
+            return;
 
-    return false;
-}
+        foreach (const QString& storyId, change->getStoryIds())
+            this->pendingStoryIds.insert(storyId, change);
+    }
 
-void RundownTreeBaseWidget::addRepositoryChange(const RepositoryChangeModel& model)
-{
-    this->repositoryChanges.append(model);
+    this->repositoryChanges.append(change);
 }
 
 void RundownTreeBaseWidget::checRepositoryChanges()
@@ -1106,29 +1478,15 @@ void RundownTreeBaseWidget::checRepositoryChanges()
         QTreeWidget::setStyleSheet((this->repositoryChanges.count() > 0) ? "#treeWidgetRundown { border-width: 1; border-color: darkorange; }" : "#treeWidgetRundown { border-width: 0; border-top-width: 1; }");
 }
 
-void RundownTreeBaseWidget::addRepositoryItem(const QString& storyId, const QString& data)
+void RundownTreeBaseWidget::addRepositoryItem(RepositoryChange& change)
 {
+    // Insert after the last item of the story.
     int row = -1;
-
-    for (int i = QTreeWidget::topLevelItemCount() - 1; i >= 0; i--)
-    {
-        QTreeWidgetItem* item = QTreeWidget::topLevelItem(i);
-        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->getCommand()->getStoryId() == storyId)
-        {
-            row = QTreeWidget::indexFromItem(item).row();
-            break; // We have found the last story id in the rundown.
-        }
-    }
+    foreach (QTreeWidgetItem* item, this->storyIndex.value(change.getStoryId()))
+        row = qMax(row, QTreeWidget::indexOfTopLevelItem(item));
 
     int offset = 1;
-    std::wstringstream wstringstream;
-    wstringstream << data.toStdWString();
-
-    boost::property_tree::wptree pt;
-    boost::property_tree::xml_parser::read_xml(wstringstream, pt);
-
-    BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
+    BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, change.getItems())
     {
         if (parentValue.first != L"item")
             continue;
@@ -1142,6 +1500,9 @@ void RundownTreeBaseWidget::addRepositoryItem(const QString& storyId, const QStr
         QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
         QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
 
+        if (!parentWidget->getCommand()->getStoryId().isEmpty())
+            this->storyIndex[parentWidget->getCommand()->getStoryId()].append(parentItem);
+
         if (parentWidget->isGroup())
         {
             BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
@@ -1163,37 +1524,34 @@ void RundownTreeBaseWidget::addRepositoryItem(const QString& storyId, const QStr
 
 void RundownTreeBaseWidget::removeRepositoryItem(const QString& storyId)
 {
-    for (int i = QTreeWidget::topLevelItemCount() - 1; i >= 0; i--)
+    foreach (QTreeWidgetItem* item, this->storyIndex.take(storyId))
     {
-        QTreeWidgetItem* item = QTreeWidget::topLevelItem(i);
         AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->getCommand()->getStoryId() == storyId)
+
+        if (widget->isGroup())
         {
-            if (widget->isGroup())
+            for (int i = item->childCount() - 1; i >= 0; i--)
             {
-                for (int i = item->childCount() - 1; i >= 0; i--)
-                {
-                    QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
+                QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
 
-                    // Remove our items from the AutoPlay queue if it exists.
-                    EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
+                // Remove our items from the AutoPlay queue if it exists.
+                EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
 
-                    // Clear current playing item.
-                    EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
+                // Clear current playing item.
+                EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
 
-                    delete childWidget;
-                    delete item->child(i);
-                }
+                delete childWidget;
+                delete item->child(i);
             }
+        }
 
-            // Remove our items from the auto play queue if it exists.
-            EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
+        // Remove our items from the auto play queue if it exists.
+        EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
 
-            // Clear current playing item.
-            EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
+        // Clear current playing item.
+        EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
 
-            delete widget;
-            delete item;
-        }
+        delete widget;
+        delete item;
     }
 }
@@ -2,21 +2,25 @@
 
 #include "../Shared.h"
 #include "AbstractRundownWidget.h"
+#include "RepositoryChange.h"
+#include "RundownItemMimeData.h"
+#include "RundownSearchIndex.h"
 
 #include "Global.h"
 
 #include "OscSubscription.h"
 #include "Events/AddPresetItemEvent.h"
 #include "Events/Rundown/RepositoryRundownEvent.h"
-#include "Models/RepositoryChangeModel.h"
 
 #include <boost/foreach.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
+#include <QtCore/QHash>
 #include <QtCore/QModelIndexList>
 #include <QtCore/QMimeData>
 #include <QtCore/QRect>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QXmlStreamWriter>
 
 #include <QtGui/QDragEnterEvent>
@@ -29,6 +33,8 @@
 #include <QtWidgets/QTreeWidgetItem>
 #include <QtWidgets/QWidget>
 
+class RundownJournal;
+
 class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
 {
     Q_OBJECT
@@ -36,6 +42,11 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
     public:
         explicit RundownTreeBaseWidget(QWidget* parent = 0);
 
+        RundownJournal* getJournal() const;
+
+        int getLastParseTime() const;
+        int getLastCreateTime() const;
+
         bool getCompactView() const;
         void setCompactView(bool compactView);
 
@@ -46,6 +57,13 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         AbstractRundownWidget* readProperties(boost::property_tree::wptree& pt);
         void writeProperties(QTreeWidgetItem* item, QXmlStreamWriter* writer) const;
 
+        static void writeItem(AbstractRundownWidget* widget, bool expanded, const QList<AbstractRundownWidget*>& children, QXmlStreamWriter* writer);
+
+        RundownItemMimeData* createItemData() const;
+
+        bool pasteItems(const QString& data, bool repositoryRundown = false);
+        bool pasteItems(boost::property_tree::wptree& pt, bool repositoryRundown = false);
+        bool pasteItems(const RundownItemMimeData* data, bool repositoryRundown = false);
         bool pasteSelectedItems(bool repositoryRundown = false);
         bool pasteItemProperties();
         bool duplicateSelectedItems();
@@ -60,15 +78,22 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         void ungroupItems();
         void removeSelectedItems();
         void removeAllItems();
+        void removeItems(int row, int count);
+        void insertItems(boost::property_tree::wptree& pt, int row);
+        void replaceItem(QTreeWidgetItem* item, boost::property_tree::wptree& pt);
         void selectItemAbove();
         void selectItemBelow();
         void checkEmptyRundown();
         void checRepositoryChanges();
         void applyRepositoryChanges();
         void copyItemProperties() const;
-        void addRepositoryChange(const RepositoryChangeModel& model);
+        void addRepositoryChange(const QSharedPointer<RepositoryChange>& change);
         void setExpanded(bool expanded);
 
+        void buildSearchIndex();
+        QList<QTreeWidgetItem*> searchItems(const QString& query);
+        void jumpToItem(QTreeWidgetItem* item);
+
         virtual bool dropMimeData(QTreeWidgetItem* parent, int index, const QMimeData* data, Qt::DropAction action);
 
     protected:
@@ -80,14 +105,29 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         bool compactView;
         QString theme;
         bool lock;
+        int lastParseTime;
+        int lastCreateTime;
 
         QPoint dragStartPosition;
-        QList<RepositoryChangeModel> repositoryChanges;
+        QList<QSharedPointer<RepositoryChange>> repositoryChanges;
+        QMultiHash<QString, QSharedPointer<RepositoryChange>> pendingStoryIds;
+
+        bool storyIndexValid;
+        bool applyingRepositoryChanges;
+        QHash<QString, QList<QTreeWidgetItem*>> storyIndex;
+
+        RundownSearchIndex* searchIndex;
+        RundownJournal* journal;
 
         QString currentItemStoryId();
+        void buildStoryIndex();
         void removeRepositoryItem(const QString& storyId);
-        bool containsStoryId(const QString& storyId, const QString& data);
-        void addRepositoryItem(const QString& storyId, const QString& data);
+        void addRepositoryItem(RepositoryChange& change);
+        AbstractRundownWidget* createWidget(const RundownItemMimeData::Item& item);
+        void insertItem(AbstractRundownWidget* widget, bool expanded, const QList<AbstractRundownWidget*>& children, int& offset);
+        void setupItem(QTreeWidgetItem* item, AbstractRundownWidget* widget, bool expanded, const QList<AbstractRundownWidget*>& children);
+        void removeItem(QTreeWidgetItem* item);
 
+        Q_SLOT void invalidateStoryIndex();
         Q_SLOT void repositoryRundown(const RepositoryRundownEvent&);
 };
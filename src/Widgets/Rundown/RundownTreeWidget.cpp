@@ -25,12 +25,17 @@
 #include "RundownAudioWidget.h"
 #include "RundownStillWidget.h"
 #include "RundownItemFactory.h"
+#include "RundownItemMimeData.h"
+#include "RundownJournal.h"
 #include "PresetDialog.h"
 
+#include "Trace.h"
+
 #include "GpiManager.h"
 #include "DatabaseManager.h"
 #include "EventManager.h"
 #include "DeviceManager.h"
+#include "PresetManager.h"
 #include "Events/PresetChangedEvent.h"
 #include "Events/StatusbarEvent.h"
 #include "Events/Rundown/ActiveRundownChangedEvent.h"
@@ -48,7 +53,8 @@
 #include <QtCore/QTextCodec>
 #include <QtCore/QTime>
 #include <QtCore/QTextStream>
-#include <QtCore/QCryptographicHash>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QScopedPointer>
 
 #include <QtGui/QClipboard>
 #include <QtGui/QIcon>
@@ -57,8 +63,11 @@
 #include <QtWidgets/QAction>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QMessageBox>
 #include <QtWidgets/QTreeWidgetItem>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     : QWidget(parent),
       active(false), enterPressed(false), allowRemoteRundownTriggering(false), repositoryRundown(false), previewOnAutoStep(false),
@@ -66,18 +75,30 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
       upControlSubscription(NULL), downControlSubscription(NULL), playAndAutoStepControlSubscription(NULL), playNowAndAutoStepControlSubscription(NULL),
       playNowIfChannelControlSubscription(NULL), stopControlSubscription(NULL), playControlSubscription(NULL), playNowControlSubscription(NULL),
       loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL), updateControlSubscription(NULL), invokeControlSubscription(NULL),
-      clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL), repositoryDevice(NULL)
+      clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL), repositoryDevice(NULL),
+      hibernated(false), hasUsedItems(false), snapshotItemCount(0), snapshotCurrentRow(-1), snapshotCurrentChildRow(-1), searchResultIndex(-1)
 {
     setupUi(this);
     setupMenus();
 
+    this->widgetSearch->setVisible(false);
+    this->lineEditSearch->installEventFilter(this);
+    QObject::connect(this->lineEditSearch, SIGNAL(textChanged(const QString&)), this, SLOT(searchTextChanged(const QString&)));
+
+    this->hibernateTimer.setSingleShot(true);
+    this->hibernateTimer.setInterval(Rundown::HIBERNATE_DELAY);
+    QObject::connect(&this->hibernateTimer, SIGNAL(timeout()), this, SLOT(hibernate()));
+
+    // Repository changes are parsed one at a time so they are applied in the order they arrived.
+    this->repositoryPool.setMaxThreadCount(1);
+
     this->previewOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("PreviewOnAutoStep").getValue() == "true") ? true : false;
     this->clearDelayedCommandsOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("ClearDelayedCommandsOnAutoStep").getValue() == "true") ? true : false;
 
     QObject::connect(this->treeWidgetRundown, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(customContextMenuRequested(const QPoint &)));
 
     // TODO: Specific Gpi device.
-    QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(gpiTriggered(int, GpiDevice*)), this, SLOT(gpiPortTriggered(int, GpiDevice*)));
+    QObject::connect(&GpiManager::getInstance(), SIGNAL(gpiTriggered(int, qint64)), this, SLOT(gpiPortTriggered(int, qint64)));
 
     QObject::connect(&EventManager::getInstance(), SIGNAL(clearDelayedCommands()), this, SLOT(clearDelayedCommands()));
     QObject::connect(&EventManager::getInstance(), SIGNAL(saveAsPreset(const SaveAsPresetEvent&)), this, SLOT(saveAsPreset(const SaveAsPresetEvent&)));
@@ -96,6 +117,7 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(insertRepositoryChanges(const InsertRepositoryChangesEvent&)), this, SLOT(insertRepositoryChanges(const InsertRepositoryChangesEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(clearCurrentPlayingItem(const ClearCurrentPlayingItemEvent&)), this, SLOT(clearCurrentPlayingItem(const ClearCurrentPlayingItemEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(currentItemChanged(const CurrentItemChangedEvent&)), this, SLOT(currentItemChanged(const CurrentItemChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(findInRundown(const FindInRundownEvent&)), this, SLOT(findInRundown(const FindInRundownEvent&)));
 
     foreach (const GpiPortModel& port, DatabaseManager::getInstance().getGpiPorts())
         gpiBindingChanged(port.getPort(), port.getAction());
@@ -374,8 +396,12 @@ void RundownTreeWidget::addPresetItem(const AddPresetItemEvent& event)
     if (!this->active)
         return;
 
-    qApp->clipboard()->setText(event.getPreset());
-    pasteSelectedItems();
+    // The preset is kept parsed, the clipboard is left alone.
+    boost::property_tree::wptree pt;
+    if (!PresetManager::getInstance().getItems(event.getPresetId(), pt))
+        return;
+
+    this->treeWidgetRundown->pasteItems(pt, this->repositoryRundown);
     selectItemBelow();
 }
 
@@ -444,6 +470,9 @@ void RundownTreeWidget::allowRemoteTriggering(const AllowRemoteTriggeringEvent&
     if (!this->active)
         return;
 
+    if (this->allowRemoteRundownTriggering != event.getEnabled())
+        this->treeWidgetRundown->getJournal()->touch();
+
     this->allowRemoteRundownTriggering = event.getEnabled();
 
     (this->allowRemoteRundownTriggering == true) ? configureOscSubscriptions() : resetOscSubscriptions();
@@ -506,28 +535,16 @@ void RundownTreeWidget::autoPlayRundownItem(const AutoPlayRundownItemEvent& even
     if (!this->active)
         return;
 
-    AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(event.getSource());
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
-    {
-        if (autoPlayQueue->contains(rundownWidget))
-        {
-            // Remove currently playing item.
-            autoPlayQueue->removeAt(0);
+    RundownMovieWidget* rundownWidget = dynamic_cast<RundownMovieWidget*>(event.getSource());
+    if (rundownWidget == NULL)
+        return;
 
-            // Have more in queue, play them...
-            if (!autoPlayQueue->isEmpty())
-            {
-                AbstractRundownWidget* rundownQueueWidget = dynamic_cast<AbstractRundownWidget*>(autoPlayQueue->at(0));
-                dynamic_cast<AbstractPlayoutCommand*>(rundownQueueWidget)->executeCommand(Playout::PlayoutType::Play);
+    this->currentAutoPlayWidget = rundownWidget;
 
-                this->currentAutoPlayWidget = rundownQueueWidget;
-            }
-            else
-                this->autoPlayQueues.removeOne(autoPlayQueue);
-
-            break;
-        }
-    }
+    // The clip is on air, put the next one in the background so the server can cut to it without us.
+    RundownMovieWidget* rundownQueueWidget = this->autoPlayQueue.started(rundownWidget);
+    if (rundownQueueWidget != NULL)
+        rundownQueueWidget->executeQueue();
 }
 
 void RundownTreeWidget::autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent& event)
@@ -535,30 +552,30 @@ void RundownTreeWidget::autoPlayNextRundownItem(const AutoPlayNextRundownItemEve
     if (!this->active)
         return;
 
-    AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(event.getSource());
-
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
-    {
-        if (autoPlayQueue->contains(rundownWidget))
-        {
-            // Have more in queue, play them...
-            if (!autoPlayQueue->isEmpty())
-            {
-                AbstractRundownWidget* rundownQueueWidget = dynamic_cast<AbstractRundownWidget*>(autoPlayQueue->at(0));
-                dynamic_cast<AbstractPlayoutCommand*>(rundownQueueWidget)->executeCommand(Playout::PlayoutType::Next);
-
-                this->currentAutoPlayWidget = rundownQueueWidget;
-            }
+    RundownMovieWidget* rundownWidget = dynamic_cast<RundownMovieWidget*>(event.getSource());
+    if (rundownWidget == NULL)
+        return;
 
-            break;
-        }
-    }
+    // Skip to the clip waiting in the background.
+    RundownMovieWidget* rundownQueueWidget = this->autoPlayQueue.getQueued(rundownWidget);
+    if (rundownQueueWidget != NULL)
+        rundownQueueWidget->executeCommand(Playout::PlayoutType::Next);
 }
 
 void RundownTreeWidget::setActive(bool active)
 {
     this->active = active;
 
+    if (this->active)
+    {
+        this->hibernateTimer.stop();
+
+        if (this->hibernated)
+            rehydrate();
+    }
+    else
+        this->hibernateTimer.start();
+
     if (this->active)
     {
         EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(this->allowRemoteRundownTriggering));
@@ -598,6 +615,8 @@ void RundownTreeWidget::setActive(bool active)
 
 void RundownTreeWidget::openRundown(const QString& path)
 {
+    TRACE_FUNCTION("rundown");
+
     QTime time;
     time.start();
 
@@ -613,26 +632,60 @@ void RundownTreeWidget::openRundown(const QString& path)
         QTextStream stream(&file);
         stream.setCodec(QTextCodec::codecForName("UTF-8"));
 
-        // Save the latest value stored in the clipboard.
-        QString latest = qApp->clipboard()->text();
         QString data = stream.readAll();
 
-        this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
-        qDebug("Hash is %s", qPrintable(this->hexHash));
+        this->treeWidgetRundown->getJournal()->suspend();
+        if (!this->treeWidgetRundown->pasteItems(data, this->repositoryRundown))
+        {
+            file.close();
+
+            // Keep the broken file out of reach of save, it would be overwritten with an empty rundown.
+            this->activeRundown = Rundown::DEFAULT_NAME;
+            this->treeWidgetRundown->getJournal()->reset();
 
-        qApp->clipboard()->setText(data);
-        pasteSelectedItems();
+            QMessageBox box(this);
+            box.setWindowTitle("Open Rundown");
+            box.setWindowIcon(QIcon(":/Graphics/Images/CasparCG.png"));
+            box.setText(QString("Unable to open %1, the rundown contains items that could not be read.").arg(QFileInfo(path).fileName()));
+            box.setIconPixmap(QPixmap(":/Graphics/Images/Attention.png"));
+            box.setStandardButtons(QMessageBox::Ok);
+            box.buttons().at(0)->setFocusPolicy(Qt::NoFocus);
+            box.exec();
 
-        // Set previous stored clipboard value.
-        qApp->clipboard()->setText(latest);
+            EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
+
+            return;
+        }
 
         qDebug("Parsing rundown completed in %d msec", time.elapsed());
 
         file.close();
 
+        this->treeWidgetRundown->getJournal()->reset();
+        this->treeWidgetRundown->getJournal()->setAutosaveName(path);
+        if (this->treeWidgetRundown->getJournal()->hasAutosave())
+        {
+            QMessageBox box(this);
+            box.setWindowTitle("Open Rundown");
+            box.setWindowIcon(QIcon(":/Graphics/Images/CasparCG.png"));
+            box.setText(QString("There are unsaved changes to %1 from a previous session. Do you want to recover them?").arg(QFileInfo(path).fileName()));
+            box.setIconPixmap(QPixmap(":/Graphics/Images/Attention.png"));
+            box.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+            box.buttons().at(0)->setIcon(QIcon());
+            box.buttons().at(0)->setFocusPolicy(Qt::NoFocus);
+            box.buttons().at(1)->setIcon(QIcon());
+            box.buttons().at(1)->setFocusPolicy(Qt::NoFocus);
+
+            if (box.exec() == QMessageBox::Yes)
+                this->treeWidgetRundown->getJournal()->recoverAutosave();
+            else
+                this->treeWidgetRundown->getJournal()->removeAutosave();
+        }
+
         if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
             this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
 
+        this->treeWidgetRundown->buildSearchIndex();
         this->treeWidgetRundown->setFocus();
 
         DatabaseManager::getInstance().insertOpenRecent(path);
@@ -666,18 +719,22 @@ void RundownTreeWidget::doOpenRundownFromUrl(QNetworkReply* reply)
 {
     this->repositoryRundown = true;
 
-    // Save the latest value stored in the clipboard.
-    QString latest = qApp->clipboard()->text();
     QString data = QString::fromUtf8(reply->readAll());
 
-    this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
-    qDebug("Hash is %s", qPrintable(this->hexHash));
-
-    qApp->clipboard()->setText(data);
-    pasteSelectedItems();
+    this->treeWidgetRundown->getJournal()->suspend();
+    if (!this->treeWidgetRundown->pasteItems(data, this->repositoryRundown))
+    {
+        QMessageBox box(this);
+        box.setWindowTitle("Open Rundown");
+        box.setWindowIcon(QIcon(":/Graphics/Images/CasparCG.png"));
+        box.setText(QString("Unable to open %1, the rundown contains items that could not be read.").arg(this->activeRundown));
+        box.setIconPixmap(QPixmap(":/Graphics/Images/Attention.png"));
+        box.setStandardButtons(QMessageBox::Ok);
+        box.buttons().at(0)->setFocusPolicy(Qt::NoFocus);
+        box.exec();
+    }
 
-    // Set previous stored clipboard value.
-    qApp->clipboard()->setText(latest);
+    this->treeWidgetRundown->getJournal()->reset();
 
     if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
         this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
@@ -708,8 +765,19 @@ void RundownTreeWidget::repositoryChanged(const RepositoryChangeModel& model, Re
 {
     Q_UNUSED(device);
 
-    this->treeWidgetRundown->addRepositoryChange(model);
-    this->treeWidgetRundown->applyRepositoryChanges();
+    QFutureWatcher<QSharedPointer<RepositoryChange>>* watcher = new QFutureWatcher<QSharedPointer<RepositoryChange>>(this);
+    QObject::connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher]()
+    {
+        this->treeWidgetRundown->addRepositoryChange(watcher->result());
+        this->treeWidgetRundown->applyRepositoryChanges();
+
+        watcher->deleteLater();
+    });
+
+    watcher->setFuture(QtConcurrent::run(&this->repositoryPool, [model]()
+    {
+        return QSharedPointer<RepositoryChange>(new RepositoryChange(model));
+    }));
 }
 
 void RundownTreeWidget::insertRepositoryChanges(const InsertRepositoryChangesEvent& event)
@@ -737,12 +805,15 @@ void RundownTreeWidget::reloadRundown()
     if (this->currentPlayingAutoStepItem != NULL)
         this->currentPlayingAutoStepItem = NULL;
 
+    this->autoPlayQueue.clear();
+
     if (this->currentAutoPlayWidget != NULL)
     {
         delete this->currentAutoPlayWidget;
         this->currentAutoPlayWidget = NULL;
     }
 
+    this->treeWidgetRundown->getJournal()->suspend();
     this->treeWidgetRundown->removeAllItems();
 
     if (this->repositoryRundown)
@@ -756,7 +827,9 @@ void RundownTreeWidget::reloadRundown()
 
 void RundownTreeWidget::saveRundown(bool saveAs)
 {
-    if (this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
+    TRACE_FUNCTION("rundown");
+
+    if (!this->hibernated && this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
         return;
 
     QString path;
@@ -779,25 +852,18 @@ void RundownTreeWidget::saveRundown(bool saveAs)
 
         if (file.open(QFile::WriteOnly))
         {
-            QByteArray data;
-            QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
-
-            writer->writeStartDocument();
-            writer->writeStartElement("items");
-            writer->writeTextElement("allowremotetriggering", (this->allowRemoteRundownTriggering == true) ? "true" : "false");
-
-            for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
-                this->treeWidgetRundown->writeProperties(this->treeWidgetRundown->invisibleRootItem()->child(i), writer);
-
-            writer->writeEndElement();
-            writer->writeEndDocument();
-
-            this->hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
-            qDebug("Hash is %s", qPrintable(this->hexHash));
+            // A hibernated rundown has no items in the tree, its snapshot is the document.
+            QByteArray data = (this->hibernated) ? qUncompress(this->snapshot) : writeRundown();
 
             file.write(data);
             file.close();
 
+            this->treeWidgetRundown->getJournal()->markSaved();
+
+            // The file has everything now, the autosave is only needed again after the next edit.
+            this->treeWidgetRundown->getJournal()->setAutosaveName(path);
+            this->treeWidgetRundown->getJournal()->removeAutosave();
+
             qDebug("Saved rundown to %s", qPrintable(path));
         }
 
@@ -807,36 +873,33 @@ void RundownTreeWidget::saveRundown(bool saveAs)
     }
 }
 
+QByteArray RundownTreeWidget::writeRundown() const
+{
+    QByteArray data;
+    data.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?><items>");
+    data.append(QString("<allowremotetriggering>%1</allowremotetriggering>").arg((this->allowRemoteRundownTriggering == true) ? "true" : "false").toUtf8());
+
+    // Items that were not edited since the last save come from the journal as they are, only the rest is written again.
+    for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
+        data.append(this->treeWidgetRundown->getJournal()->getItemXml(i).toUtf8());
+
+    data.append("</items>\n");
+
+    return data;
+}
+
 bool RundownTreeWidget::checkForSave() const
 {
     // Don't save empty rundowns.
-    if (this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
+    if (!this->hibernated && this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
         return false;
 
     // We can't save repository rundowns.
     if (this->repositoryRundown)
         return false;
 
-    QByteArray data;
-    QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
-
-    writer->writeStartDocument();
-    writer->writeStartElement("items");
-    writer->writeTextElement("allowremotetriggering", (this->allowRemoteRundownTriggering == true) ? "true" : "false");
-
-    for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
-        this->treeWidgetRundown->writeProperties(this->treeWidgetRundown->invisibleRootItem()->child(i), writer);
-
-    writer->writeEndElement();
-    writer->writeEndDocument();
-
-    QString hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
-    qDebug("Hash is %s", qPrintable(hexHash));
-
-    if (hexHash != this->hexHash)
-        return true;
-
-    return false;
+    // The journal counts every edit, nothing has to be serialized to tell, hibernated or not.
+    return this->treeWidgetRundown->getJournal()->isModified();
 }
 
 void RundownTreeWidget::colorizeItems(const QString& color)
@@ -845,14 +908,21 @@ void RundownTreeWidget::colorizeItems(const QString& color)
         return;
 
     foreach (QTreeWidgetItem* item, this->treeWidgetRundown->selectedItems())
+    {
         dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(item, 0))->setColor(color); // Colorize current selected item.
+        this->treeWidgetRundown->getJournal()->itemChanged(item);
+    }
 }
 
-void RundownTreeWidget::gpiPortTriggered(int gpiPort, GpiDevice* device)
+void RundownTreeWidget::gpiPortTriggered(int gpiPort, qint64 timestamp)
 {
-    Q_UNUSED(device);
+    Q_UNUSED(timestamp);
 
-    executeCommand(gpiBindings[gpiPort], Action::ActionType::GpiPulse);
+    // Only the rundown on screen takes GPI pulses.
+    if (!this->active || !this->gpiBindings.contains(gpiPort))
+        return;
+
+    executeCommand(this->gpiBindings[gpiPort], Action::ActionType::GpiPulse);
 }
 
 void RundownTreeWidget::gpiBindingChanged(int gpiPort, Playout::PlayoutType binding)
@@ -1117,7 +1187,12 @@ bool RundownTreeWidget::duplicateSelectedItems()
 
 bool RundownTreeWidget::pasteSelectedItems()
 {
-    return this->treeWidgetRundown->pasteSelectedItems(this->repositoryRundown);
+    if (this->treeWidgetRundown->pasteSelectedItems(this->repositoryRundown))
+        return true;
+
+    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Unable to paste, the clipboard contains items that could not be read."));
+
+    return false;
 }
 
 bool RundownTreeWidget::copySelectedItems() const
@@ -1133,6 +1208,9 @@ void RundownTreeWidget::setUsed(bool used)
     QWidget* selectedWidget = this->treeWidgetRundown->itemWidget(this->treeWidgetRundown->currentItem(), 0);
     AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(selectedWidget);
 
+    if (used)
+        this->hasUsedItems = true;
+
     rundownWidget->setUsed(used);
     if (rundownWidget != NULL && rundownWidget->isGroup())
     {
@@ -1147,6 +1225,8 @@ void RundownTreeWidget::setUsed(bool used)
 
 void RundownTreeWidget::setAllUsed(bool used)
 {
+    this->hasUsedItems = used;
+
     for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
     {
         QTreeWidgetItem* currentItem = this->treeWidgetRundown->invisibleRootItem()->child(i);
@@ -1239,7 +1319,7 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
             // The group have AutoPlay enabled, play the items within the group.
             bool isFirstChild = true;
 
-            QList<AbstractRundownWidget*>* autoPlayQueue = new QList<AbstractRundownWidget*>();
+            QList<RundownMovieWidget*> autoPlayWidgets;
             for (int i = 0; i < currentItem->childCount(); i++)
             {
                 QWidget* childWidget = this->treeWidgetRundown->itemWidget(currentItem->child(i), 0);
@@ -1260,7 +1340,7 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                         this->currentAutoPlayWidget = rundownChildWidget;
                     }
 
-                    autoPlayQueue->push_back(rundownChildWidget); // Add our widget to the execution queue.
+                    autoPlayWidgets.push_back(dynamic_cast<RundownMovieWidget*>(rundownChildWidget)); // Add our widget to the execution queue.
 
                     isFirstChild = false;
                 }
@@ -1270,8 +1350,7 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                 }
             }
 
-            if (autoPlayQueue->count() > 0)
-                this->autoPlayQueues.push_back(autoPlayQueue);
+            this->autoPlayQueue.start(autoPlayWidgets);
         }
         else
         {
@@ -1326,7 +1405,7 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
         // The selected items parent is a group. If the group have AutoPlay property set, then play current item and below within the group.
         if (type == Playout::PlayoutType::Play && dynamic_cast<GroupCommand*>(rundownWidgetParent->getCommand())->getAutoPlay())
         {
-            QList<AbstractRundownWidget*>* autoPlayQueue = new QList<AbstractRundownWidget*>();
+            QList<RundownMovieWidget*> autoPlayWidgets;
             for (int i = currentItem->parent()->indexOfChild(currentItem); i < currentItem->parent()->childCount(); i++)
             {
                 QWidget* childWidget = this->treeWidgetRundown->itemWidget(currentItem->parent()->child(i), 0);
@@ -1337,11 +1416,11 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                     if (!dynamic_cast<MovieCommand*>(rundownChildWidget->getCommand())->getAutoPlay())
                         continue;
 
-                    autoPlayQueue->push_back(rundownChildWidget); // Add our widget to the execution queue.
+                    autoPlayWidgets.push_back(dynamic_cast<RundownMovieWidget*>(rundownChildWidget)); // Add our widget to the execution queue.
                 }
             }
 
-            this->autoPlayQueues.push_back(autoPlayQueue);
+            this->autoPlayQueue.start(autoPlayWidgets);
         }
     }
 
@@ -1650,32 +1729,21 @@ void RundownTreeWidget::addSpyderPresetItem()
 
 void RundownTreeWidget::saveAsPreset()
 {
-    if (!copySelectedItems())
-        return;
+    QScopedPointer<RundownItemMimeData> data(this->treeWidgetRundown->createItemData());
 
     PresetDialog* dialog = new PresetDialog(this);
     if (dialog->exec() == QDialog::Accepted)
     {
-        DatabaseManager::getInstance().insertPreset(PresetModel(0, dialog->getName(), qApp->clipboard()->text()));
-        EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent());
+        int id = PresetManager::getInstance().insertPreset(PresetModel(0, dialog->getName(), data->text()));
+        EventManager::getInstance().firePresetChangedEvent(PresetChangedEvent(id));
     }
 }
 
 void RundownTreeWidget::removeItemFromAutoPlayQueue(const RemoveItemFromAutoPlayQueueEvent& event)
 {
-    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(event.getItem(), 0));
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
-    {
-        if (autoPlayQueue->contains(widget))
-        {
-            autoPlayQueue->removeOne(widget);
-
-            if (autoPlayQueue->isEmpty())
-                this->autoPlayQueues.removeOne(autoPlayQueue);
-
-            break;
-        }
-    }
+    RundownMovieWidget* widget = dynamic_cast<RundownMovieWidget*>(this->treeWidgetRundown->itemWidget(event.getItem(), 0));
+    if (widget != NULL)
+        this->autoPlayQueue.remove(widget);
 }
 
 void RundownTreeWidget::clearCurrentPlayingItem(const ClearCurrentPlayingItemEvent& event)
@@ -1697,6 +1765,131 @@ bool RundownTreeWidget::getAllowRemoteTriggering() const
     return this->allowRemoteRundownTriggering;
 }
 
+bool RundownTreeWidget::isHibernated() const
+{
+    return this->hibernated;
+}
+
+QString RundownTreeWidget::getMemoryUsage() const
+{
+    if (this->hibernated)
+        return QString("%1 items, hibernated in %2 KB").arg(this->snapshotItemCount).arg(this->snapshot.size() / 1024.0, 0, 'f', 1);
+
+    int count = this->treeWidgetRundown->invisibleRootItem()->childCount();
+    for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
+        count += this->treeWidgetRundown->invisibleRootItem()->child(i)->childCount();
+
+    return QString("%1 items").arg(count);
+}
+
+bool RundownTreeWidget::canHibernate() const
+{
+    if (this->active || this->hibernated)
+        return false;
+
+    if (this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
+        return false;
+
+    // Repository rundowns receive changes and remote triggering needs the item subscriptions.
+    if (this->repositoryRundown || this->allowRemoteRundownTriggering)
+        return false;
+
+    // We can't tell if something played from this rundown is still on air or has delayed commands pending.
+    if (this->currentPlayingItem != NULL || this->currentAutoPlayWidget != NULL)
+        return false;
+
+    // Used marks are not part of the rundown file.
+    if (this->hasUsedItems)
+        return false;
+
+    // Unsaved edits stay in the tree, where saving finds them.
+    if (this->treeWidgetRundown->getJournal()->isModified())
+        return false;
+
+    return true;
+}
+
+void RundownTreeWidget::hibernate()
+{
+    TRACE_FUNCTION("rundown");
+
+    if (!canHibernate())
+        return;
+
+    QTime time;
+    time.start();
+
+    QByteArray data = writeRundown();
+
+    this->snapshotItemCount = 0;
+    this->snapshotCurrentRow = -1;
+    this->snapshotCurrentChildRow = -1;
+
+    for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
+        this->snapshotItemCount += 1 + this->treeWidgetRundown->invisibleRootItem()->child(i)->childCount();
+
+    QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
+    if (currentItem != NULL && currentItem->parent() != NULL)
+    {
+        this->snapshotCurrentRow = this->treeWidgetRundown->indexOfTopLevelItem(currentItem->parent());
+        this->snapshotCurrentChildRow = currentItem->parent()->indexOfChild(currentItem);
+    }
+    else if (currentItem != NULL)
+        this->snapshotCurrentRow = this->treeWidgetRundown->indexOfTopLevelItem(currentItem);
+
+    this->snapshot = qCompress(data);
+    this->copyItem = NULL;
+    this->currentPlayingAutoStepItem = NULL;
+
+    // The history outlives the widgets, it refers to rows and XML only.
+    this->treeWidgetRundown->getJournal()->suspend();
+    this->treeWidgetRundown->removeAllItems();
+
+    this->hibernated = true;
+
+    qDebug("Hibernated rundown %s, %d items in %d bytes (%d bytes uncompressed) in %d msec",
+           qPrintable(this->activeRundown), this->snapshotItemCount, this->snapshot.size(), data.size(), time.elapsed());
+
+    emit hibernationChanged(*this);
+}
+
+void RundownTreeWidget::rehydrate()
+{
+    TRACE_FUNCTION("rundown");
+
+    QTime time;
+    time.start();
+
+    this->treeWidgetRundown->setCurrentItem(NULL);
+    if (!this->treeWidgetRundown->pasteItems(QString::fromUtf8(qUncompress(this->snapshot)), this->repositoryRundown))
+    {
+        // The snapshot is the only copy of the rundown, it stays hibernated rather than come back empty.
+        qCritical("Unable to rehydrate rundown %s, it stays hibernated", qPrintable(this->activeRundown));
+        return;
+    }
+
+    this->hibernated = false;
+    this->treeWidgetRundown->getJournal()->resume();
+
+    QTreeWidgetItem* currentItem = NULL;
+    if (this->snapshotCurrentRow >= 0 && this->snapshotCurrentRow < this->treeWidgetRundown->topLevelItemCount())
+    {
+        currentItem = this->treeWidgetRundown->topLevelItem(this->snapshotCurrentRow);
+        if (this->snapshotCurrentChildRow >= 0 && this->snapshotCurrentChildRow < currentItem->childCount())
+            currentItem = currentItem->child(this->snapshotCurrentChildRow);
+    }
+
+    if (currentItem != NULL)
+        this->treeWidgetRundown->setCurrentItem(currentItem);
+
+    this->treeWidgetRundown->buildSearchIndex();
+    this->snapshot.clear();
+
+    qDebug("Rehydrated rundown %s, %d items in %d msec", qPrintable(this->activeRundown), this->snapshotItemCount, time.elapsed());
+
+    emit hibernationChanged(*this);
+}
+
 void RundownTreeWidget::resetOscSubscriptions()
 {
     if (this->upControlSubscription != NULL)
@@ -2099,3 +2292,103 @@ void RundownTreeWidget::clearChannelControlSubscriptionReceived(const QString& p
     if (this->allowRemoteRundownTriggering && arguments.count() > 0 && arguments[0].toInt() > 0)
         EventManager::getInstance().fireExecuteRundownItemEvent(ExecuteRundownItemEvent(Playout::PlayoutType::ClearChannel, this->treeWidgetRundown->currentItem()));
 }
+
+bool RundownTreeWidget::eventFilter(QObject* target, QEvent* event)
+{
+    if (target == this->lineEditSearch && event->type() == QEvent::KeyPress)
+    {
+        QKeyEvent* keyEvent = static_cast<QKeyEvent*>(event);
+        if (keyEvent->key() == Qt::Key_Escape)
+        {
+            hideSearch();
+            return true;
+        }
+        else if (keyEvent->key() == Qt::Key_Return || keyEvent->key() == Qt::Key_Enter)
+        {
+            // Enter steps to the next match, Shift+Enter to the previous one. The rundown may have
+            // changed since the last key, the index knows and only searches again when it did.
+            this->searchResults = this->treeWidgetRundown->searchItems(this->lineEditSearch->text());
+            showSearchResult((keyEvent->modifiers() & Qt::ShiftModifier) ? this->searchResultIndex - 1 : this->searchResultIndex + 1);
+            return true;
+        }
+    }
+
+    return QWidget::eventFilter(target, event);
+}
+
+void RundownTreeWidget::findInRundown(const FindInRundownEvent& event)
+{
+    Q_UNUSED(event);
+
+    if (!this->active)
+        return;
+
+    this->widgetSearch->setVisible(true);
+    this->lineEditSearch->setFocus();
+    this->lineEditSearch->selectAll();
+}
+
+void RundownTreeWidget::hideSearch()
+{
+    this->widgetSearch->setVisible(false);
+    this->searchResults.clear();
+    this->searchResultIndex = -1;
+
+    this->treeWidgetRundown->setFocus();
+}
+
+void RundownTreeWidget::searchTextChanged(const QString& text)
+{
+    this->searchResults = this->treeWidgetRundown->searchItems(text);
+    this->searchResultIndex = -1;
+
+    if (this->searchResults.isEmpty())
+    {
+        this->labelSearchResult->setText((text.trimmed().isEmpty()) ? "" : "No match");
+        return;
+    }
+
+    // Start from the first match at or below the current item, like find as you type in an editor. The
+    // matches are in rundown order, so a binary search finds it.
+    int index = 0;
+    QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
+    if (currentItem != NULL)
+    {
+        QPair<int, int> currentPosition = getItemPosition(currentItem);
+
+        int first = 0;
+        int last = this->searchResults.count();
+        while (first < last)
+        {
+            int middle = (first + last) / 2;
+            if (getItemPosition(this->searchResults.at(middle)) < currentPosition)
+                first = middle + 1;
+            else
+                last = middle;
+        }
+
+        index = (first < this->searchResults.count()) ? first : 0;
+    }
+
+    showSearchResult(index);
+}
+
+QPair<int, int> RundownTreeWidget::getItemPosition(QTreeWidgetItem* item) const
+{
+    if (item->parent() != NULL)
+        return qMakePair(this->treeWidgetRundown->indexOfTopLevelItem(item->parent()), item->parent()->indexOfChild(item));
+
+    return qMakePair(this->treeWidgetRundown->indexOfTopLevelItem(item), -1);
+}
+
+void RundownTreeWidget::showSearchResult(int index)
+{
+    if (this->searchResults.isEmpty())
+        return;
+
+    // Wrap around at both ends.
+    this->searchResultIndex = (index + this->searchResults.count()) % this->searchResults.count();
+
+    this->treeWidgetRundown->jumpToItem(this->searchResults.at(this->searchResultIndex));
+    this->labelSearchResult->setText(QString("%1 of %2").arg(this->searchResultIndex + 1).arg(this->searchResults.count()));
+}
@@ -2,6 +2,7 @@
 
 #include "../Shared.h"
 #include "AbstractRundownWidget.h"
+#include "AutoPlayQueue.h"
 #include "RundownTreeBaseWidget.h"
 #include "ui_RundownTreeWidget.h"
 
@@ -28,6 +29,7 @@
 #include "Events/Rundown/PasteItemPropertiesEvent.h"
 #include "Events/Rundown/InsertRepositoryChangesEvent.h"
 #include "Events/Rundown/CurrentItemChangedEvent.h"
+#include "Events/Rundown/FindInRundownEvent.h"
 
 #include <boost/foreach.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -36,9 +38,12 @@
 #include <QtCore/QEvent>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QPair>
 #include <QtCore/QString>
 #include <QtCore/QXmlStreamWriter>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
 
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QTreeWidgetItem>
@@ -54,6 +59,8 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
     public:
         explicit RundownTreeWidget(QWidget* parent = 0);
 
+        bool eventFilter(QObject* target, QEvent* event);
+
         void setActive(bool active);
         void openRundown(const QString& path);
         void openRundownFromUrl(const QString& url);
@@ -63,12 +70,17 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         void setAllUsed(bool used);
 
         bool checkForSave() const;
+        bool isHibernated() const;
+
+        QString getMemoryUsage() const;
 
         bool getAllowRemoteTriggering() const;
         bool executeCommand(Playout::PlayoutType type, Action::ActionType source, QTreeWidgetItem* item = NULL);
 
         Q_SLOT void gpiBindingChanged(int, Playout::PlayoutType);
 
+        Q_SIGNAL void hibernationChanged(RundownTreeWidget&);
+
     private:
         bool active;
         bool enterPressed;
@@ -79,7 +91,17 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
 
         QString page;
         QString activeRundown;
-        QString hexHash;
+
+        bool hibernated;
+        bool hasUsedItems;
+        QTimer hibernateTimer;
+        QByteArray snapshot;
+        int snapshotItemCount;
+        int snapshotCurrentRow;
+        int snapshotCurrentChildRow;
+
+        QList<QTreeWidgetItem*> searchResults;
+        int searchResultIndex;
 
         QMenu* contextMenuTools;
         QMenu* contextMenuColor;
@@ -97,7 +119,7 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         QMap<int, Playout::PlayoutType> gpiBindings;
 
         AbstractRundownWidget* currentAutoPlayWidget;
-        QList<QList<AbstractRundownWidget*>* > autoPlayQueues;
+        AutoPlayQueue autoPlayQueue;
 
         QTreeWidgetItem* copyItem;
         QTreeWidgetItem* currentPlayingItem;
@@ -121,10 +143,14 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         OscSubscription* clearChannelControlSubscription;
 
         QSharedPointer<RepositoryDevice> repositoryDevice;
+        QThreadPool repositoryPool;
 
         QNetworkAccessManager* networkManager;
 
         bool pasteSelectedItems();
+        bool canHibernate() const;
+        void rehydrate();
+        QByteArray writeRundown() const;
         bool duplicateSelectedItems();
         bool copySelectedItems() const;
         void setupMenus();
@@ -132,7 +158,11 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         void resetOscSubscriptions();
         void configureOscSubscriptions();
         QString colorLookup(const QString& color, bool reverse) const;
+        void showSearchResult(int index);
+        QPair<int, int> getItemPosition(QTreeWidgetItem* item) const;
+        void hideSearch();
 
+        Q_SLOT void hibernate();
         Q_SLOT void addAtemFadeToBlackItem();
         Q_SLOT void addPlayoutCommandItem();
         Q_SLOT void addCustomCommandItem();
@@ -193,7 +223,7 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         Q_SLOT void contextMenuColorTriggered(QAction*);
         Q_SLOT void contextMenuRundownTriggered(QAction*);
         Q_SLOT void customContextMenuRequested(const QPoint&);
-        Q_SLOT void gpiPortTriggered(int, GpiDevice*);
+        Q_SLOT void gpiPortTriggered(int, qint64);
         Q_SLOT void currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*);
         Q_SLOT void itemDoubleClicked(QTreeWidgetItem*, int);
         Q_SLOT void itemClicked(QTreeWidgetItem*, int);
@@ -246,4 +276,6 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         Q_SLOT void insertRepositoryChanges(const InsertRepositoryChangesEvent&);
         Q_SLOT void currentItemChanged(const CurrentItemChangedEvent&);
         Q_SLOT void clearDelayedCommands();
+        Q_SLOT void searchTextChanged(const QString&);
+        Q_SLOT void findInRundown(const FindInRundownEvent&);
 };
@@ -29,6 +29,7 @@ RundownWidget::RundownWidget(QWidget* parent)
     setupMenus();
 
     RundownTreeWidget* widget = new RundownTreeWidget(this);
+    QObject::connect(widget, SIGNAL(hibernationChanged(RundownTreeWidget&)), this, SLOT(hibernationChanged(RundownTreeWidget&)));
     int index = this->tabWidgetRundown->addTab(widget/*, QIcon(":/Graphics/Images/TabSplitter.png")*/, Rundown::DEFAULT_NAME);
     this->tabWidgetRundown->setTabToolTip(index, Rundown::DEFAULT_NAME);
     this->tabWidgetRundown->setCurrentIndex(index);
@@ -188,6 +189,7 @@ void RundownWidget::newRundown(const NewRundownEvent& event)
     Q_UNUSED(event);
 
     RundownTreeWidget* widget = new RundownTreeWidget(this);
+    QObject::connect(widget, SIGNAL(hibernationChanged(RundownTreeWidget&)), this, SLOT(hibernationChanged(RundownTreeWidget&)));
     int index = this->tabWidgetRundown->addTab(widget/*, QIcon(":/Graphics/Images/TabSplitter.png")*/, Rundown::DEFAULT_NAME);
     this->tabWidgetRundown->setCurrentIndex(index);
 
@@ -275,6 +277,7 @@ void RundownWidget::openRundown(const OpenRundownEvent& event)
     if (!path.isEmpty())
     {
         RundownTreeWidget* widget = new RundownTreeWidget(this);       
+        QObject::connect(widget, SIGNAL(hibernationChanged(RundownTreeWidget&)), this, SLOT(hibernationChanged(RundownTreeWidget&)));
 
         int index = this->tabWidgetRundown->addTab(widget/*, QIcon(":/Graphics/Images/TabSplitter.png")*/, Rundown::DEFAULT_NAME);
         this->tabWidgetRundown->setTabToolTip(index, path);
@@ -307,6 +310,7 @@ void RundownWidget::openRundownFromUrl(const OpenRundownFromUrlEvent& event)
     if (!path.isEmpty())
     {
         RundownTreeWidget* widget = new RundownTreeWidget(this);
+        QObject::connect(widget, SIGNAL(hibernationChanged(RundownTreeWidget&)), this, SLOT(hibernationChanged(RundownTreeWidget&)));
 
         int index = this->tabWidgetRundown->addTab(widget/*, QIcon(":/Graphics/Images/TabSplitter.png")*/, Rundown::DEFAULT_NAME);
         this->tabWidgetRundown->setTabToolTip(index, path);
@@ -484,6 +488,17 @@ void RundownWidget::currentChanged(int index)
     this->allowRemoteTriggeringAction->blockSignals(false);
 }
 
+void RundownWidget::hibernationChanged(RundownTreeWidget& widget)
+{
+    int index = this->tabWidgetRundown->indexOf(&widget);
+    if (index == -1)
+        return;
+
+    // Keep the rundown path on the first line of the tooltip.
+    QString path = this->tabWidgetRundown->tabToolTip(index).split("\n").first();
+    this->tabWidgetRundown->setTabToolTip(index, QString("%1\n%2").arg(path).arg(widget.getMemoryUsage()));
+}
+
 void RundownWidget::gpiBindingChanged(int gpiPort, Playout::PlayoutType binding)
 {
     for (int i = 0; i < this->tabWidgetRundown->count(); i++)
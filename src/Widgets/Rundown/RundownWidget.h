@@ -34,6 +34,8 @@
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QWidget>
 
+class RundownTreeWidget;
+
 class WIDGETS_EXPORT RundownWidget : public QWidget, Ui::RundownWidget
 {
     Q_OBJECT
@@ -85,6 +87,7 @@ class WIDGETS_EXPORT RundownWidget : public QWidget, Ui::RundownWidget
         Q_SLOT void currentChanged(int);
         Q_SLOT void tabCloseRequested(int);
         Q_SLOT void gpiBindingChanged(int, Playout::PlayoutType);
+        Q_SLOT void hibernationChanged(RundownTreeWidget&);
         Q_SLOT void remoteTriggering(bool);
         Q_SLOT void insertRepositoryChanges();
         Q_SLOT void newRundownMenu(const NewRundownMenuEvent&);
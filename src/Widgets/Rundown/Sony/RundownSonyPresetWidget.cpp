@@ -22,7 +22,7 @@ RundownSonyPresetWidget::RundownSonyPresetWidget(const LibraryModel& model, QWid
 {
     setupUi(this);
 
-    this->device = new ViscaDevice(this);
+    this->device = &ViscaDevice::getInstance();
 
     this->animation = new ActiveAnimation(this->labelActiveColor);
 
@@ -47,9 +47,11 @@ RundownSonyPresetWidget::RundownSonyPresetWidget(const LibraryModel& model, QWid
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(addressChanged(const QString&)), this, SLOT(cameraLatencyChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
+    QObject::connect(this->device, SIGNAL(latencyChanged(const QString&)), this, SLOT(cameraLatencyChanged(const QString&)));
 
     checkGpiConnection();
 }
@@ -70,17 +72,7 @@ AbstractRundownWidget* RundownSonyPresetWidget::clone()
     RundownSonyPresetWidget* widget = new RundownSonyPresetWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                   this->inGroup, this->compactView);
 
-    SonyPresetCommand* command = dynamic_cast<SonyPresetCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setAddress(this->command.getAddress());
-    command->setPreset(this->command.getPreset());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -324,6 +316,25 @@ void RundownSonyPresetWidget::allowGpiChanged(bool allowGpi)
     checkGpiConnection();
 }
 
+void RundownSonyPresetWidget::checkCameraState()
+{
+    const QString& address = this->command.getAddress();
+
+    // UDP has no connection, a camera that stopped answering is shown as disconnected.
+    this->labelDisconnected->setVisible(this->device->hasFailed(address));
+
+    int latency = this->device->getLatency(address);
+    setToolTip((latency == -1) ? QString() : QString("Camera %1 completed the last command in %2 ms").arg(address).arg(latency));
+}
+
+void RundownSonyPresetWidget::cameraLatencyChanged(const QString& address)
+{
+    if (address != this->command.getAddress())
+        return;
+
+    checkCameraState();
+}
+
 void RundownSonyPresetWidget::gpiConnectionStateChanged(bool connected, GpiDevice* device)
 {
     Q_UNUSED(connected);
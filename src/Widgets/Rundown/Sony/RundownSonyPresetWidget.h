@@ -76,6 +76,7 @@ class WIDGETS_EXPORT RundownSonyPresetWidget : public QWidget, Ui::RundownSonyPr
         ViscaDevice* device;
 
         void checkGpiConnection();
+        void checkCameraState();
         void checkDeviceConnection();
         void configureOscSubscriptions();
 
@@ -85,6 +86,7 @@ class WIDGETS_EXPORT RundownSonyPresetWidget : public QWidget, Ui::RundownSonyPr
         Q_SLOT void allowGpiChanged(bool);
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
+        Q_SLOT void cameraLatencyChanged(const QString&);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playNowControlSubscriptionReceived(const QString&, const QList<QVariant>&);
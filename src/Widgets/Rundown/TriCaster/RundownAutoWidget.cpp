@@ -118,18 +118,7 @@ AbstractRundownWidget* RundownAutoWidget::clone()
     RundownAutoWidget* widget = new RundownAutoWidget(this->model, this->parentWidget(), this->color, this->active,
                                                       this->inGroup, this->compactView);
 
-    AutoCommand* command = dynamic_cast<AutoCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setStep(this->command.getStep());
-    command->setSpeed(this->command.getSpeed());
-    command->setTransition(this->command.getTransition());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -47,6 +47,7 @@ RundownInputWidget::RundownInputWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(inputChanged(const QString&)), this, SLOT(inputChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(preview(const PreviewEvent&)), this, SLOT(preview(const PreviewEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(tricasterDeviceChanged(const TriCasterDeviceChangedEvent&)), this, SLOT(tricasterDeviceChanged(const TriCasterDeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
@@ -54,13 +55,17 @@ RundownInputWidget::RundownInputWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&TriCasterDeviceManager::getInstance(), SIGNAL(deviceAdded(TriCasterDevice&)), this, SLOT(deviceAdded(TriCasterDevice&)));
     const QSharedPointer<TriCasterDevice> device = TriCasterDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+        QObject::connect(device.data(), SIGNAL(tallyChanged(TriCasterDevice&)), this, SLOT(deviceTallyChanged(TriCasterDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
     checkEmptyDevice();
     checkGpiConnection();
     checkDeviceConnection();
+    checkTally();
 }
 
 void RundownInputWidget::preview(const PreviewEvent& event)
@@ -97,7 +102,10 @@ void RundownInputWidget::tricasterDeviceChanged(const TriCasterDeviceChangedEven
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<TriCasterDevice> oldDevice = TriCasterDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(tallyChanged(TriCasterDevice&)), this, SLOT(deviceTallyChanged(TriCasterDevice&)));
+        }
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -106,11 +114,15 @@ void RundownInputWidget::tricasterDeviceChanged(const TriCasterDeviceChangedEven
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<TriCasterDevice> newDevice = TriCasterDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(tallyChanged(TriCasterDevice&)), this, SLOT(deviceTallyChanged(TriCasterDevice&)));
+        }
     }
 
     checkEmptyDevice();
     checkDeviceConnection();
+    checkTally();
 }
 
 AbstractRundownWidget* RundownInputWidget::clone()
@@ -118,17 +130,7 @@ AbstractRundownWidget* RundownInputWidget::clone()
     RundownInputWidget* widget = new RundownInputWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->inGroup, this->compactView);
 
-    InputCommand* command = dynamic_cast<InputCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setSwitcher(this->command.getSwitcher());
-    command->setInput(this->command.getInput());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -308,6 +310,23 @@ void RundownInputWidget::checkDeviceConnection()
         this->labelDisconnected->setVisible(!device->isConnected());
 }
 
+void RundownInputWidget::checkTally()
+{
+    int tally = TriCasterDevice::TallyNone;
+
+    const QSharedPointer<TriCasterDevice> device = TriCasterDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device != NULL)
+        tally = device->getTally(this->command.getInput());
+
+    QString color = Color::DEFAULT_TRICASTER_COLOR;
+    if (tally & TriCasterDevice::TallyProgram)
+        color = Color::DEFAULT_TALLY_PROGRAM_COLOR;
+    else if (tally & TriCasterDevice::TallyPreview)
+        color = Color::DEFAULT_TALLY_PREVIEW_COLOR;
+
+    this->labelColor->setStyleSheet(QString("background-color: %1;").arg(color));
+}
+
 void RundownInputWidget::configureOscSubscriptions()
 {
     if (!this->command.getAllowRemoteTriggering())
@@ -379,12 +398,30 @@ void RundownInputWidget::deviceConnectionStateChanged(TriCasterDevice& device)
     checkDeviceConnection();
 }
 
+void RundownInputWidget::deviceTallyChanged(TriCasterDevice& device)
+{
+    Q_UNUSED(device);
+
+    checkTally();
+}
+
+void RundownInputWidget::inputChanged(const QString& input)
+{
+    Q_UNUSED(input);
+
+    checkTally();
+}
+
 void RundownInputWidget::deviceAdded(TriCasterDevice& device)
 {
     if (TriCasterDeviceManager::getInstance().getDeviceModelByAddress(device.getAddress()).getName() == this->model.getDeviceName())
+    {
         QObject::connect(&device, SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+        QObject::connect(&device, SIGNAL(tallyChanged(TriCasterDevice&)), this, SLOT(deviceTallyChanged(TriCasterDevice&)));
+    }
 
     checkDeviceConnection();
+    checkTally();
 }
 
 void RundownInputWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
@@ -77,6 +77,7 @@ class WIDGETS_EXPORT RundownInputWidget : public QWidget, Ui::RundownInputWidget
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
+        void checkTally();
         void configureOscSubscriptions();
 
         Q_SLOT void executePlay();
@@ -86,6 +87,8 @@ class WIDGETS_EXPORT RundownInputWidget : public QWidget, Ui::RundownInputWidget
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(TriCasterDevice&);
+        Q_SLOT void deviceTallyChanged(TriCasterDevice&);
+        Q_SLOT void inputChanged(const QString&);
         Q_SLOT void deviceAdded(TriCasterDevice&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playNowControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -118,16 +118,7 @@ AbstractRundownWidget* RundownMacroWidget::clone()
     RundownMacroWidget* widget = new RundownMacroWidget(this->model, this->parentWidget(), this->color, this->active,
                                                         this->inGroup, this->compactView);
 
-    MacroCommand* command = dynamic_cast<MacroCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setMacro(this->command.getMacro());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownNetworkSourceWidget::clone()
     RundownNetworkSourceWidget* widget = new RundownNetworkSourceWidget(this->model, this->parentWidget(), this->color, this->active,
                                                                         this->inGroup, this->compactView);
 
-    NetworkSourceCommand* command = dynamic_cast<NetworkSourceCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setTarget(this->command.getTarget());
-    command->setSource(this->command.getSource());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -118,17 +118,7 @@ AbstractRundownWidget* RundownPresetWidget::clone()
     RundownPresetWidget* widget = new RundownPresetWidget(this->model, this->parentWidget(), this->color, this->active,
                                                           this->inGroup, this->compactView);
 
-    PresetCommand* command = dynamic_cast<PresetCommand*>(widget->getCommand());
-    command->setChannel(this->command.getChannel());
-    command->setVideolayer(this->command.getVideolayer());
-    command->setDelay(this->command.getDelay());
-    command->setDuration(this->command.getDuration());
-    command->setAllowGpi(this->command.getAllowGpi());
-    command->setAllowRemoteTriggering(this->command.getAllowRemoteTriggering());
-    command->setRemoteTriggerId(this->command.getRemoteTriggerId());
-    command->setSource(this->command.getSource());
-    command->setPreset(this->command.getPreset());
-    command->setTriggerOnNext(this->command.getTriggerOnNext());
+    widget->getCommand()->copyProperties(&this->command);
 
     return widget;
 }
@@ -119,6 +119,9 @@ SettingsDialog::SettingsDialog(QWidget* parent)
     bool storeThumbnailsInDatabase = (DatabaseManager::getInstance().getConfigurationByName("StoreThumbnailsInDatabase").getValue() == "true") ? true : false;
     this->checkBoxStoreThumbnailsInDatabase->setChecked(storeThumbnailsInDatabase);
 
+    bool shareLibrary = (DatabaseManager::getInstance().getConfigurationByName("ShareLibrary").getValue() == "true") ? true : false;
+    this->checkBoxShareLibrary->setChecked(shareLibrary);
+
     this->lineEditOscInputPort->setPlaceholderText(QString("%1").arg(Osc::DEFAULT_PORT));
     QString oscPort = DatabaseManager::getInstance().getConfigurationByName("OscPort").getValue();
     if (!oscPort.isEmpty())
@@ -292,6 +295,7 @@ void SettingsDialog::loadGpi()
 
     this->lineEditSerialPort->setText(serialPort);
     this->comboBoxGpiBaudRate->setCurrentIndex(comboBoxGpiBaudRate->findText(QString("%1").arg(baudRate)));
+    this->spinBoxGpiDebounceTime->setValue(DatabaseManager::getInstance().getConfigurationByName("GpiDebounceTime").getValue().toInt());
 }
 
 void SettingsDialog::loadOscOutput()
@@ -830,6 +834,14 @@ void SettingsDialog::baudRateChanged(QString baudRate)
     updateGpiDevice();
 }
 
+void SettingsDialog::debounceTimeChanged(int debounceTime)
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "GpiDebounceTime", QString("%1").arg(debounceTime)));
+
+    // No need to reopen the serial port for this.
+    GpiManager::getInstance().getGpiDevice()->setDebounceTime(debounceTime);
+}
+
 void SettingsDialog::oscPortChanged()
 {
     QString oscPort = this->lineEditOscInputPort->text().trimmed();
@@ -915,6 +927,12 @@ void SettingsDialog::storeThumbnailsInDatabaseChanged(int state)
     DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "StoreThumbnailsInDatabase", storeThumbnailsInDatabase));
 }
 
+void SettingsDialog::shareLibraryChanged(int state)
+{
+    QString shareLibrary = (state == Qt::Checked) ? "true" : "false";
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "ShareLibrary", shareLibrary));
+}
+
 void SettingsDialog::deleteThumbnails()
 {
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Deleting thumbnails..."));
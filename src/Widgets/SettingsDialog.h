@@ -72,6 +72,7 @@ class WIDGETS_EXPORT SettingsDialog : public QDialog, Ui::SettingsDialog
         Q_SLOT void serialPortChanged();
         Q_SLOT void streamPortChanged();
         Q_SLOT void baudRateChanged(QString);
+        Q_SLOT void debounceTimeChanged(int);
         Q_SLOT void oscPortChanged();
         Q_SLOT void oscWebSocketPortChanged();
         Q_SLOT void repositoryPortChanged();
@@ -90,6 +91,7 @@ class WIDGETS_EXPORT SettingsDialog : public QDialog, Ui::SettingsDialog
         Q_SLOT void clearDelayedCommandsOnAutoStepChanged(int);
         Q_SLOT void deleteThumbnails();
         Q_SLOT void storeThumbnailsInDatabaseChanged(int);
+        Q_SLOT void shareLibraryChanged(int);
         Q_SLOT void markUsedItemsChanged(int);
         Q_SLOT void showAudioLevelsChanged(int);
         Q_SLOT void showPreviewChanged(int);
@@ -1,4 +1,4 @@
-QT += core gui sql network widgets
+QT += core gui sql network widgets concurrent
 
 CONFIG += c++11
 
@@ -14,6 +14,7 @@ HEADERS += \
     AboutDialog.h \
     Shared.h \
     HelpDialog.h \
+    GpiDiagnosticsDialog.h \
     Inspector/InspectorWidget.h \
     Inspector/InspectorTemplateWidget.h \
     Inspector/InspectorOutputWidget.h \
@@ -62,6 +63,8 @@ HEADERS += \
     Inspector/InspectorSolidColorWidget.h \
     Rundown/RundownTreeWidget.h \
     Rundown/RundownItemFactory.h \
+    Rundown/AutoPlayQueue.h \
+    Rundown/RepositoryChange.h \
     DeviceDialog.h \
     PresetDialog.h \
     Rundown/RundownCustomCommandWidget.h \
@@ -70,12 +73,16 @@ HEADERS += \
     OscTimeWidget.h \
     Action/ActionWidget.h \
     Rundown/RundownTreeBaseWidget.h \
+    Rundown/RundownItemMimeData.h \
+    Rundown/RundownJournal.h \
+    Rundown/RundownSearchIndex.h \
     Library/DataTreeBaseWidget.h \
     Library/ToolTreeBaseWidget.h \
     Library/AudioTreeBaseWidget.h \
     Library/ImageTreeBaseWidget.h \
     Library/TemplateTreeBaseWidget.h \
     Library/VideoTreeBaseWidget.h \
+    Library/LibraryItemMimeData.h \
     Library/PresetTreeBaseWidget.h \
     Rundown/RundownChromaWidget.h \
     Inspector/InspectorChromaWidget.h \
@@ -121,9 +128,12 @@ HEADERS += \
     AudioMeterWidget.h \
     AudioLevelsWidget.h \
     LiveWidget.h \
+    LivePreview.h \
     Rundown/RundownPlayoutCommandWidget.h \
     Inspector/InspectorPlayoutCommandWidget.h \
     LiveDialog.h \
+    MultiviewWidget.h \
+    MultiviewDialog.h \
     Rundown/RundownFadeToBlackWidget.h \
     Inspector/InspectorFadeToBlackWidget.h \
     DurationWidget.h \
@@ -173,6 +183,7 @@ SOURCES += \
     AboutDialog.cpp \
     MainWindow.cpp \
     HelpDialog.cpp \
+    GpiDiagnosticsDialog.cpp \
     Inspector/InspectorWidget.cpp \
     Inspector/InspectorTemplateWidget.cpp \
     Inspector/InspectorOutputWidget.cpp \
@@ -220,6 +231,8 @@ SOURCES += \
     Inspector/InspectorSolidColorWidget.cpp \
     Rundown/RundownTreeWidget.cpp \
     Rundown/RundownItemFactory.cpp \
+    Rundown/AutoPlayQueue.cpp \
+    Rundown/RepositoryChange.cpp \
     DeviceDialog.cpp \
     PresetDialog.cpp \
     Rundown/RundownCustomCommandWidget.cpp \
@@ -228,12 +241,16 @@ SOURCES += \
     OscTimeWidget.cpp \
     Action/ActionWidget.cpp \
     Rundown/RundownTreeBaseWidget.cpp \
+    Rundown/RundownItemMimeData.cpp \
+    Rundown/RundownJournal.cpp \
+    Rundown/RundownSearchIndex.cpp \
     Library/DataTreeBaseWidget.cpp \
     Library/ToolTreeBaseWidget.cpp \
     Library/AudioTreeBaseWidget.cpp \
     Library/ImageTreeBaseWidget.cpp \
     Library/TemplateTreeBaseWidget.cpp \
     Library/VideoTreeBaseWidget.cpp \
+    Library/LibraryItemMimeData.cpp \
     Library/PresetTreeBaseWidget.cpp \
     Rundown/RundownChromaWidget.cpp \
     Inspector/InspectorChromaWidget.cpp \
@@ -279,9 +296,12 @@ SOURCES += \
     AudioMeterWidget.cpp \
     AudioLevelsWidget.cpp \
     LiveWidget.cpp \
+    LivePreview.cpp \
     Rundown/RundownPlayoutCommandWidget.cpp \
     Inspector/InspectorPlayoutCommandWidget.cpp \
     LiveDialog.cpp \
+    MultiviewWidget.cpp \
+    MultiviewDialog.cpp \
     Rundown/RundownFadeToBlackWidget.cpp \
     Inspector/InspectorFadeToBlackWidget.cpp \
     DurationWidget.cpp \
@@ -331,6 +351,7 @@ FORMS += \
     PreviewWidget.ui \
     AboutDialog.ui \
     HelpDialog.ui \
+    GpiDiagnosticsDialog.ui \
     Inspector/InspectorVolumeWidget.ui \
     Inspector/InspectorWidget.ui \
     Inspector/InspectorTemplateWidget.ui \
@@ -423,12 +444,12 @@ FORMS += \
     Inspector/Atem/InspectorAtemAudioInputBalanceWidget.ui \
     Inspector/Atem/InspectorAtemAudioGainWidget.ui \
     Rundown/OpenRundownFromUrlDialog.ui \
-    AudioMeterWidget.ui \
     AudioLevelsWidget.ui \
     LiveWidget.ui \
     Rundown/RundownPlayoutCommandWidget.ui \
     Inspector/InspectorPlayoutCommandWidget.ui \
     LiveDialog.ui \
+    MultiviewDialog.ui \
     Rundown/RundownFadeToBlackWidget.ui \
     Inspector/InspectorFadeToBlackWidget.ui \
     DurationWidget.ui \